@@ -33,13 +33,19 @@
 #include <SFML/Audio/InputSoundFile.hpp>
 #include <SFML/Audio/Listener.hpp>
 #include <SFML/Audio/Music.hpp>
+#include <SFML/Audio/OfflineRenderer.hpp>
 #include <SFML/Audio/OutputSoundFile.hpp>
+#include <SFML/Audio/Resampler.hpp>
 #include <SFML/Audio/Sound.hpp>
 #include <SFML/Audio/SoundBuffer.hpp>
+#include <SFML/Audio/SoundBufferCache.hpp>
 #include <SFML/Audio/SoundBufferRecorder.hpp>
 #include <SFML/Audio/SoundFileFactory.hpp>
 #include <SFML/Audio/SoundFileReader.hpp>
 #include <SFML/Audio/SoundFileWriter.hpp>
+#include <SFML/Audio/SoundMixer.hpp>
+#include <SFML/Audio/SoundMixerStream.hpp>
+#include <SFML/Audio/SoundPool.hpp>
 #include <SFML/Audio/SoundRecorder.hpp>
 #include <SFML/Audio/SoundSource.hpp>
 #include <SFML/Audio/SoundStream.hpp>
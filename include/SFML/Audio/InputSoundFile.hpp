@@ -62,7 +62,7 @@ public:
     ////////////////////////////////////////////////////////////
     /// \brief Open a sound file from the disk for reading
     ///
-    /// The supported audio formats are: WAV (PCM only), OGG/Vorbis, FLAC.
+    /// The supported audio formats are: WAV (PCM and 32 bit float), OGG/Vorbis, FLAC.
     /// The supported sample sizes for FLAC and WAV are 8, 16, 24 and 32 bit.
     ///
     /// \param filename Path of the sound file to load
@@ -75,7 +75,7 @@ public:
     ////////////////////////////////////////////////////////////
     /// \brief Open a sound file in memory for reading
     ///
-    /// The supported audio formats are: WAV (PCM only), OGG/Vorbis, FLAC.
+    /// The supported audio formats are: WAV (PCM and 32 bit float), OGG/Vorbis, FLAC.
     /// The supported sample sizes for FLAC and WAV are 8, 16, 24 and 32 bit.
     ///
     /// \param data        Pointer to the file data in memory
@@ -89,7 +89,7 @@ public:
     ////////////////////////////////////////////////////////////
     /// \brief Open a sound file from a custom stream for reading
     ///
-    /// The supported audio formats are: WAV (PCM only), OGG/Vorbis, FLAC.
+    /// The supported audio formats are: WAV (PCM and 32 bit float), OGG/Vorbis, FLAC.
     /// The supported sample sizes for FLAC and WAV are 8, 16, 24 and 32 bit.
     ///
     /// \param stream Source stream to read from
@@ -135,6 +135,19 @@ public:
     ////////////////////////////////////////////////////////////
     unsigned int getSampleRate() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the precision of the samples stored in the file
+    ///
+    /// Samples wider than 16 bits lose precision when they are
+    /// read as 16 bit integers, read them as floats instead.
+    ///
+    /// \return Number of bits per sample (32 for floating point
+    ///         samples), or 0 if unknown (the reader doesn't
+    ///         provide it, or the format is lossy like Vorbis)
+    ///
+    ////////////////////////////////////////////////////////////
+    unsigned int getBitsPerSample() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the total duration of the sound file
     ///
@@ -186,6 +199,22 @@ public:
     ////////////////////////////////////////////////////////////
     Uint64 read(Int16* samples, Uint64 maxCount);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Read audio samples from the open file, as floating point numbers
+    ///
+    /// The samples are normalized to the range [-1, 1]. Unlike
+    /// the 16 bits version, this function keeps the full precision
+    /// of formats that store more precise samples (24 and 32 bit,
+    /// floating point, Vorbis).
+    ///
+    /// \param samples  Pointer to the sample array to fill
+    /// \param maxCount Maximum number of samples to read
+    ///
+    /// \return Number of samples actually read (may be less than \a maxCount)
+    ///
+    ////////////////////////////////////////////////////////////
+    Uint64 read(float* samples, Uint64 maxCount);
+
 private:
 
     ////////////////////////////////////////////////////////////
@@ -197,12 +226,13 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    SoundFileReader* m_reader;       ///< Reader that handles I/O on the file's format
-    InputStream*     m_stream;       ///< Input stream used to access the file's data
-    bool             m_streamOwned;  ///< Is the stream internal or external?
-    Uint64           m_sampleCount;  ///< Total number of samples in the file
-    unsigned int     m_channelCount; ///< Number of channels of the sound
-    unsigned int     m_sampleRate;   ///< Number of samples per second
+    SoundFileReader* m_reader;        ///< Reader that handles I/O on the file's format
+    InputStream*     m_stream;        ///< Input stream used to access the file's data
+    bool             m_streamOwned;   ///< Is the stream internal or external?
+    Uint64           m_sampleCount;   ///< Total number of samples in the file
+    unsigned int     m_channelCount;  ///< Number of channels of the sound
+    unsigned int     m_sampleRate;    ///< Number of samples per second
+    unsigned int     m_bitsPerSample; ///< Precision of the samples, 0 if unknown
 };
 
 } // namespace sf
@@ -41,6 +41,11 @@ namespace sf
 {
 class InputStream;
 
+namespace priv
+{
+    class MusicReadAhead;
+}
+
 ////////////////////////////////////////////////////////////
 /// \brief Streamed music played from an audio file
 ///
@@ -134,6 +139,38 @@ public:
     ////////////////////////////////////////////////////////////
     Time getDuration() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the duration of audio decoded in advance
+    ///
+    /// By default, the music is decoded by the streaming thread
+    /// when a new chunk is needed; a slow decoder or a slow read
+    /// from the source can then delay the stream enough to be
+    /// heard. With a read-ahead duration, the streaming threads
+    /// decode the music in advance, between the refills of the
+    /// streams, so that the chunks are ready when the stream needs
+    /// them; a chunk which is not ready in time is decoded
+    /// immediately, as without read-ahead.
+    /// The new value is applied the next time the music is played
+    /// or its playing position changes. Time::Zero (the default)
+    /// disables the read-ahead.
+    ///
+    /// \param duration Duration of audio to decode in advance
+    ///
+    /// \see getReadAheadDuration
+    ///
+    ////////////////////////////////////////////////////////////
+    void setReadAheadDuration(Time duration);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the duration of audio decoded in advance
+    ///
+    /// \return Duration of audio decoded in advance
+    ///
+    /// \see setReadAheadDuration
+    ///
+    ////////////////////////////////////////////////////////////
+    Time getReadAheadDuration() const;
+
 protected:
 
     ////////////////////////////////////////////////////////////
@@ -159,19 +196,86 @@ protected:
 
 private:
 
+    friend class priv::MusicReadAhead;
+
     ////////////////////////////////////////////////////////////
     /// \brief Initialize the internal state after loading a new music
     ///
     ////////////////////////////////////////////////////////////
     void initialize();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Chunk of audio samples decoded in advance
+    ///
+    ////////////////////////////////////////////////////////////
+    struct DecodedChunk
+    {
+        std::vector<Int16> samples;      ///< Samples, if the stream plays 16 bits samples
+        std::vector<float> floatSamples; ///< Samples, if the stream plays floating point samples
+        std::size_t        sampleCount;  ///< Number of samples decoded
+        bool               last;         ///< Is it the last chunk of the file?
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of samples to decode for each chunk
+    ///
+    /// \return Number of samples of a chunk
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getChunkSampleCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Drop the chunks decoded in advance, and prepare to decode from the current position
+    ///
+    /// The file mutex must be locked by the caller.
+    ///
+    /// \param decode True to decode from the current position, false to stop decoding
+    ///
+    /// \return True if the read-ahead is enabled
+    ///
+    ////////////////////////////////////////////////////////////
+    bool resetReadAhead(bool decode);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Stop decoding the current chunk as soon as possible
+    ///
+    /// The decoding stops until the next call to resetReadAhead.
+    ///
+    ////////////////////////////////////////////////////////////
+    void cancelReadAhead();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Decode the next block of the chunk being filled in advance, if there's room for it
+    ///
+    /// The chunk is published once all its blocks are decoded.
+    /// It is called by the read-ahead task, and repeatedly by
+    /// onGetData when the task is late.
+    ///
+    /// \return True if a block was decoded, false if there was nothing to do
+    ///
+    ////////////////////////////////////////////////////////////
+    bool decodeNextBlock();
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    InputSoundFile     m_file;     ///< The streamed music file
-    Time               m_duration; ///< Music duration
-    std::vector<Int16> m_samples;  ///< Temporary buffer of samples
-    Mutex              m_mutex;    ///< Mutex protecting the data
+    InputSoundFile            m_file;              ///< The streamed music file
+    Time                      m_duration;          ///< Music duration
+    std::vector<Int16>        m_samples;           ///< Temporary buffer of samples
+    std::vector<float>        m_floatSamples;      ///< Temporary buffer of floating point samples
+    Mutex                     m_mutex;             ///< Mutex protecting the file, held while decoding
+    priv::MusicReadAhead*     m_readAheadTask;     ///< Task of the streaming threads decoding the chunks in advance
+    mutable Mutex             m_readAheadMutex;    ///< Mutex protecting the chunks decoded in advance
+    Time                      m_readAhead;         ///< Duration of audio to decode in advance
+    std::vector<DecodedChunk> m_chunks;            ///< Ring of chunks decoded in advance (empty if the read-ahead is disabled)
+    std::size_t               m_firstChunk;        ///< Index of the first chunk in use in the ring
+    std::size_t               m_readyChunks;       ///< Number of decoded chunks not handed to the stream yet
+    std::size_t               m_decodedCount;      ///< Number of samples already decoded in the chunk being filled
+    bool                      m_chunkHanded;       ///< Is the first chunk handed to the stream (and thus still in use)?
+    std::size_t               m_chunkSize;         ///< Number of samples of the chunks decoded in advance
+    bool                      m_decodeFloat;       ///< Are the chunks decoded as floating point samples?
+    bool                      m_decodingEnded;     ///< Has the last chunk of the file been decoded?
+    bool                      m_decodingCancelled; ///< Must the decoding stop until the next reset?
 };
 
 } // namespace sf
@@ -203,6 +307,10 @@ private:
 /// leave the music alone after calling play(), it will manage itself
 /// very well.
 ///
+/// Compressed formats can be expensive to decode, and reading
+/// from a slow source can stall: setReadAheadDuration makes the
+/// music decode its chunks in advance, in the streaming threads.
+///
 /// Usage example:
 /// \code
 /// // Declare a new music
@@ -0,0 +1,238 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_OFFLINERENDERER_HPP
+#define SFML_OFFLINERENDERER_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/Export.hpp>
+#include <SFML/Audio/Resampler.hpp>
+#include <SFML/Audio/SoundMixer.hpp>
+#include <SFML/System/NonCopyable.hpp>
+#include <SFML/System/Time.hpp>
+#include <string>
+#include <vector>
+
+
+namespace sf
+{
+class SoundStream;
+
+////////////////////////////////////////////////////////////
+/// \brief Render sound mixes in memory or to a file, as fast
+///        as possible and without the audio device
+///
+////////////////////////////////////////////////////////////
+class SFML_AUDIO_API OfflineRenderer : NonCopyable
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the renderer with its output format
+    ///
+    /// The output can have 1 (mono) or 2 (stereo) channels.
+    ///
+    /// \param channelCount Number of channels of the rendered audio
+    /// \param sampleRate   Sample rate of the rendered audio, in samples per second
+    ///
+    ////////////////////////////////////////////////////////////
+    OfflineRenderer(unsigned int channelCount = 2, unsigned int sampleRate = 44100);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the mixer of the renderer
+    ///
+    /// Sounds are rendered by playing their samples as voices
+    /// of this mixer.
+    ///
+    /// \return Mixer of the renderer
+    ///
+    ////////////////////////////////////////////////////////////
+    SoundMixer& getMixer();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a sound stream (typically a sf::Music) to the mix
+    ///
+    /// The audio data of the stream is pulled directly from its
+    /// source, from its beginning: the stream must not be played
+    /// while it is rendered, and it must remain alive until the
+    /// renderer is destroyed. Looping streams (see SoundStream::setLoop)
+    /// restart from the beginning when they reach their end.
+    /// Streams that don't have the sample rate of the renderer
+    /// are converted (see sf::Resampler).
+    ///
+    /// \param stream Stream to render
+    /// \param volume Volume of the stream, in the range [0, 100]
+    /// \param pan    Stereo balance of the stream, in the range [-1 (left), 1 (right)]
+    ///
+    /// \return True if the stream was added, false if its format is not supported
+    ///
+    ////////////////////////////////////////////////////////////
+    bool addStream(SoundStream& stream, float volume = 100.f, float pan = 0.f);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether everything has been rendered
+    ///
+    /// \return True if no voice is playing and all the streams have ended
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isFinished() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Render the next frames of the mix in memory
+    ///
+    /// The output array is overwritten with \a frameCount frames
+    /// of interleaved floating point samples, i.e. \a frameCount
+    /// * channel count samples.
+    ///
+    /// \param samples    Array to fill with the rendered samples
+    /// \param frameCount Number of frames to render
+    ///
+    /// \return Number of frames reached by the voices and streams; the frames after it are silent
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t render(float* samples, std::size_t frameCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Render the mix to an audio file
+    ///
+    /// Rendering stops when everything has been rendered (see
+    /// isFinished), or when \a maxDuration has been rendered;
+    /// the file ends with the last rendered frame.
+    /// See the documentation of sf::OutputSoundFile for the list
+    /// of supported formats, and for the ones that can store
+    /// floating point samples.
+    ///
+    /// \param filename     Path of the sound file to write
+    /// \param maxDuration  Maximum duration of the rendered audio
+    /// \param floatSamples True to write floating point samples, false to write 16 bits samples
+    ///
+    /// \return True if rendering succeeded, false if the file couldn't be written
+    ///
+    ////////////////////////////////////////////////////////////
+    bool renderToFile(const std::string& filename, Time maxDuration, bool floatSamples = false);
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Stream added to the mix
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Stream
+    {
+        SoundStream*       stream;    ///< Stream to pull the data from
+        float              gains[2];  ///< Gain applied to each output channel
+        Resampler          resampler; ///< Converts the stream to the sample rate of the renderer
+        std::vector<float> input;     ///< Last chunk returned by the stream
+        std::vector<float> samples;   ///< Last chunk, at the sample rate of the renderer
+        std::size_t        offset;    ///< Number of samples of the chunk already rendered
+        bool               ended;     ///< Has the stream returned its last chunk?
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Pull the next chunk of a stream
+    ///
+    /// \param stream Stream to update
+    ///
+    /// \return True if the stream returned some samples
+    ///
+    ////////////////////////////////////////////////////////////
+    bool pullChunk(Stream& stream);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add the next frames of a stream to the output
+    ///
+    /// \param stream     Stream to render
+    /// \param samples    Output samples to add the stream to
+    /// \param frameCount Number of frames to render
+    ///
+    /// \return Number of frames rendered before the stream ended
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t renderStream(Stream& stream, float* samples, std::size_t frameCount);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    unsigned int        m_channelCount; ///< Number of channels of the output
+    unsigned int        m_sampleRate;   ///< Sample rate of the output
+    SoundMixer          m_mixer;        ///< Mixer rendering the voices
+    std::vector<Stream> m_streams;      ///< Streams rendered along with the voices
+};
+
+} // namespace sf
+
+
+#endif // SFML_OFFLINERENDERER_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::OfflineRenderer
+/// \ingroup audio
+///
+/// sf::OfflineRenderer mixes sounds and streams in memory,
+/// as fast as the CPU allows, instead of playing them in real
+/// time through the audio device. It can be used to render
+/// mixes or replays to audio files, for example on a server
+/// that has no sound card.
+///
+/// Sounds are played as voices of the renderer's mixer (see
+/// sf::SoundMixer); to stay independent from the audio device,
+/// they can be decoded with sf::InputSoundFile and played from
+/// arrays of samples rather than from sf::SoundBuffer instances.
+/// Streams such as sf::Music are rendered by pulling their data
+/// directly from their source; note that, being audio sources,
+/// streams still try to open the audio device when they are created.
+///
+/// sf::Sound instances can't be rendered: they are played by
+/// the audio device only, which doesn't give access to its
+/// output. Play their sound buffer on the mixer instead.
+///
+/// Renderers don't share any state: several of them can run
+/// in parallel, typically one per thread.
+///
+/// Usage example:
+/// \code
+/// // Decode an effect
+/// sf::InputSoundFile file;
+/// file.openFromFile("explosion.wav");
+/// std::vector<float> explosion(static_cast<std::size_t>(file.getSampleCount()));
+/// file.read(&explosion[0], explosion.size());
+///
+/// // Set up the mix: a music and an effect
+/// sf::Music music;
+/// music.openFromFile("music.ogg");
+///
+/// sf::OfflineRenderer renderer(2, music.getSampleRate());
+/// renderer.addStream(music);
+/// renderer.getMixer().play(&explosion[0], explosion.size(), file.getChannelCount(), file.getSampleRate());
+///
+/// // Render the first minute
+/// renderer.renderToFile("mix.ogg", sf::seconds(60));
+/// \endcode
+///
+/// \see sf::SoundMixer, sf::OutputSoundFile
+///
+////////////////////////////////////////////////////////////
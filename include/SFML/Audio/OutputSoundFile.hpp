@@ -82,6 +82,21 @@ public:
     ////////////////////////////////////////////////////////////
     void write(const Int16* samples, Uint64 count);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Write floating point audio samples to the file
+    ///
+    /// The samples must be normalized to the range [-1, 1].
+    /// WAV and OGG files keep their precision (WAV files store
+    /// floating point samples when the first samples written to
+    /// them are floating point); the other formats convert them
+    /// to 16 bits.
+    ///
+    /// \param samples     Pointer to the sample array to write
+    /// \param count       Number of samples to write
+    ///
+    ////////////////////////////////////////////////////////////
+    void write(const float* samples, Uint64 count);
+
 private:
 
     ////////////////////////////////////////////////////////////
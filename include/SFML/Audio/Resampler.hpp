@@ -0,0 +1,195 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_RESAMPLER_HPP
+#define SFML_RESAMPLER_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/Export.hpp>
+#include <cstdlib>
+#include <vector>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Convert audio samples from a sample rate to another
+///
+////////////////////////////////////////////////////////////
+class SFML_AUDIO_API Resampler
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Quality of the conversion
+    ///
+    ////////////////////////////////////////////////////////////
+    enum Quality
+    {
+        Linear, ///< Linear interpolation: cheap, but attenuates high frequencies and lets aliasing through
+        Sinc    ///< Windowed sinc filter: slower, but transparent
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// The default resampler copies its input unchanged.
+    ///
+    ////////////////////////////////////////////////////////////
+    Resampler();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the resampler for a given conversion
+    ///
+    /// \param channelCount Number of channels of the samples
+    /// \param inputRate    Sample rate of the input samples
+    /// \param outputRate   Sample rate of the output samples
+    /// \param quality      Quality of the conversion
+    ///
+    ////////////////////////////////////////////////////////////
+    Resampler(unsigned int channelCount, unsigned int inputRate, unsigned int outputRate, Quality quality = Sinc);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Forget the input samples received so far
+    ///
+    /// Call this function before processing samples which don't
+    /// follow the previous ones (for example after a seek).
+    ///
+    ////////////////////////////////////////////////////////////
+    void reset();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Convert a block of samples
+    ///
+    /// The input is processed as the continuation of the previous
+    /// blocks, so a stream can be converted block by block.
+    /// The filter needs a few input frames ahead of each output
+    /// frame: the output lags slightly behind the input, until
+    /// flush() is called.
+    ///
+    /// \param samples    Interleaved input samples
+    /// \param frameCount Number of input frames
+    /// \param output     Vector to which the output samples are appended
+    ///
+    /// \return Number of output frames appended
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t process(const float* samples, std::size_t frameCount, std::vector<float>& output);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Convert the input samples that are still pending
+    ///
+    /// Call this function after the last block of a stream.
+    ///
+    /// \param output Vector to which the output samples are appended
+    ///
+    /// \return Number of output frames appended
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t flush(std::vector<float>& output);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Convert a whole array of samples at once
+    ///
+    /// \param samples      Interleaved input samples
+    /// \param frameCount   Number of input frames
+    /// \param channelCount Number of channels of the samples
+    /// \param inputRate    Sample rate of the input samples
+    /// \param outputRate   Sample rate of the output samples
+    /// \param output       Vector to fill with the output samples
+    /// \param quality      Quality of the conversion
+    ///
+    ////////////////////////////////////////////////////////////
+    static void resample(const float* samples, std::size_t frameCount, unsigned int channelCount, unsigned int inputRate,
+                         unsigned int outputRate, std::vector<float>& output, Quality quality = Sinc);
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Produce the output frames located before an input frame
+    ///
+    /// \param output Vector to which the output samples are appended
+    /// \param end    Index of the first input frame (in the buffer) not to produce output frames for
+    ///
+    /// \return Number of output frames appended
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t produce(std::vector<float>& output, std::size_t end);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    unsigned int       m_channelCount; ///< Number of channels of the samples
+    unsigned int       m_inputRate;    ///< Sample rate of the input
+    unsigned int       m_outputRate;   ///< Sample rate of the output
+    Quality            m_quality;      ///< Quality of the conversion
+    std::size_t        m_halfTaps;     ///< Number of input frames used on each side of an output frame
+    std::vector<float> m_filter;       ///< Filter coefficients, one row of taps per phase
+    std::vector<float> m_buffer;       ///< Input frames not consumed yet, preceded by the history needed by the filter
+    std::size_t        m_index;        ///< Input frame of the next output frame, relative to the buffer
+    std::size_t        m_fraction;     ///< Fractional position of the next output frame, in 1 / outputRate units
+};
+
+} // namespace sf
+
+
+#endif // SFML_RESAMPLER_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::Resampler
+/// \ingroup audio
+///
+/// sf::Resampler converts floating point audio samples from
+/// a sample rate to another. Converting assets to the sample
+/// rate of the audio device once, when they are loaded, saves
+/// the conversion that the audio device would otherwise do
+/// every time they are played, with an unknown quality.
+///
+/// Two qualities are available: Linear is cheap but colors the
+/// sound, Sinc uses a windowed sinc filter (with a cutoff below
+/// the lowest of the two Nyquist frequencies) and is transparent.
+///
+/// The resampler can convert a whole array at once (see the
+/// static resample function), or a stream block by block with
+/// process() and flush().
+///
+/// sf::SoundBuffer::resample and sf::SoundStream::setOutputSampleRate
+/// use it to convert sound buffers and streams.
+///
+/// Usage example:
+/// \code
+/// std::vector<float> output;
+/// sf::Resampler resampler(2, 44100, 48000);
+///
+/// while (...)
+///     resampler.process(block, blockFrames, output);
+/// resampler.flush(output);
+/// \endcode
+///
+/// \see sf::SoundBuffer, sf::SoundStream
+///
+////////////////////////////////////////////////////////////
@@ -214,10 +214,14 @@ public:
 
 private:
 
+    friend class SoundBuffer;
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    const SoundBuffer* m_buffer; ///< Sound buffer bound to the source
+    const SoundBuffer* m_buffer;        ///< Sound buffer bound to the source
+    Sound*             m_previousSound; ///< Previous sound in the list of sounds that use the same buffer
+    Sound*             m_nextSound;     ///< Next sound in the list of sounds that use the same buffer
 };
 
 } // namespace sf
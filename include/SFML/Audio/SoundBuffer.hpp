@@ -30,10 +30,11 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Audio/Export.hpp>
 #include <SFML/Audio/AlResource.hpp>
+#include <SFML/Audio/Resampler.hpp>
+#include <SFML/System/Mutex.hpp>
 #include <SFML/System/Time.hpp>
 #include <string>
 #include <vector>
-#include <set>
 
 
 namespace sf
@@ -134,6 +135,54 @@ public:
     ////////////////////////////////////////////////////////////
     bool loadFromSamples(const Int16* samples, Uint64 sampleCount, unsigned int channelCount, unsigned int sampleRate);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Load the sound buffer from an array of floating point audio samples
+    ///
+    /// The samples are expected in the range [-1, 1]. They are
+    /// played without being converted to 16 bits if the audio
+    /// device supports floating point samples (AL_EXT_float32).
+    ///
+    /// \param samples      Pointer to the array of samples in memory
+    /// \param sampleCount  Number of samples in the array
+    /// \param channelCount Number of channels (1 = mono, 2 = stereo, ...)
+    /// \param sampleRate   Sample rate (number of samples to play per second)
+    ///
+    /// \return True if loading succeeded, false if it failed
+    ///
+    /// \see loadFromFile, loadFromMemory, saveToFile
+    ///
+    ////////////////////////////////////////////////////////////
+    bool loadFromSamples(const float* samples, Uint64 sampleCount, unsigned int channelCount, unsigned int sampleRate);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable the floating point decoding of files of unknown precision
+    ///
+    /// Files with more than 16 bits per sample are always decoded
+    /// to floating point when the audio device can play them.
+    /// Files which don't have a precision of their own, like
+    /// Vorbis, are decoded to 16 bits unless this option is
+    /// enabled, since floating point samples take twice as much
+    /// memory. Enable it to keep all the precision of the decoder.
+    /// The option applies to the next loadFromFile, loadFromMemory
+    /// or loadFromStream call. It is disabled by default.
+    ///
+    /// \param enabled True to decode files of unknown precision to floating point
+    ///
+    /// \see isFloatDecoding, getFloatSamples
+    ///
+    ////////////////////////////////////////////////////////////
+    void setFloatDecoding(bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether files of unknown precision are decoded to floating point
+    ///
+    /// \return True if files of unknown precision are decoded to floating point
+    ///
+    /// \see setFloatDecoding
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isFloatDecoding() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Save the sound buffer to an audio file
     ///
@@ -149,20 +198,87 @@ public:
     ////////////////////////////////////////////////////////////
     bool saveToFile(const std::string& filename) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Convert the samples of the buffer to another sample rate
+    ///
+    /// Converting sounds to the sample rate of the audio device
+    /// once, after loading them, avoids the conversion that the
+    /// device would otherwise perform every time they are played.
+    /// The samples keep their format (16 bits or floating point).
+    ///
+    /// \param sampleRate New sample rate
+    /// \param quality    Quality of the conversion
+    ///
+    /// \return True if the conversion succeeded, false if it failed
+    ///
+    /// \see getSampleRate, sf::Resampler
+    ///
+    ////////////////////////////////////////////////////////////
+    bool resample(unsigned int sampleRate, Resampler::Quality quality = Resampler::Sinc);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Free the copy of the samples kept in memory
+    ///
+    /// Once the samples are uploaded to the audio device, the
+    /// copy stored in the sound buffer is only needed to access
+    /// them with getSamples() or getFloatSamples(). This function
+    /// frees it; it is only available for sound buffers loaded
+    /// with loadFromFile, since the samples are decoded again from
+    /// the file the next time they are accessed. Sounds that use
+    /// the buffer are not affected, but the samples can't be
+    /// released while voices of a sf::SoundMixer play them.
+    ///
+    /// \return True if the samples were released, false if the buffer was not loaded from a file or is played by a mixer
+    ///
+    /// \see getSamples, getFloatSamples
+    ///
+    ////////////////////////////////////////////////////////////
+    bool releaseSamples();
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the array of audio samples stored in the buffer
     ///
     /// The format of the returned samples is 16 bits signed integer
     /// (sf::Int16). The total number of samples in this array
     /// is given by the getSampleCount() function.
+    /// If the buffer holds floating point samples (see
+    /// getFloatSamples), they are converted the first time this
+    /// function is called, and the converted copy is kept in
+    /// addition to the original samples.
+    /// If the samples were released, they are decoded again from
+    /// their file.
     ///
     /// \return Read-only pointer to the array of sound samples
     ///
-    /// \see getSampleCount
+    /// \see getSampleCount, getFloatSamples
     ///
     ////////////////////////////////////////////////////////////
     const Int16* getSamples() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the array of audio samples stored in the buffer, as floating point numbers
+    ///
+    /// The returned samples are in the range [-1, 1]. The total
+    /// number of samples in this array is given by the
+    /// getSampleCount() function.
+    /// The buffer holds floating point samples if it was loaded
+    /// from them, or from a file with more than 16 bits per sample
+    /// (or of unknown precision, like Vorbis, if setFloatDecoding
+    /// was enabled) when the audio device can play floating point
+    /// samples. Otherwise it holds
+    /// 16 bits samples, which are converted the first time this
+    /// function is called; the converted copy is kept in addition
+    /// to the original samples.
+    /// If the samples were released, they are decoded again from
+    /// their file.
+    ///
+    /// \return Read-only pointer to the array of sound samples
+    ///
+    /// \see getSampleCount, getSamples
+    ///
+    ////////////////////////////////////////////////////////////
+    const float* getFloatSamples() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the number of samples stored in the buffer
     ///
@@ -226,6 +342,7 @@ public:
 private:
 
     friend class Sound;
+    friend class SoundMixer;
 
     ////////////////////////////////////////////////////////////
     /// \brief Initialize the internal state after loading a new sound
@@ -265,17 +382,42 @@ private:
     void detachSound(Sound* sound) const;
 
     ////////////////////////////////////////////////////////////
-    // Types
+    /// \brief Decode the samples again from their file if they were released
+    ///
+    ////////////////////////////////////////////////////////////
+    void reloadSamples() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Register a mixer voice that reads the samples
+    ///
+    /// The samples can't be released until the voice is removed.
+    ///
+    ////////////////////////////////////////////////////////////
+    void addMixerVoice() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Unregister a mixer voice that read the samples
+    ///
     ////////////////////////////////////////////////////////////
-    typedef std::set<Sound*> SoundList; ///< Set of unique sound instances
+    void removeMixerVoice() const;
 
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    unsigned int       m_buffer;   ///< OpenAL buffer identifier
-    std::vector<Int16> m_samples;  ///< Samples buffer
-    Time               m_duration; ///< Sound duration
-    mutable SoundList  m_sounds;   ///< List of sounds that are using this buffer
+    unsigned int               m_buffer;          ///< OpenAL buffer identifier
+    mutable std::vector<Int16> m_samples;         ///< 16 bits samples, or their conversion requested by getSamples
+    mutable std::vector<float> m_floatSamples;    ///< Floating point samples, or their conversion requested by getFloatSamples
+    bool                       m_isFloat;         ///< Were the samples loaded as floating point numbers? (the other buffer is a cache)
+    bool                       m_floatDecoding;   ///< Are files of unknown precision decoded to floating point?
+    Time                       m_duration;        ///< Sound duration
+    unsigned int               m_channelCount;    ///< Number of channels, cached to not depend on the audio device
+    unsigned int               m_sampleRate;      ///< Sample rate, cached to not depend on the audio device
+    mutable Sound*             m_sounds;          ///< First sound of the list of sounds that are using this buffer
+    std::string                m_filename;        ///< File the samples were loaded from (empty if they don't come from a file)
+    mutable Uint64             m_sampleCount;     ///< Number of samples, even when they are released
+    mutable bool               m_samplesReleased; ///< Have the samples been released by releaseSamples?
+    mutable unsigned int       m_mixerVoices;     ///< Number of mixer voices reading the samples
+    mutable Mutex              m_mutex;           ///< Mutex protecting the decoding and conversions of the samples
 };
 
 } // namespace sf
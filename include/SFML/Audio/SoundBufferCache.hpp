@@ -0,0 +1,198 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_SOUNDBUFFERCACHE_HPP
+#define SFML_SOUNDBUFFERCACHE_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/Export.hpp>
+#include <SFML/System/Mutex.hpp>
+#include <SFML/System/NonCopyable.hpp>
+#include <cstdlib>
+#include <map>
+#include <string>
+
+
+namespace sf
+{
+class SoundBuffer;
+
+////////////////////////////////////////////////////////////
+/// \brief Shares the sound buffers loaded from the same files
+///
+////////////////////////////////////////////////////////////
+class SFML_AUDIO_API SoundBufferCache : NonCopyable
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    SoundBufferCache();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// All the sound buffers of the cache are destroyed, even
+    /// the ones that are still acquired.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~SoundBufferCache();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable the release of the samples of the loaded buffers
+    ///
+    /// If enabled, the samples of the buffers loaded by the cache
+    /// are only kept by the audio device: the copy kept in memory
+    /// by the sound buffer is released after loading (see
+    /// SoundBuffer::releaseSamples). It is disabled by default.
+    /// This setting doesn't affect the buffers already loaded.
+    ///
+    /// \param release True to release the samples after loading
+    ///
+    /// \see getReleaseSamples
+    ///
+    ////////////////////////////////////////////////////////////
+    void setReleaseSamples(bool release);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the samples of the loaded buffers are released
+    ///
+    /// \return True if the samples are released after loading
+    ///
+    /// \see setReleaseSamples
+    ///
+    ////////////////////////////////////////////////////////////
+    bool getReleaseSamples() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the sound buffer of a file, loading it if needed
+    ///
+    /// The file is only loaded the first time it is acquired;
+    /// the following calls return the same sound buffer. Each
+    /// successful call must be matched with a call to release().
+    ///
+    /// \param filename Path of the sound file to load
+    ///
+    /// \return Sound buffer of the file, or NULL if loading failed
+    ///
+    /// \see release
+    ///
+    ////////////////////////////////////////////////////////////
+    const SoundBuffer* acquire(const std::string& filename);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Release a sound buffer acquired with acquire()
+    ///
+    /// When the sound buffer of a file is not acquired anymore,
+    /// it is destroyed (and the sounds that still use it stop).
+    ///
+    /// \param filename Path of the sound file, as passed to acquire()
+    ///
+    /// \see acquire
+    ///
+    ////////////////////////////////////////////////////////////
+    void release(const std::string& filename);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of sound buffers in the cache
+    ///
+    /// \return Number of sound buffers
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getBufferCount() const;
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Sound buffer shared by the users of a file
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Entry
+    {
+        SoundBuffer* buffer;     ///< Sound buffer loaded from the file
+        unsigned int references; ///< Number of calls to acquire not matched by release yet
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Types
+    ////////////////////////////////////////////////////////////
+    typedef std::map<std::string, Entry> EntryMap; ///< Sound buffers, by file
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    EntryMap      m_entries;        ///< Sound buffers of the cache
+    bool          m_releaseSamples; ///< Release the samples of the buffers after loading them?
+    mutable Mutex m_mutex;          ///< Mutex protecting the cache
+};
+
+} // namespace sf
+
+
+#endif // SFML_SOUNDBUFFERCACHE_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::SoundBufferCache
+/// \ingroup audio
+///
+/// Loading the same file into several sf::SoundBuffer instances
+/// decodes it several times, and stores the samples several
+/// times both in memory and in the audio device.
+/// sf::SoundBufferCache makes sure that each file is loaded only
+/// once: the sound buffer of a file is shared by all the users
+/// that acquire it, and counts them so that it is destroyed
+/// when the last one releases it.
+///
+/// The shared sound buffers are read-only. To save even more
+/// memory, the cache can release the copy of the samples that
+/// sound buffers keep in memory (see setReleaseSamples): the
+/// samples are then only stored by the audio device, and are
+/// decoded again from the file if they are accessed.
+///
+/// All the functions of sf::SoundBufferCache can be called from
+/// any thread; files are loaded in the thread that acquires them.
+///
+/// Usage example:
+/// \code
+/// sf::SoundBufferCache cache;
+/// cache.setReleaseSamples(true);
+///
+/// // Both sounds use the same buffer, the file is loaded once
+/// sf::Sound shot1(*cache.acquire("gunshot.wav"));
+/// sf::Sound shot2(*cache.acquire("gunshot.wav"));
+///
+/// ...
+///
+/// cache.release("gunshot.wav");
+/// cache.release("gunshot.wav");
+/// \endcode
+///
+/// \see sf::SoundBuffer
+///
+////////////////////////////////////////////////////////////
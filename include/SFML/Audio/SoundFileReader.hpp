@@ -50,9 +50,10 @@ public:
     ////////////////////////////////////////////////////////////
     struct Info
     {
-        Uint64       sampleCount;  ///< Total number of samples in the file
-        unsigned int channelCount; ///< Number of channels of the sound
-        unsigned int sampleRate;   ///< Samples rate of the sound, in samples per second
+        Uint64       sampleCount;   ///< Total number of samples in the file
+        unsigned int channelCount;  ///< Number of channels of the sound
+        unsigned int sampleRate;    ///< Samples rate of the sound, in samples per second
+        unsigned int bitsPerSample; ///< Precision of the samples in the file, in bits (32 for floating point), 0 if unknown
     };
 
     ////////////////////////////////////////////////////////////
@@ -97,6 +98,23 @@ public:
     ///
     ////////////////////////////////////////////////////////////
     virtual Uint64 read(Int16* samples, Uint64 maxCount) = 0;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read audio samples from the open file, as floating point numbers
+    ///
+    /// The samples are normalized to the range [-1, 1].
+    /// The default implementation reads 16 bits samples and
+    /// converts them; readers of formats that store more precise
+    /// samples should override it, to avoid losing precision
+    /// and to save a conversion.
+    ///
+    /// \param samples  Pointer to the sample array to fill
+    /// \param maxCount Maximum number of samples to read
+    ///
+    /// \return Number of samples actually read (may be less than \a maxCount)
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual Uint64 read(float* samples, Uint64 maxCount);
 };
 
 } // namespace sf
@@ -135,7 +153,8 @@ public:
 ///     virtual bool open(sf::InputStream& stream, Info& info)
 ///     {
 ///         // read the sound file header and fill the sound attributes
-///         // (channel count, sample count and sample rate)
+///         // (channel count, sample count and sample rate, optionally
+///         // the number of bits per sample)
 ///         // return true on success
 ///     }
 ///
@@ -151,6 +170,13 @@ public:
 ///         // as 16-bits signed integers in the file
 ///         // return the actual number of samples read
 ///     }
+///
+///     // optional: avoids a conversion if the file stores samples more precise than 16 bits
+///     virtual sf::Uint64 read(float* samples, sf::Uint64 maxCount)
+///     {
+///         // read up to 'maxCount' samples normalized to [-1, 1] into the 'samples' array
+///         // return the actual number of samples read
+///     }
 /// };
 ///
 /// sf::SoundFileFactory::registerReader<MySoundFileReader>();
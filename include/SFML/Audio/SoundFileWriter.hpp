@@ -68,6 +68,20 @@ public:
     ///
     ////////////////////////////////////////////////////////////
     virtual void write(const Int16* samples, Uint64 count) = 0;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write floating point audio samples to the open file
+    ///
+    /// The samples are normalized to the range [-1, 1].
+    /// The default implementation converts them to 16 bits
+    /// samples; writers of formats that can store more precise
+    /// samples should override it, to avoid losing precision.
+    ///
+    /// \param samples Pointer to the sample array to write
+    /// \param count   Number of samples to write
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void write(const float* samples, Uint64 count);
 };
 
 } // namespace sf
@@ -115,6 +129,11 @@ public:
 ///         // write 'count' samples stored at address 'samples',
 ///         // convert them (for example to normalized float) if the format requires it
 ///     }
+///
+///     virtual void write(const float* samples, sf::Uint64 count)
+///     {
+///         // optional: write 'count' samples normalized to [-1, 1] stored at address 'samples'
+///     }
 /// };
 ///
 /// sf::SoundFileFactory::registerWriter<MySoundFileWriter>();
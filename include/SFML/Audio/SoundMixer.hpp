@@ -0,0 +1,361 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_SOUNDMIXER_HPP
+#define SFML_SOUNDMIXER_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/Export.hpp>
+#include <SFML/System/Mutex.hpp>
+#include <SFML/System/NonCopyable.hpp>
+#include <cstdlib>
+#include <vector>
+
+
+namespace sf
+{
+class SoundBuffer;
+
+////////////////////////////////////////////////////////////
+/// \brief Software mixer of many sound buffer voices into
+///        a single output
+///
+////////////////////////////////////////////////////////////
+class SFML_AUDIO_API SoundMixer : NonCopyable
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the mixer with its output format
+    ///
+    /// The output can have 1 (mono) or 2 (stereo) channels.
+    ///
+    /// \param channelCount Number of channels of the mixed output
+    /// \param sampleRate   Sample rate of the mixed output, in samples per second
+    ///
+    ////////////////////////////////////////////////////////////
+    SoundMixer(unsigned int channelCount = 2, unsigned int sampleRate = 44100);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~SoundMixer();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of channels of the mixed output
+    ///
+    /// \return Number of channels
+    ///
+    ////////////////////////////////////////////////////////////
+    unsigned int getChannelCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the sample rate of the mixed output
+    ///
+    /// \return Sample rate, in samples per second
+    ///
+    ////////////////////////////////////////////////////////////
+    unsigned int getSampleRate() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start playing a sound buffer on a new voice
+    ///
+    /// The sound buffer is not copied: it must remain alive,
+    /// and must not be modified, as long as the voice plays.
+    /// Its samples can't be released meanwhile (see
+    /// sf::SoundBuffer::releaseSamples).
+    /// Mono and stereo buffers can be played; their sample
+    /// rate doesn't have to match the one of the mixer.
+    ///
+    /// \param buffer Sound buffer to play
+    /// \param volume Volume of the voice, in the range [0, 100]
+    /// \param pitch  Pitch of the voice (1 = original pitch)
+    /// \param pan    Stereo balance of the voice, in the range [-1 (left), 1 (right)]
+    /// \param loop   True to loop the voice until it is stopped
+    ///
+    /// \return Handle of the new voice, or 0 if the buffer can't be played
+    ///
+    /// \see stop, isPlaying
+    ///
+    ////////////////////////////////////////////////////////////
+    Uint64 play(const SoundBuffer& buffer, float volume = 100.f, float pitch = 1.f, float pan = 0.f, bool loop = false);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start playing an array of samples on a new voice
+    ///
+    /// This overload doesn't need a sound buffer, and thus
+    /// doesn't use the audio device at all; it is useful to
+    /// render audio without a sound card (see sf::OfflineRenderer).
+    /// The samples are not copied: they must remain alive, and
+    /// must not be modified, as long as the voice plays.
+    ///
+    /// \param samples      Interleaved samples to play, in the range [-1, 1]
+    /// \param sampleCount  Number of samples in the array
+    /// \param channelCount Number of channels of the samples (1 or 2)
+    /// \param sampleRate   Sample rate of the samples, in samples per second
+    /// \param volume       Volume of the voice, in the range [0, 100]
+    /// \param pitch        Pitch of the voice (1 = original pitch)
+    /// \param pan          Stereo balance of the voice, in the range [-1 (left), 1 (right)]
+    /// \param loop         True to loop the voice until it is stopped
+    ///
+    /// \return Handle of the new voice, or 0 if the samples can't be played
+    ///
+    /// \see stop, isPlaying
+    ///
+    ////////////////////////////////////////////////////////////
+    Uint64 play(const float* samples, Uint64 sampleCount, unsigned int channelCount, unsigned int sampleRate,
+                float volume = 100.f, float pitch = 1.f, float pan = 0.f, bool loop = false);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Stop a voice
+    ///
+    /// This function does nothing if the voice has already ended.
+    ///
+    /// \param voice Handle of the voice to stop
+    ///
+    /// \see play, stopAll
+    ///
+    ////////////////////////////////////////////////////////////
+    void stop(Uint64 voice);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Stop all the voices
+    ///
+    /// \see stop
+    ///
+    ////////////////////////////////////////////////////////////
+    void stopAll();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether a voice is still playing
+    ///
+    /// \param voice Handle of the voice
+    ///
+    /// \return True if the voice is playing, false if it has ended or was stopped
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isPlaying(Uint64 voice) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the volume of a voice
+    ///
+    /// \param voice  Handle of the voice
+    /// \param volume Volume of the voice, in the range [0, 100]
+    ///
+    ////////////////////////////////////////////////////////////
+    void setVolume(Uint64 voice, float volume);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the pitch of a voice
+    ///
+    /// \param voice Handle of the voice
+    /// \param pitch Pitch of the voice (1 = original pitch)
+    ///
+    ////////////////////////////////////////////////////////////
+    void setPitch(Uint64 voice, float pitch);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the stereo balance of a voice
+    ///
+    /// \param voice Handle of the voice
+    /// \param pan   Stereo balance, in the range [-1 (left), 1 (right)]
+    ///
+    ////////////////////////////////////////////////////////////
+    void setPan(Uint64 voice, float pan);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of voices currently playing
+    ///
+    /// \return Number of voices playing
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getVoiceCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Mix the playing voices and advance them
+    ///
+    /// The output array is overwritten with \a frameCount frames
+    /// of interleaved floating point samples, i.e. \a frameCount
+    /// * getChannelCount() samples. Voices that reach their end
+    /// are released.
+    /// This function doesn't depend on the audio device: the
+    /// result only depends on the voices, which makes it usable
+    /// to render audio in memory.
+    ///
+    /// \param samples    Array to fill with the mixed samples
+    /// \param frameCount Number of frames to mix
+    ///
+    /// \return Number of frames reached by the voices; the frames after it are silent
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t mix(float* samples, std::size_t frameCount);
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief State of a voice
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Voice
+    {
+        const SoundBuffer* buffer;       ///< Sound buffer played by the voice (NULL if playing an array of samples)
+        const float*       samples;      ///< Floating point samples played by the voice (NULL if it plays 16 bits samples)
+        const Int16*       intSamples;   ///< 16 bits samples played by the voice (NULL if it plays floating point samples)
+        Uint64             frameCount;   ///< Number of frames of the buffer
+        unsigned int       channelCount; ///< Number of channels of the buffer
+        unsigned int       sampleRate;   ///< Sample rate of the buffer
+        Uint64             position;     ///< Reading position, in frames (32.32 fixed point)
+        Uint64             step;         ///< Increment of the position for each output frame (32.32 fixed point)
+        float              gains[2];     ///< Gain applied to each output channel
+        float              volume;       ///< Volume, in the range [0, 1]
+        float              pan;          ///< Stereo balance, in the range [-1, 1]
+        bool               loop;         ///< Does the voice loop?
+        bool               active;       ///< Is the voice playing?
+        Uint32             generation;   ///< Incremented every time the slot is reused, to invalidate old handles
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start playing samples on a new voice
+    ///
+    /// Exactly one of \a samples and \a intSamples must be set.
+    ///
+    /// \param buffer     Sound buffer that owns the samples, or NULL
+    /// \param samples    Floating point samples to play, or NULL
+    /// \param intSamples 16 bits samples to play, or NULL
+    ///
+    /// See the public play overloads for the other parameters.
+    ///
+    /// \return Handle of the new voice, or 0 if the samples can't be played
+    ///
+    ////////////////////////////////////////////////////////////
+    Uint64 addVoice(const SoundBuffer* buffer, const float* samples, const Int16* intSamples, Uint64 sampleCount,
+                    unsigned int channelCount, unsigned int sampleRate, float volume, float pitch, float pan, bool loop);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Release the slot of a voice that has ended or was stopped
+    ///
+    /// \param index Index of the voice slot
+    ///
+    ////////////////////////////////////////////////////////////
+    void removeVoice(std::size_t index);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Find the voice referenced by a handle
+    ///
+    /// \param voice Handle of the voice
+    ///
+    /// \return Pointer to the voice, or NULL if it has ended
+    ///
+    ////////////////////////////////////////////////////////////
+    Voice* findVoice(Uint64 voice);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update the gains of a voice after its volume or pan changed
+    ///
+    /// \param voice Voice to update
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateGains(Voice& voice) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update the position increment of a voice after its pitch changed
+    ///
+    /// \param voice Voice to update
+    /// \param pitch New pitch
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateStep(Voice& voice, float pitch) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Mix a voice into the output
+    ///
+    /// \param voice       Voice to mix
+    /// \param samples     Output samples to add the voice to
+    /// \param frameCount  Number of frames to mix
+    /// \param mixedFrames Filled with the number of frames actually mixed
+    ///
+    /// \return True if the voice is still playing, false if it has ended
+    ///
+    ////////////////////////////////////////////////////////////
+    bool mixVoice(Voice& voice, float* samples, std::size_t frameCount, std::size_t& mixedFrames) const;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    unsigned int             m_channelCount; ///< Number of channels of the output
+    unsigned int             m_sampleRate;   ///< Sample rate of the output
+    std::vector<Voice>       m_voices;       ///< Voice slots, active or free
+    std::vector<std::size_t> m_freeSlots;    ///< Indices of the free voice slots
+    std::size_t              m_voiceCount;   ///< Number of active voices
+    mutable Mutex            m_mutex;        ///< Mutex protecting the voices
+};
+
+} // namespace sf
+
+
+#endif // SFML_SOUNDMIXER_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::SoundMixer
+/// \ingroup audio
+///
+/// sf::SoundMixer mixes any number of voices, each one playing
+/// the samples of a sf::SoundBuffer with its own volume, pitch
+/// and stereo balance, into a single stream of samples.
+///
+/// Unlike sf::Sound, a voice doesn't use any audio device
+/// resource: the number of simultaneous voices is only limited
+/// by the CPU. This makes the mixer well suited to play lots of
+/// short effects (bullets, footsteps, ...). Voices are played
+/// in a fire-and-forget way: play() returns a handle that can be
+/// used to modify or stop the voice while it plays, and becomes
+/// invalid once the voice has ended.
+///
+/// The mixer itself doesn't output anything: use a
+/// sf::SoundMixerStream to play it through the audio device,
+/// or call mix() directly to render the voices in memory.
+///
+/// All the functions of sf::SoundMixer can be called from any
+/// thread.
+///
+/// Usage example:
+/// \code
+/// sf::SoundBuffer gunshot;
+/// gunshot.loadFromFile("gunshot.wav");
+///
+/// sf::SoundMixer mixer;
+/// sf::SoundMixerStream output(mixer);
+/// output.play();
+///
+/// // Later, play effects on the mixer
+/// mixer.play(gunshot, 80.f, 1.1f, -0.5f);
+/// \endcode
+///
+/// \see sf::SoundMixerStream, sf::SoundBuffer
+///
+////////////////////////////////////////////////////////////
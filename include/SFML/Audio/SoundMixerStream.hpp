@@ -0,0 +1,131 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_SOUNDMIXERSTREAM_HPP
+#define SFML_SOUNDMIXERSTREAM_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/Export.hpp>
+#include <SFML/Audio/SoundStream.hpp>
+#include <vector>
+
+
+namespace sf
+{
+class SoundMixer;
+
+////////////////////////////////////////////////////////////
+/// \brief Sound stream that plays the output of a sound mixer
+///
+////////////////////////////////////////////////////////////
+class SFML_AUDIO_API SoundMixerStream : public SoundStream
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the stream from the mixer to play
+    ///
+    /// The mixer is not copied: it must remain alive as long
+    /// as the stream uses it.
+    /// Since voices are typically short effects, the stream
+    /// uses short chunks (20 ms) and 4 buffers by default, to
+    /// keep the latency low; see setChunkDuration and
+    /// setBufferCount to tune it.
+    ///
+    /// \param mixer Mixer to play
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit SoundMixerStream(SoundMixer& mixer);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~SoundMixerStream();
+
+protected:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Request a new chunk of audio samples from the stream source
+    ///
+    /// This function mixes the next chunk of the mixer output.
+    ///
+    /// \param data Chunk of data to fill
+    ///
+    /// \return True to continue playback, false to stop
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual bool onGetData(Chunk& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the current playing position in the stream source
+    ///
+    /// A mixer output has no position: this function does nothing.
+    ///
+    /// \param timeOffset New playing position, relative to the beginning of the stream
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void onSeek(Time timeOffset);
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    SoundMixer&        m_mixer;   ///< Mixer to play
+    std::vector<float> m_samples; ///< Temporary buffer of mixed samples
+};
+
+} // namespace sf
+
+
+#endif // SFML_SOUNDMIXERSTREAM_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::SoundMixerStream
+/// \ingroup audio
+///
+/// sf::SoundMixerStream plays the mixed output of a sf::SoundMixer
+/// through a single audio source. The stream never ends by itself:
+/// when no voice is playing, it plays silence.
+///
+/// Like any sound stream, it can be paused, stopped, moved in
+/// the 3D scene, and its volume and pitch can be changed; this
+/// applies to all the voices of the mixer at once.
+///
+/// Usage example:
+/// \code
+/// sf::SoundMixer mixer(2, 48000);
+/// sf::SoundMixerStream output(mixer);
+/// output.play();
+///
+/// mixer.play(footstep, 50.f);
+/// \endcode
+///
+/// \see sf::SoundMixer
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,218 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_SOUNDPOOL_HPP
+#define SFML_SOUNDPOOL_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/Export.hpp>
+#include <SFML/Audio/Sound.hpp>
+#include <SFML/System/NonCopyable.hpp>
+#include <vector>
+
+
+namespace sf
+{
+class SoundBuffer;
+
+////////////////////////////////////////////////////////////
+/// \brief Fixed set of sounds playing sound buffers on demand
+///
+////////////////////////////////////////////////////////////
+class SFML_AUDIO_API SoundPool : NonCopyable
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the pool and allocate its voices
+    ///
+    /// Each voice is a sf::Sound, and thus uses an audio source
+    /// of the audio device for the whole lifetime of the pool.
+    ///
+    /// \param voiceCount Number of voices, i.e. maximum number of sounds playing at the same time
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit SoundPool(unsigned int voiceCount = 32);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of voices of the pool
+    ///
+    /// \return Number of voices
+    ///
+    ////////////////////////////////////////////////////////////
+    unsigned int getVoiceCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of voices currently playing or paused
+    ///
+    /// \return Number of busy voices
+    ///
+    ////////////////////////////////////////////////////////////
+    unsigned int getActiveVoiceCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start playing a sound buffer on a voice of the pool
+    ///
+    /// A free voice is used if there is one. Otherwise the voice
+    /// with the lowest priority is stolen (among voices of the same
+    /// priority: the quietest one, then the oldest one), unless
+    /// its priority is higher than the priority of the new sound,
+    /// in which case the new sound is not played.
+    /// The voice starts with the default attributes of sf::Sound.
+    ///
+    /// \param buffer   Sound buffer to play
+    /// \param priority Priority of the sound, higher priorities steal voices from lower ones
+    /// \param volume   Volume of the sound, in the range [0, 100]
+    /// \param pitch    Pitch of the sound (1 = original pitch)
+    /// \param loop     True to loop the sound until it is stopped
+    ///
+    /// \return Handle of the voice, or 0 if the sound could not be played
+    ///
+    /// \see stop, isPlaying, getSound
+    ///
+    ////////////////////////////////////////////////////////////
+    Uint64 play(const SoundBuffer& buffer, int priority = 0, float volume = 100.f, float pitch = 1.f, bool loop = false);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Stop a voice
+    ///
+    /// This function does nothing if the voice has already been
+    /// stolen by another sound.
+    ///
+    /// \param voice Handle of the voice
+    ///
+    /// \see play, stopAll
+    ///
+    ////////////////////////////////////////////////////////////
+    void stop(Uint64 voice);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Stop all the voices
+    ///
+    /// \see stop
+    ///
+    ////////////////////////////////////////////////////////////
+    void stopAll();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether a voice is still playing (or paused)
+    ///
+    /// \param voice Handle of the voice
+    ///
+    /// \return True if the voice is playing or paused, false if it has ended or has been stolen
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isPlaying(Uint64 voice) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the sound of a voice, to change its attributes
+    ///
+    /// The returned sound can be used to change the position,
+    /// volume, pitch, etc. of the voice, or to pause it. It must
+    /// not be kept: once the voice is stolen by another sound,
+    /// it plays something else.
+    ///
+    /// \param voice Handle of the voice
+    ///
+    /// \return Sound of the voice, or NULL if it has been stolen
+    ///
+    ////////////////////////////////////////////////////////////
+    Sound* getSound(Uint64 voice);
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Voice of the pool
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Voice
+    {
+        Sound  sound;      ///< Sound playing the buffers
+        int    priority;   ///< Priority of the current sound
+        Uint64 order;      ///< Order in which the current sound was started, to find the oldest one
+        Uint32 generation; ///< Incremented every time the voice is reused, to invalidate old handles
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Find the voice referenced by a handle
+    ///
+    /// \param voice Handle of the voice
+    ///
+    /// \return Index of the voice, or the number of voices if it has been stolen
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t findVoice(Uint64 voice) const;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<Voice> m_voices;    ///< Voices of the pool
+    Uint64             m_playCount; ///< Number of sounds started so far
+};
+
+} // namespace sf
+
+
+#endif // SFML_SOUNDPOOL_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::SoundPool
+/// \ingroup audio
+///
+/// Creating a sf::Sound for every short effect (gunshots,
+/// footsteps, ...) allocates and releases audio sources all
+/// the time, and the audio device only provides a limited
+/// number of them anyway. sf::SoundPool allocates a fixed
+/// number of sounds once, and plays sound buffers on them in
+/// a fire-and-forget way: play() returns a handle that can
+/// be used to control the voice while it plays.
+///
+/// When all the voices are busy, a new sound steals the voice
+/// of the least important sound: the one with the lowest
+/// priority, then the quietest, then the oldest. A sound never
+/// steals the voice of a sound with a higher priority.
+///
+/// Unlike sf::SoundMixer, which mixes its voices in software
+/// into a single stream, the voices of a sf::SoundPool are
+/// regular audio sources: they can be spatialized individually.
+///
+/// Usage example:
+/// \code
+/// sf::SoundBuffer gunshot;
+/// gunshot.loadFromFile("gunshot.wav");
+///
+/// sf::SoundPool pool(16);
+///
+/// // Play an effect at the position of the shooter
+/// sf::Uint64 voice = pool.play(gunshot, 1);
+/// if (sf::Sound* sound = pool.getSound(voice))
+///     sound->setPosition(x, y, 0.f);
+/// \endcode
+///
+/// \see sf::Sound, sf::SoundMixer
+///
+////////////////////////////////////////////////////////////
@@ -30,14 +30,23 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Audio/Export.hpp>
 #include <SFML/Audio/SoundSource.hpp>
-#include <SFML/System/Thread.hpp>
+#include <SFML/Audio/Resampler.hpp>
 #include <SFML/System/Time.hpp>
 #include <SFML/System/Mutex.hpp>
 #include <cstdlib>
+#include <vector>
+#include <deque>
 
 
 namespace sf
 {
+namespace priv
+{
+    class StreamScheduler;
+}
+
+class OfflineRenderer;
+
 ////////////////////////////////////////////////////////////
 /// \brief Abstract base class for streamed audio sources
 ///
@@ -52,8 +61,9 @@ public:
     ////////////////////////////////////////////////////////////
     struct Chunk
     {
-        const Int16* samples;     ///< Pointer to the audio samples
-        std::size_t  sampleCount; ///< Number of samples pointed by Samples
+        const Int16* samples;      ///< Pointer to the audio samples
+        std::size_t  sampleCount;  ///< Number of samples pointed by Samples (or FloatSamples)
+        const float* floatSamples; ///< Pointer to floating point audio samples in [-1, 1], used instead of Samples if not null
     };
 
     ////////////////////////////////////////////////////////////
@@ -178,6 +188,115 @@ public:
     ////////////////////////////////////////////////////////////
     bool getLoop() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the sample rate at which the stream is played
+    ///
+    /// By default the stream is played at its own sample rate, and
+    /// the audio device converts it to its output rate. With this
+    /// function, the chunks are converted by the stream instead,
+    /// as they are produced, with the given quality.
+    /// The new value is applied the next time the stream is
+    /// started, it has no effect on a stream that is already playing.
+    ///
+    /// \param sampleRate Sample rate of the played samples (0 to play the stream at its own sample rate)
+    /// \param quality    Quality of the conversion
+    ///
+    /// \see getOutputSampleRate, getSampleRate
+    ///
+    ////////////////////////////////////////////////////////////
+    void setOutputSampleRate(unsigned int sampleRate, Resampler::Quality quality = Resampler::Sinc);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the sample rate at which the stream is played
+    ///
+    /// \return Sample rate of the played samples (0 if the stream is played at its own sample rate)
+    ///
+    /// \see setOutputSampleRate
+    ///
+    ////////////////////////////////////////////////////////////
+    unsigned int getOutputSampleRate() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the number of audio buffers used by the streaming loop
+    ///
+    /// More buffers make the stream more robust against a late
+    /// streaming thread, at the cost of memory and of a longer
+    /// delay before changes in the source data are heard.
+    /// The minimum is 2, the default is 3.
+    /// The new value is applied the next time the stream is
+    /// started, it has no effect on a stream that is already playing.
+    ///
+    /// \param count Number of audio buffers
+    ///
+    /// \see getBufferCount, setChunkDuration
+    ///
+    ////////////////////////////////////////////////////////////
+    void setBufferCount(unsigned int count);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of audio buffers used by the streaming loop
+    ///
+    /// \return Number of audio buffers
+    ///
+    /// \see setBufferCount
+    ///
+    ////////////////////////////////////////////////////////////
+    unsigned int getBufferCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the preferred duration of the chunks of audio data
+    ///
+    /// This is a hint for derived classes, which should try to
+    /// return chunks of about this duration in onGetData (this
+    /// is what sf::Music does). Together with the buffer count,
+    /// it defines how much audio is queued ahead of the playing
+    /// position, and how often the streaming thread wakes up.
+    /// The default chunk duration is 1 second.
+    ///
+    /// \param duration Preferred duration of a chunk
+    ///
+    /// \see getChunkDuration, setBufferCount
+    ///
+    ////////////////////////////////////////////////////////////
+    void setChunkDuration(Time duration);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the preferred duration of the chunks of audio data
+    ///
+    /// \return Preferred duration of a chunk
+    ///
+    /// \see setChunkDuration
+    ///
+    ////////////////////////////////////////////////////////////
+    Time getChunkDuration() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the number of threads that feed the sound streams
+    ///
+    /// All the playing streams share a small pool of threads,
+    /// which refill the most urgent streams first. A single
+    /// thread is usually enough; more threads only help when
+    /// decoding a chunk (onGetData) is slow compared to the
+    /// playing time of the queued buffers.
+    /// The default thread count is 1.
+    ///
+    /// \param count Number of streaming threads (at least 1)
+    ///
+    /// \see getStreamingThreadCount
+    ///
+    ////////////////////////////////////////////////////////////
+    static void setStreamingThreadCount(unsigned int count);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of threads that feed the sound streams
+    ///
+    /// \return Number of streaming threads
+    ///
+    /// \see setStreamingThreadCount
+    ///
+    ////////////////////////////////////////////////////////////
+    static unsigned int getStreamingThreadCount();
+
 protected:
 
     ////////////////////////////////////////////////////////////
@@ -204,17 +323,33 @@ protected:
     ////////////////////////////////////////////////////////////
     void initialize(unsigned int channelCount, unsigned int sampleRate);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether floating point chunks are played without conversion
+    ///
+    /// Chunks of floating point samples are always accepted, but
+    /// they are converted to 16 bits if the audio device doesn't
+    /// support floating point samples (AL_EXT_float32). Derived
+    /// classes can use this function to choose the type of samples
+    /// they return, once initialize() has been called.
+    ///
+    /// \return True if floating point samples are played as is
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isFloatPlaybackSupported() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Request a new chunk of audio samples from the stream source
     ///
     /// This function must be overridden by derived classes to provide
     /// the audio samples to play. It is called continuously by the
-    /// streaming loop, in a separate thread.
+    /// streaming loop, in a streaming thread.
     /// The source can choose to stop the streaming loop at any time, by
     /// returning false to the caller.
     /// If you return true (i.e. continue streaming) it is important that
     /// the returned array of samples is not empty; this would stop the stream
     /// due to an internal limitation.
+    /// The samples can be provided either as 16 bits integers (samples)
+    /// or as floating point numbers (floatSamples).
     ///
     /// \param data Chunk of data to fill
     ///
@@ -236,14 +371,40 @@ protected:
 
 private:
 
+    friend class priv::StreamScheduler;
+    friend class OfflineRenderer;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Service the stream from a streaming thread
+    ///
+    /// This function starts the stream on its first call, then
+    /// refills the buffers that have been played, and releases
+    /// the buffers when the stream ends.
+    ///
+    /// \param delay Filled with the time after which the stream needs to be serviced again
+    ///
+    /// \return True if the stream must be serviced again, false if it has ended
+    ///
+    ////////////////////////////////////////////////////////////
+    bool streamData(Time& delay);
+
     ////////////////////////////////////////////////////////////
-    /// \brief Function called as the entry point of the thread
+    /// \brief Create the buffers, fill them and start playing
     ///
-    /// This function starts the streaming loop, and returns
-    /// only when the sound is stopped.
+    ////////////////////////////////////////////////////////////
+    void startStreaming();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Refill the buffers that have been played
     ///
     ////////////////////////////////////////////////////////////
-    void streamData();
+    void updateStreaming();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Stop playing and delete the buffers
+    ///
+    ////////////////////////////////////////////////////////////
+    void stopStreaming();
 
     ////////////////////////////////////////////////////////////
     /// \brief Fill a new buffer with audio samples, and append
@@ -253,7 +414,7 @@ private:
     /// consumed; it fills it again and inserts it back into the
     /// playing queue.
     ///
-    /// \param bufferNum Number of the buffer to fill (in [0, BufferCount])
+    /// \param bufferNum Number of the buffer to fill (in [0, buffer count[)
     ///
     /// \return True if the stream source has requested to stop, false otherwise
     ///
@@ -279,25 +440,47 @@ private:
     ////////////////////////////////////////////////////////////
     void clearQueue();
 
-    enum
-    {
-        BufferCount = 3 ///< Number of audio buffers used by the streaming loop
-    };
+    ////////////////////////////////////////////////////////////
+    /// \brief Compute how long the streaming thread can sleep
+    ///
+    /// The result is the remaining playing time of the buffer at
+    /// the head of the queue, i.e. the time until a buffer can
+    /// be refilled.
+    ///
+    /// \return Time until the next buffer is processed
+    ///
+    ////////////////////////////////////////////////////////////
+    Time getRefillDelay() const;
 
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    Thread        m_thread;                  ///< Thread running the background tasks
-    mutable Mutex m_threadMutex;             ///< Thread mutex
-    Status        m_threadStartState;        ///< State the thread starts in (Playing, Paused, Stopped)
-    bool          m_isStreaming;             ///< Streaming state (true = playing, false = stopped)
-    unsigned int  m_buffers[BufferCount];    ///< Sound buffers used to store temporary audio data
-    unsigned int  m_channelCount;            ///< Number of channels (1 = mono, 2 = stereo, ...)
-    unsigned int  m_sampleRate;              ///< Frequency (samples / second)
-    Uint32        m_format;                  ///< Format of the internal sound buffers
-    bool          m_loop;                    ///< Loop flag (true to loop, false to play once)
-    Uint64        m_samplesProcessed;        ///< Number of buffers processed since beginning of the stream
-    bool          m_endBuffers[BufferCount]; ///< Each buffer is marked as "end buffer" or not, for proper duration calculation
+    Mutex                     m_streamMutex;      ///< Held while a streaming thread services the stream
+    mutable Mutex             m_threadMutex;      ///< Thread mutex
+    Status                    m_threadStartState; ///< State the thread starts in (Playing, Paused, Stopped)
+    bool                      m_isStreaming;      ///< Streaming state (true = playing, false = stopped)
+    unsigned int              m_bufferCount;      ///< Number of buffers to use the next time streaming starts
+    Time                      m_chunkDuration;    ///< Preferred duration of the chunks returned by onGetData
+    std::vector<unsigned int> m_buffers;          ///< Sound buffers used to store temporary audio data
+    std::vector<std::size_t>  m_bufferSamples;    ///< Number of samples stored in each buffer
+    std::vector<std::size_t>  m_bufferSources;    ///< Number of samples of the stream consumed to fill each buffer
+    std::deque<unsigned int>  m_queue;            ///< Numbers of the buffers currently queued, in playing order
+    unsigned int              m_channelCount;     ///< Number of channels (1 = mono, 2 = stereo, ...)
+    unsigned int              m_sampleRate;       ///< Frequency (samples / second)
+    Uint32                    m_format;           ///< Format of the internal sound buffers
+    Uint32                    m_floatFormat;      ///< Format of the internal sound buffers for floating point chunks (0 if not supported)
+    std::vector<Int16>        m_convertedSamples; ///< Floating point chunks converted to 16 bits, if the format is not supported
+    unsigned int              m_outputRate;       ///< Sample rate to play the stream at the next time it starts (0 = own rate)
+    Resampler::Quality        m_outputQuality;    ///< Quality of the conversion to the output sample rate
+    unsigned int              m_streamRate;       ///< Sample rate of the buffers currently queued
+    Resampler                 m_resampler;        ///< Converts the chunks to the output sample rate
+    std::vector<float>        m_resamplerInput;   ///< 16 bits chunks converted to floating point for the resampler
+    std::vector<float>        m_resampledSamples; ///< Chunks converted to the output sample rate
+    std::size_t               m_pendingSources;   ///< Samples consumed by the resampler and not played in a buffer yet
+    bool                      m_loop;             ///< Loop flag (true to loop, false to play once)
+    Uint64                    m_samplesProcessed; ///< Number of buffers processed since beginning of the stream
+    std::vector<bool>         m_endBuffers;       ///< Each buffer is marked as "end buffer" or not, for proper duration calculation
+    bool                      m_requestStop;      ///< Has the stream source requested to stop?
 };
 
 } // namespace sf
@@ -331,13 +514,19 @@ private:
 /// \li onGetData fills a new chunk of audio data to be played
 /// \li onSeek changes the current playing position in the source
 ///
-/// It is important to note that each SoundStream is played in its
-/// own separate thread, so that the streaming loop doesn't block the
-/// rest of the program. In particular, the OnGetData and OnSeek
-/// virtual functions may sometimes be called from this separate thread.
+/// It is important to note that sound streams are fed by streaming
+/// threads shared by all the streams (see setStreamingThreadCount),
+/// so that the streaming loop doesn't block the rest of the program.
+/// In particular, the OnGetData and OnSeek virtual functions may
+/// sometimes be called from a streaming thread.
 /// It is important to keep this in mind, because you may have to take
 /// care of synchronization issues if you share data between threads.
 ///
+/// The streaming threads don't poll the audio device: a stream is
+/// serviced when its oldest queued buffer has been played.
+/// The latency and the robustness against underruns can be tuned
+/// with setBufferCount and setChunkDuration.
+///
 /// Usage example:
 /// \code
 /// class CustomStream : public sf::SoundStream
@@ -111,8 +111,9 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    float       m_radius;     ///< Radius of the circle
-    std::size_t m_pointCount; ///< Number of points composing the circle
+    float           m_radius;     ///< Radius of the circle
+    std::size_t     m_pointCount; ///< Number of points composing the circle
+    const Vector2f* m_unitPoints; ///< Points of the unit circle, shared by all the circles with the same point count
 };
 
 } // namespace sf
@@ -149,6 +150,10 @@ private:
 /// small numbers you can create any regular polygon shape:
 /// equilateral triangle, square, pentagon, hexagon, ...
 ///
+/// The points of the circle are computed only once for each
+/// number of points, and shared by all the circles that use it,
+/// so that creating many circles is cheap.
+///
 /// \see sf::Shape, sf::RectangleShape, sf::ConvexShape
 ///
 ////////////////////////////////////////////////////////////
@@ -0,0 +1,145 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+#ifndef SFML_COMPACTVERTEX_HPP
+#define SFML_COMPACTVERTEX_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/System/Vector2.hpp>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Point with color and texture coordinates stored in 12 bytes
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API CompactVertex
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    CompactVertex();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the vertex from its position
+    ///
+    /// The vertex color is white and texture coordinates are (0, 0).
+    ///
+    /// \param thePosition Vertex position
+    ///
+    ////////////////////////////////////////////////////////////
+    CompactVertex(const Vector2<Int16>& thePosition);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the vertex from its position and color
+    ///
+    /// The texture coordinates are (0, 0).
+    ///
+    /// \param thePosition Vertex position
+    /// \param theColor    Vertex color
+    ///
+    ////////////////////////////////////////////////////////////
+    CompactVertex(const Vector2<Int16>& thePosition, const Color& theColor);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the vertex from its position and texture coordinates
+    ///
+    /// The vertex color is white.
+    ///
+    /// \param thePosition  Vertex position
+    /// \param theTexCoords Vertex texture coordinates
+    ///
+    ////////////////////////////////////////////////////////////
+    CompactVertex(const Vector2<Int16>& thePosition, const Vector2<Int16>& theTexCoords);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the vertex from its position, color and texture coordinates
+    ///
+    /// \param thePosition  Vertex position
+    /// \param theColor     Vertex color
+    /// \param theTexCoords Vertex texture coordinates
+    ///
+    ////////////////////////////////////////////////////////////
+    CompactVertex(const Vector2<Int16>& thePosition, const Color& theColor, const Vector2<Int16>& theTexCoords);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Vector2<Int16> position;  ///< 2D position of the vertex, relative to the origin of its chunk
+    Color          color;     ///< Color of the vertex
+    Vector2<Int16> texCoords; ///< Coordinates of the texture's pixel to map to the vertex
+};
+
+} // namespace sf
+
+
+#endif // SFML_COMPACTVERTEX_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::CompactVertex
+/// \ingroup graphics
+///
+/// sf::CompactVertex is a smaller alternative to sf::Vertex:
+/// its position and texture coordinates are 16-bit integers
+/// instead of floats, so that it takes 12 bytes instead of
+/// 20. Large static geometry, such as the tiles of a world,
+/// uses 40% less memory and needs 40% less bandwidth to be
+/// sent to the graphics card.
+///
+/// Positions are limited to [-32768, 32767]: large worlds
+/// must be split in chunks, whose vertices are positioned
+/// relative to the chunk origin, and drawn with a transform
+/// which translates them to the chunk position. Texture
+/// coordinates are an integer amount of pixels, as usual,
+/// in the same range.
+///
+/// Compact vertices are drawn with the overloads of
+/// sf::RenderTarget::draw that take them, with or without
+/// indices.
+///
+/// Example:
+/// \code
+/// // a chunk of the world is a 64x64 grid of 16x16 tiles
+/// std::vector<sf::CompactVertex> chunk;
+/// ...
+/// chunk.push_back(sf::CompactVertex(sf::Vector2<sf::Int16>(x * 16, y * 16), sf::Vector2<sf::Int16>(u, v)));
+/// ...
+///
+/// // draw it at its position in the world
+/// sf::RenderStates states(&tileset);
+/// states.transform.translate(chunkX * 1024.f, chunkY * 1024.f);
+/// window.draw(&chunk[0], chunk.size(), sf::Quads, states);
+/// \endcode
+///
+/// \see sf::Vertex
+///
+////////////////////////////////////////////////////////////
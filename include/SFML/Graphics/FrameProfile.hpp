@@ -0,0 +1,133 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+#ifndef SFML_FRAMEPROFILE_HPP
+#define SFML_FRAMEPROFILE_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+#include <SFML/System/Time.hpp>
+#include <string>
+#include <vector>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Structure describing the rendering of a frame
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API FrameProfile
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Counters of the rendering work
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Counters
+    {
+        ////////////////////////////////////////////////////////////
+        /// \brief Default constructor
+        ///
+        ////////////////////////////////////////////////////////////
+        Counters() : drawCalls(0), vertices(0), textureBinds(0), shaderBinds(0), blendChanges(0) {}
+
+        Uint64 drawCalls;    ///< Number of draw calls sent to OpenGL
+        Uint64 vertices;     ///< Number of vertices drawn
+        Uint64 textureBinds; ///< Number of texture changes
+        Uint64 shaderBinds;  ///< Number of shaders bound to draw
+        Uint64 blendChanges; ///< Number of blend mode changes
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Named scope of a frame
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Scope
+    {
+        ////////////////////////////////////////////////////////////
+        /// \brief Default constructor
+        ///
+        ////////////////////////////////////////////////////////////
+        Scope() : depth(0) {}
+
+        std::string  name;     ///< Name given to the scope
+        unsigned int depth;    ///< Number of enclosing scopes
+        Time         cpuStart; ///< Start of the scope on the CPU, relative to the start of the frame
+        Time         cpuTime;  ///< Time spent in the scope on the CPU
+        Time         gpuStart; ///< Start of the scope on the GPU, relative to the start of the frame on the GPU
+        Time         gpuTime;  ///< Time spent in the scope on the GPU
+        Counters     counters; ///< Rendering work done in the scope
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    FrameProfile() : frame(0), gpuTimesAvailable(false) {}
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Uint64             frame;             ///< Index of the frame, starting at 0 when profiling is enabled
+    Time               cpuStart;          ///< Start of the frame on the CPU, relative to when profiling was enabled
+    Time               cpuTime;           ///< Duration of the frame on the CPU
+    Time               gpuTime;           ///< Duration of the frame on the GPU
+    bool               gpuTimesAvailable; ///< Were the GPU times measured?
+    Counters           counters;          ///< Rendering work done in the frame
+    std::vector<Scope> scopes;            ///< Scopes of the frame, in the order they were started
+};
+
+} // namespace sf
+
+
+#endif // SFML_FRAMEPROFILE_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::FrameProfile
+/// \ingroup graphics
+///
+/// sf::FrameProfile holds the measures collected by a render
+/// target during a frame, when profiling is enabled (see
+/// sf::RenderTarget::setProfilingEnabled):
+/// \li the time spent on the CPU and on the GPU, for the whole
+///     frame and for each named scope
+/// \li counters of the rendering work: draw calls, vertices and
+///     state changes
+///
+/// Scopes are listed in the order they were started; nested
+/// scopes follow their parent and have a greater depth.
+///
+/// GPU times are measured with timer queries, which are read
+/// back one or two frames later so that the CPU never waits
+/// for the GPU. They are not available if the graphics driver
+/// doesn't support timer queries (ARB_timer_query), in which
+/// case \a gpuTimesAvailable is false and the GPU times are 0.
+///
+/// \see sf::RenderTarget::getFrameProfile
+///
+////////////////////////////////////////////////////////////
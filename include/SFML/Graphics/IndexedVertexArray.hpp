@@ -0,0 +1,299 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+#ifndef SFML_INDEXEDVERTEXARRAY_HPP
+#define SFML_INDEXEDVERTEXARRAY_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/PrimitiveType.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Drawable.hpp>
+#include <vector>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Define a set of one or more 2D primitives from indexed vertices
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API IndexedVertexArray : public Drawable
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty vertex array.
+    ///
+    ////////////////////////////////////////////////////////////
+    IndexedVertexArray();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the vertex array with a type and an initial number of vertices
+    ///
+    /// \param type        Type of primitives
+    /// \param vertexCount Initial number of vertices in the array
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit IndexedVertexArray(PrimitiveType type, std::size_t vertexCount = 0);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the vertex count
+    ///
+    /// \return Number of vertices in the array
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getVertexCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a read-write access to a vertex by its index
+    ///
+    /// This function doesn't check \a index, it must be in range
+    /// [0, getVertexCount() - 1]. The behavior is undefined
+    /// otherwise.
+    ///
+    /// \param index Index of the vertex to get
+    ///
+    /// \return Reference to the index-th vertex
+    ///
+    /// \see getVertexCount
+    ///
+    ////////////////////////////////////////////////////////////
+    Vertex& operator [](std::size_t index);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a read-only access to a vertex by its index
+    ///
+    /// This function doesn't check \a index, it must be in range
+    /// [0, getVertexCount() - 1]. The behavior is undefined
+    /// otherwise.
+    ///
+    /// \param index Index of the vertex to get
+    ///
+    /// \return Const reference to the index-th vertex
+    ///
+    /// \see getVertexCount
+    ///
+    ////////////////////////////////////////////////////////////
+    const Vertex& operator [](std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Resize the array of vertices
+    ///
+    /// If \a vertexCount is greater than the current size, the previous
+    /// vertices are kept and new (default-constructed) vertices are
+    /// added.
+    /// If \a vertexCount is less than the current size, existing vertices
+    /// are removed from the array; the indices referencing them must
+    /// be updated.
+    ///
+    /// \param vertexCount New number of vertices
+    ///
+    ////////////////////////////////////////////////////////////
+    void resize(std::size_t vertexCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a vertex to the array
+    ///
+    /// The vertex is not drawn until an index references it.
+    ///
+    /// \param vertex Vertex to add
+    ///
+    /// \return Index of the new vertex, to use with appendIndex
+    ///
+    ////////////////////////////////////////////////////////////
+    Uint32 append(const Vertex& vertex);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the index count
+    ///
+    /// \return Number of indices in the array
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getIndexCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a read-write access to an index
+    ///
+    /// This function doesn't check \a position, it must be in
+    /// range [0, getIndexCount() - 1]. The behavior is undefined
+    /// otherwise.
+    ///
+    /// \param position Position of the index in the array of indices
+    ///
+    /// \return Reference to the index
+    ///
+    /// \see getIndexCount
+    ///
+    ////////////////////////////////////////////////////////////
+    Uint32& getIndex(std::size_t position);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a read-only access to an index
+    ///
+    /// This function doesn't check \a position, it must be in
+    /// range [0, getIndexCount() - 1]. The behavior is undefined
+    /// otherwise.
+    ///
+    /// \param position Position of the index in the array of indices
+    ///
+    /// \return The index
+    ///
+    /// \see getIndexCount
+    ///
+    ////////////////////////////////////////////////////////////
+    Uint32 getIndex(std::size_t position) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Resize the array of indices
+    ///
+    /// New indices are initialized to 0.
+    ///
+    /// \param indexCount New number of indices
+    ///
+    ////////////////////////////////////////////////////////////
+    void resizeIndices(std::size_t indexCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add an index to the array
+    ///
+    /// \param index Index of the vertex to draw, in range [0, getVertexCount() - 1]
+    ///
+    ////////////////////////////////////////////////////////////
+    void appendIndex(Uint32 index);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Clear the vertex array
+    ///
+    /// This function removes all the vertices and indices
+    /// from the array. It doesn't deallocate the corresponding
+    /// memory, so that adding new vertices after clearing
+    /// doesn't involve reallocating all the memory.
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the type of primitives to draw
+    ///
+    /// This function defines how the indexed vertices must be
+    /// interpreted when it's time to draw them:
+    /// \li As points
+    /// \li As lines
+    /// \li As triangles
+    /// \li As quads
+    /// The default primitive type is sf::Points.
+    ///
+    /// \param type Type of primitive
+    ///
+    ////////////////////////////////////////////////////////////
+    void setPrimitiveType(PrimitiveType type);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the type of primitives drawn by the vertex array
+    ///
+    /// \return Primitive type
+    ///
+    ////////////////////////////////////////////////////////////
+    PrimitiveType getPrimitiveType() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Compute the bounding rectangle of the vertex array
+    ///
+    /// This function returns the minimal axis-aligned rectangle
+    /// that contains all the vertices of the array, whether they
+    /// are referenced by an index or not.
+    ///
+    /// \return Bounding rectangle of the vertex array
+    ///
+    ////////////////////////////////////////////////////////////
+    FloatRect getBounds() const;
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the vertex array to a render target
+    ///
+    /// \param target Render target to draw to
+    /// \param states Current render states
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void draw(RenderTarget& target, RenderStates states) const;
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<Vertex> m_vertices;      ///< Vertices contained in the array
+    std::vector<Uint32> m_indices;       ///< Indices of the vertices to draw
+    PrimitiveType       m_primitiveType; ///< Type of primitives to draw
+};
+
+} // namespace sf
+
+
+#endif // SFML_INDEXEDVERTEXARRAY_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::IndexedVertexArray
+/// \ingroup graphics
+///
+/// sf::IndexedVertexArray is a variant of sf::VertexArray
+/// where the primitives are built from a second array of
+/// indices into the vertices. Vertices shared by several
+/// primitives are stored once, which reduces the amount of
+/// data sent to the graphics card: a quad drawn as two
+/// triangles needs 4 vertices instead of 6, and meshes
+/// typically need 2 to 3 times less vertices.
+///
+/// Like sf::VertexArray, it inherits sf::Drawable but is
+/// not transformable.
+///
+/// Example:
+/// \code
+/// sf::IndexedVertexArray quad(sf::Triangles);
+/// sf::Uint32 topLeft     = quad.append(sf::Vertex(sf::Vector2f(0, 0)));
+/// sf::Uint32 topRight    = quad.append(sf::Vertex(sf::Vector2f(10, 0)));
+/// sf::Uint32 bottomRight = quad.append(sf::Vertex(sf::Vector2f(10, 10)));
+/// sf::Uint32 bottomLeft  = quad.append(sf::Vertex(sf::Vector2f(0, 10)));
+///
+/// quad.appendIndex(topLeft);
+/// quad.appendIndex(topRight);
+/// quad.appendIndex(bottomLeft);
+/// quad.appendIndex(bottomLeft);
+/// quad.appendIndex(topRight);
+/// quad.appendIndex(bottomRight);
+///
+/// window.draw(quad);
+/// \endcode
+///
+/// \see sf::VertexArray, sf::Vertex
+///
+////////////////////////////////////////////////////////////
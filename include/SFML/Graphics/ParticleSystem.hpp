@@ -0,0 +1,325 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_PARTICLESYSTEM_HPP
+#define SFML_PARTICLESYSTEM_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/Transformable.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/System/Time.hpp>
+#include <vector>
+
+
+namespace sf
+{
+class Texture;
+
+////////////////////////////////////////////////////////////
+/// \brief Set of simple particles updated and drawn in bulk
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API ParticleSystem : public Drawable, public Transformable
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the particle system
+    ///
+    /// All the storage is allocated once, here; emitting and
+    /// killing particles never allocates memory.
+    ///
+    /// \param capacity Maximum number of particles alive at the same time
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit ParticleSystem(std::size_t capacity);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy constructor
+    ///
+    /// The worker threads are not shared: the copy creates its
+    /// own the first time it needs them.
+    ///
+    /// \param copy Instance to copy
+    ///
+    ////////////////////////////////////////////////////////////
+    ParticleSystem(const ParticleSystem& copy);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~ParticleSystem();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Overload of assignment operator
+    ///
+    /// \param right Instance to assign
+    ///
+    /// \return Reference to self
+    ///
+    ////////////////////////////////////////////////////////////
+    ParticleSystem& operator =(const ParticleSystem& right);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Emit a new particle
+    ///
+    /// If the system is full, the particle is discarded.
+    ///
+    /// \param position Initial position of the particle, in local coordinates
+    /// \param velocity Initial velocity of the particle, in units per second
+    /// \param lifetime Time before the particle dies
+    /// \param color    Color of the particle
+    ///
+    /// \return True if the particle was emitted, false if the system is full
+    ///
+    ////////////////////////////////////////////////////////////
+    bool emit(const Vector2f& position, const Vector2f& velocity, Time lifetime, const Color& color = Color::White);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update all the particles
+    ///
+    /// This function moves the particles, makes them older, and
+    /// removes those whose lifetime has expired.
+    ///
+    /// \param elapsed Time elapsed since the last update
+    ///
+    ////////////////////////////////////////////////////////////
+    void update(Time elapsed);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Kill all the particles
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of particles currently alive
+    ///
+    /// \return Number of particles
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getParticleCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the maximum number of particles
+    ///
+    /// \return Capacity of the system
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getCapacity() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the acceleration applied to all the particles
+    ///
+    /// This is typically used for gravity or wind. The
+    /// default acceleration is (0, 0).
+    ///
+    /// \param acceleration Acceleration, in units per second squared
+    ///
+    /// \see getAcceleration
+    ///
+    ////////////////////////////////////////////////////////////
+    void setAcceleration(const Vector2f& acceleration);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the acceleration applied to all the particles
+    ///
+    /// \return Acceleration, in units per second squared
+    ///
+    /// \see setAcceleration
+    ///
+    ////////////////////////////////////////////////////////////
+    const Vector2f& getAcceleration() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the size of the particles
+    ///
+    /// If the size is (0, 0), which is the default, particles
+    /// are drawn as points. Otherwise they are drawn as quads
+    /// of the given size, centered on their position, and
+    /// textured with the whole texture if there's one.
+    ///
+    /// \param size New size of the particles, in local units
+    ///
+    /// \see getParticleSize
+    ///
+    ////////////////////////////////////////////////////////////
+    void setParticleSize(const Vector2f& size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the particles
+    ///
+    /// \return Size of the particles, in local units
+    ///
+    /// \see setParticleSize
+    ///
+    ////////////////////////////////////////////////////////////
+    const Vector2f& getParticleSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the texture of the particles
+    ///
+    /// The texture is only used when particles are drawn as
+    /// quads (see setParticleSize). It must exist as long as
+    /// the particle system uses it.
+    ///
+    /// \param texture New texture
+    ///
+    /// \see getTexture
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTexture(const Texture& texture);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the texture of the particles
+    ///
+    /// \return Pointer to the texture, or NULL if there's none
+    ///
+    /// \see setTexture
+    ///
+    ////////////////////////////////////////////////////////////
+    const Texture* getTexture() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the number of threads used to update the particles
+    ///
+    /// When more than one thread is used, the particles are split
+    /// into ranges that are updated in parallel. Small systems
+    /// are always updated in the calling thread. The default
+    /// thread count is 1.
+    /// The worker threads are created the first time they are
+    /// needed, and then sleep between two updates.
+    ///
+    /// \param count Number of threads (including the calling thread)
+    ///
+    ////////////////////////////////////////////////////////////
+    void setThreadCount(unsigned int count);
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Thread updating a range of particles on demand
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Worker;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Terminate and destroy the worker threads
+    ///
+    ////////////////////////////////////////////////////////////
+    void destroyWorkers();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the particles to a render target
+    ///
+    /// \param target Render target to draw to
+    /// \param states Current render states
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void draw(RenderTarget& target, RenderStates states) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Rewrite the vertices of all the particles
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateVertices();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove the dead particles
+    ///
+    ////////////////////////////////////////////////////////////
+    void removeDeadParticles();
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::size_t          m_capacity;     ///< Maximum number of particles
+    std::size_t          m_count;        ///< Number of particles alive
+    std::vector<float>   m_positionsX;   ///< X coordinates of the particles
+    std::vector<float>   m_positionsY;   ///< Y coordinates of the particles
+    std::vector<float>   m_velocitiesX;  ///< X velocities of the particles
+    std::vector<float>   m_velocitiesY;  ///< Y velocities of the particles
+    std::vector<float>   m_lifetimes;    ///< Remaining lifetimes of the particles, in seconds
+    std::vector<Color>   m_colors;       ///< Colors of the particles
+    std::vector<Vertex>  m_vertices;     ///< Geometry of the particles
+    Vector2f             m_acceleration; ///< Acceleration applied to all the particles
+    Vector2f             m_particleSize; ///< Size of the particles
+    const Texture*       m_texture;      ///< Texture of the particles
+    unsigned int         m_threadCount;  ///< Number of threads used by update
+    std::vector<Worker*> m_workers;      ///< Worker threads, created on first use
+};
+
+} // namespace sf
+
+
+#endif // SFML_PARTICLESYSTEM_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::ParticleSystem
+/// \ingroup graphics
+///
+/// sf::ParticleSystem manages a large number of simple particles,
+/// each one having a position, a velocity, a lifetime and a color.
+///
+/// It inherits all the functions from sf::Transformable:
+/// position, rotation, scale, origin, which are applied to
+/// the whole system when it is drawn.
+///
+/// The particles are stored as a structure of arrays, which
+/// allows update to process several of them at once with SIMD
+/// instructions (SSE or NEON, when available), and optionally to
+/// split the work across several threads. The geometry is
+/// written directly by the update, so that drawing doesn't
+/// need any additional pass. Dead particles are removed by
+/// swapping them with the last one, so the order of the
+/// particles is not preserved.
+///
+/// Usage example:
+/// \code
+/// sf::ParticleSystem particles(100000);
+/// particles.setAcceleration(sf::Vector2f(0, 100));
+/// particles.setThreadCount(4);
+///
+/// while (window.isOpen())
+/// {
+///     // Emit a few particles per frame
+///     for (int i = 0; i < 100; ++i)
+///         particles.emit(sf::Vector2f(400, 300), sf::Vector2f(std::rand() % 200 - 100, -200), sf::seconds(3));
+///
+///     particles.update(clock.restart());
+///
+///     window.clear();
+///     window.draw(particles);
+///     window.display();
+/// }
+/// \endcode
+///
+////////////////////////////////////////////////////////////
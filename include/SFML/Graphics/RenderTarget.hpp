@@ -37,11 +37,21 @@
 #include <SFML/Graphics/RenderStates.hpp>
 #include <SFML/Graphics/PrimitiveType.hpp>
 #include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/CompactVertex.hpp>
+#include <SFML/Graphics/FrameProfile.hpp>
 #include <SFML/System/NonCopyable.hpp>
+#include <string>
+#include <vector>
 
 
 namespace sf
 {
+namespace priv
+{
+    class CoreRenderer;
+    class FrameProfiler;
+}
+
 class Drawable;
 
 ////////////////////////////////////////////////////////////
@@ -247,6 +257,95 @@ public:
     void draw(const Vertex* vertices, std::size_t vertexCount,
               PrimitiveType type, const RenderStates& states = RenderStates::Default);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives defined by an array of indexed vertices
+    ///
+    /// The primitives are built from the vertices referenced by
+    /// \a indices, in order: vertices shared by several primitives
+    /// (like the corners of adjacent quads, or of the two triangles
+    /// making a quad) only have to be stored once.
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param indices     Pointer to the indices of the vertices to draw
+    /// \param indexCount  Number of indices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const Vertex* vertices, std::size_t vertexCount,
+              const Uint16* indices, std::size_t indexCount,
+              PrimitiveType type, const RenderStates& states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives defined by an array of indexed vertices
+    ///
+    /// This overload accepts 32-bit indices, for arrays of
+    /// more than 65536 vertices.
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param indices     Pointer to the indices of the vertices to draw
+    /// \param indexCount  Number of indices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const Vertex* vertices, std::size_t vertexCount,
+              const Uint32* indices, std::size_t indexCount,
+              PrimitiveType type, const RenderStates& states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives defined by an array of compact vertices
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    ///
+    /// \see sf::CompactVertex
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const CompactVertex* vertices, std::size_t vertexCount,
+              PrimitiveType type, const RenderStates& states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives defined by an array of indexed compact vertices
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param indices     Pointer to the indices of the vertices to draw
+    /// \param indexCount  Number of indices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    ///
+    /// \see sf::CompactVertex
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const CompactVertex* vertices, std::size_t vertexCount,
+              const Uint16* indices, std::size_t indexCount,
+              PrimitiveType type, const RenderStates& states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives defined by an array of indexed compact vertices
+    ///
+    /// This overload accepts 32-bit indices, for arrays of
+    /// more than 65536 vertices.
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param indices     Pointer to the indices of the vertices to draw
+    /// \param indexCount  Number of indices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    ///
+    /// \see sf::CompactVertex
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const CompactVertex* vertices, std::size_t vertexCount,
+              const Uint32* indices, std::size_t indexCount,
+              PrimitiveType type, const RenderStates& states = RenderStates::Default);
+
     ////////////////////////////////////////////////////////////
     /// \brief Return the size of the rendering region of the target
     ///
@@ -284,6 +383,10 @@ public:
     /// saved and restored). Take a look at the resetGLStates
     /// function if you do so.
     ///
+    /// In core profile contexts, OpenGL has no state stack:
+    /// nothing is saved, and this function only resets the
+    /// states like resetGLStates does.
+    ///
     /// \see popGLStates
     ///
     ////////////////////////////////////////////////////////////
@@ -323,6 +426,98 @@ public:
     ////////////////////////////////////////////////////////////
     void resetGLStates();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable frame profiling
+    ///
+    /// When profiling is enabled, the target measures the time
+    /// spent by the CPU and the GPU in each frame and in named
+    /// scopes, and counts the draw calls, vertices and state
+    /// changes (see sf::FrameProfile).
+    ///
+    /// Profiling is disabled by default. Disabling it discards
+    /// the measures and closes the trace file, if any.
+    ///
+    /// \param enabled True to enable profiling, false to disable it
+    ///
+    /// \see isProfilingEnabled, getFrameProfile
+    ///
+    ////////////////////////////////////////////////////////////
+    void setProfilingEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether frame profiling is enabled or not
+    ///
+    /// \return True if profiling is enabled
+    ///
+    /// \see setProfilingEnabled
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isProfilingEnabled() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start a named profile scope
+    ///
+    /// The scope lasts until the matching call to endProfileScope.
+    /// Scopes can be nested. This function does nothing if
+    /// profiling is disabled.
+    ///
+    /// \param name Name of the scope
+    ///
+    /// \see endProfileScope
+    ///
+    ////////////////////////////////////////////////////////////
+    void beginProfileScope(const std::string& name);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief End the last started profile scope
+    ///
+    /// \see beginProfileScope
+    ///
+    ////////////////////////////////////////////////////////////
+    void endProfileScope();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief End the current profiled frame and start the next one
+    ///
+    /// This function should be called once per frame, usually
+    /// right before the target is displayed. Scopes still
+    /// open are ended. This function does nothing if profiling
+    /// is disabled.
+    ///
+    /// \see getFrameProfile
+    ///
+    ////////////////////////////////////////////////////////////
+    void endProfileFrame();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the profile of the last completed frame
+    ///
+    /// GPU times are read back without stalling, so the last
+    /// completed frame is usually one or two frames behind the
+    /// last ended frame.
+    ///
+    /// \return Profile of the last completed frame, or an empty
+    ///         profile if profiling is disabled
+    ///
+    /// \see endProfileFrame
+    ///
+    ////////////////////////////////////////////////////////////
+    const FrameProfile& getFrameProfile() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write the profiles of the completed frames to a trace file
+    ///
+    /// The trace is written in the Chrome trace event format,
+    /// which can be opened in chrome://tracing. Profiling must
+    /// be enabled.
+    ///
+    /// \param filename Path of the trace file, or an empty string to close the current one
+    ///
+    /// \return True if the file was opened
+    ///
+    ////////////////////////////////////////////////////////////
+    bool setProfileTraceFile(const std::string& filename);
+
 protected:
 
     ////////////////////////////////////////////////////////////
@@ -340,8 +535,39 @@ protected:
     ////////////////////////////////////////////////////////////
     void initialize();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Record the activation state of the target
+    ///
+    /// The derived classes must call this function after they
+    /// successfully activated or deactivated their target. It
+    /// keeps track of the target that is active in each context,
+    /// so that drawing to an already active target doesn't need
+    /// to activate it again, and so that the render states are
+    /// set again when several targets share the same context.
+    ///
+    /// \param active True if the target was activated, false if it was deactivated
+    ///
+    ////////////////////////////////////////////////////////////
+    void markActive(bool active);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Check whether the target is active in the current context
+    ///
+    /// \return True if the target is active
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isActive() const;
+
 private:
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Activate the target, unless it is already active
+    ///
+    /// \return True if the target is active
+    ///
+    ////////////////////////////////////////////////////////////
+    bool ensureActive();
+
     ////////////////////////////////////////////////////////////
     /// \brief Apply the current view
     ///
@@ -380,6 +606,43 @@ private:
     ////////////////////////////////////////////////////////////
     void applyShader(const Shader* shader);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Apply the render states before drawing
+    ///
+    /// \param useVertexCache Are the vertices pre-transformed in the vertex cache?
+    /// \param states         Render states to apply
+    ///
+    ////////////////////////////////////////////////////////////
+    void setupDraw(bool useVertexCache, const RenderStates& states);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Restore the default render states after drawing
+    ///
+    /// \param states Render states used for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void cleanupDraw(const RenderStates& states);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives without the vertex cache
+    ///
+    /// This function draws indexed vertices and vertices of any
+    /// layout, which are never pre-transformed.
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param indices     Pointer to the indices
+    /// \param indexCount  Number of indices in the array
+    /// \param indexSize   Size of an index: sizeof(Uint16), sizeof(Uint32), or 0 to draw without indices
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename T>
+    void drawUncached(const T* vertices, std::size_t vertexCount,
+                      const void* indices, std::size_t indexCount, std::size_t indexSize,
+                      PrimitiveType type, const RenderStates& states);
+
     ////////////////////////////////////////////////////////////
     /// \brief Activate the target for rendering
     ///
@@ -402,20 +665,26 @@ private:
     {
         enum {VertexCacheSize = 4};
 
-        bool      glStatesSet;    ///< Are our internal GL states set yet?
-        bool      viewChanged;    ///< Has the current view changed since last draw?
-        BlendMode lastBlendMode;  ///< Cached blending mode
-        Uint64    lastTextureId;  ///< Cached texture
-        bool      useVertexCache; ///< Did we previously use the vertex cache?
-        Vertex    vertexCache[VertexCacheSize]; ///< Pre-transformed vertices cache
+        bool                glStatesSet;    ///< Are our internal GL states set yet?
+        bool                viewChanged;    ///< Has the current view changed since last draw?
+        BlendMode           lastBlendMode;  ///< Cached blending mode
+        Uint64              lastTextureId;  ///< Cached texture
+        bool                useVertexCache; ///< Did we previously use the vertex cache?
+        Vertex              vertexCache[VertexCacheSize]; ///< Pre-transformed vertices cache
+        Uint64              contextId;      ///< Context in which the cached states were set
+        priv::CoreRenderer* coreRenderer;   ///< Renderer of the context if it is a core profile context, NULL otherwise
+        std::vector<Uint16> shortIndices;   ///< 32-bit indices converted for OpenGL ES, kept to avoid reallocations
+        std::vector<char>   flatVertices;   ///< Indexed vertices expanded for OpenGL ES when 16-bit indices are too small
     };
 
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    View        m_defaultView; ///< Default view
-    View        m_view;        ///< Current view
-    StatesCache m_cache;       ///< Render states cache
+    View                 m_defaultView; ///< Default view
+    View                 m_view;        ///< Current view
+    StatesCache          m_cache;       ///< Render states cache
+    Uint64               m_id;          ///< Unique identifier, to track the target active in each context
+    priv::FrameProfiler* m_profiler;    ///< Frame profiler, NULL if profiling is disabled
 };
 
 } // namespace sf
@@ -446,6 +715,47 @@ private:
 /// OpenGL states are not messed up by calling the
 /// pushGLStates/popGLStates functions.
 ///
+/// Render targets can also be used with core profile contexts
+/// (see sf::ContextSettings::Core). In that case SFML draws
+/// with a built-in shader, streaming the vertices to a vertex
+/// buffer. sf::Shader is built on the ARB_shader_objects
+/// extension, which many drivers don't expose in core profile
+/// contexts: shaders can be passed in the render states only
+/// if sf::Shader::isAvailable() returns true while the core
+/// context is active. They must then be written in a GLSL
+/// version supported by the core profile, and receive SFML's
+/// data through the following variables:
+/// \li <tt>in vec2 sf_position</tt>, <tt>in vec4 sf_color</tt>
+///     and <tt>in vec2 sf_texCoords</tt>: vertex attributes
+/// \li <tt>uniform mat4 sf_viewProjection</tt>, <tt>sf_model</tt>
+///     and <tt>sf_textureMatrix</tt>: transforms to apply to
+///     the position and the texture coordinates
+///
+/// Finally, render targets can profile their frames, to find
+/// out where the CPU and GPU time goes:
+/// \code
+/// window.setProfilingEnabled(true);
+///
+/// while (window.isOpen())
+/// {
+///     window.clear();
+///
+///     window.beginProfileScope("world");
+///     window.draw(world);
+///     window.endProfileScope();
+///
+///     window.beginProfileScope("interface");
+///     window.draw(interface);
+///     window.endProfileScope();
+///
+///     window.endProfileFrame();
+///     window.display();
+///
+///     const sf::FrameProfile& profile = window.getFrameProfile();
+///     // profile.cpuTime, profile.gpuTime, profile.scopes[0].gpuTime, ...
+/// }
+/// \endcode
+///
 /// \see sf::RenderWindow, sf::RenderTexture, sf::View
 ///
 ////////////////////////////////////////////////////////////
@@ -75,6 +75,9 @@ public:
     /// to use the render-texture for 3D OpenGL rendering that requires
     /// a depth buffer. Otherwise it is unnecessary, and you should
     /// leave this parameter to false (which is its default value).
+    /// Calling this function again on a valid render-texture
+    /// reuses its OpenGL objects (texture, depth buffer and
+    /// context) whenever possible.
     ///
     /// \param width       Width of the render-texture
     /// \param height      Height of the render-texture
@@ -85,6 +88,27 @@ public:
     ////////////////////////////////////////////////////////////
     bool create(unsigned int width, unsigned int height, bool depthBuffer = false);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the render-texture with a given pixel format
+    ///
+    /// This function is similar to the other overload, but the
+    /// target texture uses the given \a format instead of RGBA8.
+    /// For example, a floating point format such as RGBA16F can
+    /// accumulate HDR lighting without clamping to [0, 1], and a
+    /// single-channel format such as R8 uses a quarter of the
+    /// memory for masks. The format must be supported by the
+    /// graphics driver (see Texture::isFormatAvailable).
+    ///
+    /// \param width       Width of the render-texture
+    /// \param height      Height of the render-texture
+    /// \param format      Format of the pixels of the target texture
+    /// \param depthBuffer Do you want this render-texture to have a depth buffer?
+    ///
+    /// \return True if creation has been successful
+    ///
+    ////////////////////////////////////////////////////////////
+    bool create(unsigned int width, unsigned int height, Texture::Format format, bool depthBuffer = false);
+
     ////////////////////////////////////////////////////////////
     /// \brief Enable or disable texture smoothing
     ///
@@ -134,10 +158,14 @@ public:
     ////////////////////////////////////////////////////////////
     /// \brief Activate or deactivate the render-texture for rendering
     ///
-    /// This function makes the render-texture's context current for
-    /// future OpenGL rendering operations (so you shouldn't care
+    /// This function makes the render-texture the current target
+    /// for future OpenGL rendering operations (so you shouldn't care
     /// about it if you're not doing direct OpenGL stuff).
-    /// Only one context can be current in a thread, so if you
+    /// When frame buffer objects are supported, this only binds
+    /// the render-texture's frame buffer in the context which is
+    /// currently active, there's no context switch. Otherwise, the
+    /// render-texture's own context is made current.
+    /// Only one target can be active in a thread, so if you
     /// want to draw OpenGL geometry to another render target
     /// (like a RenderWindow) don't forget to activate it again.
     ///
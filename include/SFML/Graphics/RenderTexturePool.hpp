@@ -0,0 +1,260 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_RENDERTEXTUREPOOL_HPP
+#define SFML_RENDERTEXTUREPOOL_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/System/NonCopyable.hpp>
+#include <vector>
+
+
+namespace sf
+{
+class RenderTexture;
+
+////////////////////////////////////////////////////////////
+/// \brief Recycles temporary render-textures to avoid
+///        creating OpenGL objects every frame
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API RenderTexturePool : NonCopyable
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty pool.
+    ///
+    ////////////////////////////////////////////////////////////
+    RenderTexturePool();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Destroys all the render-textures owned by the pool,
+    /// including the ones that have not been released.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~RenderTexturePool();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a render-texture with the given attributes
+    ///
+    /// If a released render-texture with the same size, pixel
+    /// format and depth buffer is available, it is returned directly.
+    /// Otherwise a render-texture that has not been used during
+    /// the current frame is created again with the new attributes,
+    /// which reuses its OpenGL objects; and if there's none, a new
+    /// one is created.
+    ///
+    /// The returned render-texture has its default view, and
+    /// smoothing and repeating are disabled. Its contents are
+    /// undefined, so you should clear it before drawing.
+    ///
+    /// \param width       Width of the render-texture
+    /// \param height      Height of the render-texture
+    /// \param depthBuffer Do you want the render-texture to have a depth buffer?
+    ///
+    /// \return Pointer to the render-texture, or NULL if it couldn't be created
+    ///
+    /// \see release
+    ///
+    ////////////////////////////////////////////////////////////
+    RenderTexture* acquire(unsigned int width, unsigned int height, bool depthBuffer = false);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a render-texture with the given attributes and pixel format
+    ///
+    /// This function is similar to the other overload, but the
+    /// target texture of the render-texture uses the given
+    /// \a format instead of RGBA8.
+    ///
+    /// \param width       Width of the render-texture
+    /// \param height      Height of the render-texture
+    /// \param format      Format of the pixels of the target texture
+    /// \param depthBuffer Do you want the render-texture to have a depth buffer?
+    ///
+    /// \return Pointer to the render-texture, or NULL if it couldn't be created
+    ///
+    /// \see release
+    ///
+    ////////////////////////////////////////////////////////////
+    RenderTexture* acquire(unsigned int width, unsigned int height, Texture::Format format, bool depthBuffer = false);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Give a render-texture back to the pool
+    ///
+    /// The render-texture must have been returned by a call to
+    /// acquire on this pool, and must not be used after being
+    /// released (it is still owned by the pool).
+    ///
+    /// \param renderTexture Render-texture to release
+    ///
+    /// \see acquire
+    ///
+    ////////////////////////////////////////////////////////////
+    void release(RenderTexture* renderTexture);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Notify the pool that a new frame begins
+    ///
+    /// This function should be called once per frame. It
+    /// destroys the released render-textures that have not
+    /// been used for more than the maximum number of idle frames.
+    ///
+    /// \see setMaxIdleFrames
+    ///
+    ////////////////////////////////////////////////////////////
+    void endFrame();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the number of frames a released render-texture is kept
+    ///
+    /// The default value is 60.
+    ///
+    /// \param frames Maximum number of frames a render-texture can stay unused
+    ///
+    /// \see getMaxIdleFrames, endFrame
+    ///
+    ////////////////////////////////////////////////////////////
+    void setMaxIdleFrames(unsigned int frames);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of frames a released render-texture is kept
+    ///
+    /// \return Maximum number of frames a render-texture can stay unused
+    ///
+    /// \see setMaxIdleFrames
+    ///
+    ////////////////////////////////////////////////////////////
+    unsigned int getMaxIdleFrames() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destroy all the released render-textures
+    ///
+    /// Render-textures that are currently acquired are not affected.
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of render-textures owned by the pool
+    ///
+    /// \return Number of render-textures, acquired or released
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getSize() const;
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Render-texture owned by the pool
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Entry
+    {
+        RenderTexture* renderTexture; ///< The render-texture
+        bool           depthBuffer;   ///< Does it have a depth buffer?
+        bool           inUse;         ///< Is it currently acquired?
+        unsigned int   lastFrame;     ///< Last frame during which it was acquired
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Mark an entry as acquired and reset its state
+    ///
+    /// \param entry Entry to acquire
+    ///
+    /// \return The render-texture of the entry
+    ///
+    ////////////////////////////////////////////////////////////
+    RenderTexture* use(Entry& entry);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<Entry> m_entries;       ///< All the render-textures owned by the pool
+    unsigned int       m_frame;         ///< Index of the current frame
+    unsigned int       m_maxIdleFrames; ///< Maximum number of frames a released render-texture is kept
+};
+
+} // namespace sf
+
+
+#endif // SFML_RENDERTEXTUREPOOL_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::RenderTexturePool
+/// \ingroup graphics
+///
+/// Creating a sf::RenderTexture is expensive: it allocates a
+/// texture, frame buffer objects and an optional depth buffer
+/// (or a dedicated OpenGL context when frame buffer objects
+/// are not supported). Programs that use temporary
+/// render-textures, for example for post-processing effects,
+/// should not create and destroy them every frame.
+///
+/// sf::RenderTexturePool owns a set of render-textures and hands
+/// them out on demand: acquire returns a render-texture matching
+/// the requested size, pixel format and depth buffer, and release gives it back
+/// so that it can be returned by a later call to acquire. When
+/// no released render-texture matches, one that was not used
+/// during the current frame is resized, which keeps its OpenGL
+/// objects. Render-textures that stay unused for too many frames
+/// are destroyed by endFrame.
+///
+/// Usage example:
+/// \code
+/// sf::RenderTexturePool pool;
+///
+/// while (window.isOpen())
+/// {
+///     // ... handle events ...
+///
+///     // Render the scene into a temporary render-texture
+///     sf::RenderTexture* scene = pool.acquire(800, 600);
+///     scene->clear();
+///     scene->draw(background);
+///     scene->display();
+///
+///     // Apply a post-effect and draw the result
+///     window.clear();
+///     window.draw(sf::Sprite(scene->getTexture()), &blurShader);
+///     window.display();
+///
+///     // Give the render-texture back and advance to the next frame
+///     pool.release(scene);
+///     pool.endFrame();
+/// }
+/// \endcode
+///
+/// \see sf::RenderTexture
+///
+////////////////////////////////////////////////////////////
@@ -33,6 +33,7 @@
 #include <SFML/Graphics/Transformable.hpp>
 #include <SFML/Graphics/VertexArray.hpp>
 #include <SFML/System/Vector2.hpp>
+#include <vector>
 
 
 namespace sf
@@ -288,6 +289,12 @@ private:
     ////////////////////////////////////////////////////////////
     void updateTexCoords();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Update the outline extrusion direction of each point
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateOutlineNormals();
+
     ////////////////////////////////////////////////////////////
     /// \brief Update the outline vertices' position
     ///
@@ -305,15 +312,16 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    const Texture* m_texture;          ///< Texture of the shape
-    IntRect        m_textureRect;      ///< Rectangle defining the area of the source texture to display
-    Color          m_fillColor;        ///< Fill color
-    Color          m_outlineColor;     ///< Outline color
-    float          m_outlineThickness; ///< Thickness of the shape's outline
-    VertexArray    m_vertices;         ///< Vertex array containing the fill geometry
-    VertexArray    m_outlineVertices;  ///< Vertex array containing the outline geometry
-    FloatRect      m_insideBounds;     ///< Bounding rectangle of the inside (fill)
-    FloatRect      m_bounds;           ///< Bounding rectangle of the whole shape (outline + fill)
+    const Texture*        m_texture;          ///< Texture of the shape
+    IntRect               m_textureRect;      ///< Rectangle defining the area of the source texture to display
+    Color                 m_fillColor;        ///< Fill color
+    Color                 m_outlineColor;     ///< Outline color
+    float                 m_outlineThickness; ///< Thickness of the shape's outline
+    VertexArray           m_vertices;         ///< Vertex array containing the fill geometry
+    VertexArray           m_outlineVertices;  ///< Vertex array containing the outline geometry
+    std::vector<Vector2f> m_outlineNormals;   ///< Extrusion direction of each point, for the outline
+    FloatRect             m_insideBounds;     ///< Bounding rectangle of the inside (fill)
+    FloatRect             m_bounds;           ///< Bounding rectangle of the whole shape (outline + fill)
 };
 
 } // namespace sf
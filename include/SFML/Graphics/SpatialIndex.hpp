@@ -0,0 +1,317 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_SPATIALINDEX_HPP
+#define SFML_SPATIALINDEX_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <vector>
+#include <cstddef>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Loose quadtree storing values by their bounding rectangle
+///
+////////////////////////////////////////////////////////////
+template <typename T>
+class SpatialIndex
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Identifier of an item stored in the index
+    ///
+    ////////////////////////////////////////////////////////////
+    typedef std::size_t Handle;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the index for a given world area
+    ///
+    /// The \a bounds rectangle defines the area which is
+    /// subdivided by the tree. Items located outside of it
+    /// can still be inserted, but they are all stored at the
+    /// root level and are therefore checked by every query.
+    ///
+    /// \param bounds   Area covered by the tree
+    /// \param maxDepth Maximum number of subdivision levels
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit SpatialIndex(const FloatRect& bounds, unsigned int maxDepth = 8);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Insert a new item into the index
+    ///
+    /// \param rect  Bounding rectangle of the item, in world coordinates
+    /// \param value Value to associate to the item
+    ///
+    /// \return Handle identifying the new item
+    ///
+    /// \see remove, move
+    ///
+    ////////////////////////////////////////////////////////////
+    Handle insert(const FloatRect& rect, const T& value);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove an item from the index
+    ///
+    /// After this call, \a handle is invalid and may be reused
+    /// by a future call to insert.
+    ///
+    /// \param handle Handle of the item to remove
+    ///
+    /// \see insert
+    ///
+    ////////////////////////////////////////////////////////////
+    void remove(Handle handle);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the bounding rectangle of an item
+    ///
+    /// This function must be called whenever the bounds of an
+    /// item change (when its entity moves, rotates or scales).
+    /// Small moves that keep the item in the same tree cell
+    /// don't touch the tree structure at all.
+    ///
+    /// \param handle Handle of the item to update
+    /// \param rect   New bounding rectangle of the item
+    ///
+    ////////////////////////////////////////////////////////////
+    void move(Handle handle, const FloatRect& rect);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the items from the index
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of items stored in the index
+    ///
+    /// \return Number of items
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getItemCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the value associated to an item
+    ///
+    /// \param handle Handle of the item
+    ///
+    /// \return Value of the item
+    ///
+    ////////////////////////////////////////////////////////////
+    const T& getValue(Handle handle) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the bounding rectangle of an item
+    ///
+    /// \param handle Handle of the item
+    ///
+    /// \return Bounding rectangle of the item
+    ///
+    ////////////////////////////////////////////////////////////
+    const FloatRect& getRect(Handle handle) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Find all the items that overlap an area
+    ///
+    /// The values of the matching items are appended to
+    /// \a result, in no particular order. Items that only
+    /// touch the border of \a area are considered overlapping.
+    ///
+    /// \param area   Area to query, in world coordinates
+    /// \param result Vector to fill with the values found
+    ///
+    /// \return Number of items found
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t query(const FloatRect& area, std::vector<T>& result) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Find all the items that contain a point
+    ///
+    /// This is typically used for hit-testing, with a point
+    /// obtained from RenderTarget::mapPixelToCoords.
+    ///
+    /// \param point  Point to test, in world coordinates
+    /// \param result Vector to fill with the values found
+    ///
+    /// \return Number of items found
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t query(const Vector2f& point, std::vector<T>& result) const;
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Find (and create if needed) the node that must hold a rectangle
+    ///
+    /// \param rect Bounding rectangle of the item
+    ///
+    /// \return Index of the node
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t locate(const FloatRect& rect);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Link an item to a node
+    ///
+    /// \param handle Handle of the item
+    /// \param node   Index of the node
+    ///
+    ////////////////////////////////////////////////////////////
+    void attach(Handle handle, std::size_t node);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Unlink an item from its node
+    ///
+    /// \param handle Handle of the item
+    ///
+    ////////////////////////////////////////////////////////////
+    void detach(Handle handle);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Collect the items of the tree that overlap an area
+    ///
+    /// \param left   Left coordinate of the area
+    /// \param top    Top coordinate of the area
+    /// \param right  Right coordinate of the area
+    /// \param bottom Bottom coordinate of the area
+    /// \param result Vector to fill with the values found
+    ///
+    /// \return Number of items found
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t collect(float left, float top, float right, float bottom, std::vector<T>& result) const;
+
+    ////////////////////////////////////////////////////////////
+    // Constants
+    ////////////////////////////////////////////////////////////
+    static const std::size_t None = static_cast<std::size_t>(-1);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Node of the tree
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Node
+    {
+        Vector2f    center;      ///< Center of the node's cell
+        Vector2f    halfSize;    ///< Half size of the node's (tight) cell
+        std::size_t parent;      ///< Index of the parent node
+        std::size_t children[4]; ///< Indices of the child nodes
+        Handle      firstItem;   ///< First item stored directly in this node
+        std::size_t count;       ///< Number of items stored in this node and its children
+        unsigned    depth;       ///< Depth of the node in the tree
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Item stored in the tree
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Item
+    {
+        FloatRect   rect;     ///< Bounding rectangle of the item
+        T           value;    ///< Value associated to the item
+        std::size_t node;     ///< Index of the node holding the item, None if the item is free
+        Handle      previous; ///< Previous item in the same node
+        Handle      next;     ///< Next item in the same node (or in the free list)
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    FloatRect         m_bounds;    ///< Area covered by the tree
+    unsigned int      m_maxDepth;  ///< Maximum depth of the tree
+    std::vector<Node> m_nodes;     ///< Nodes of the tree, the root is the first one
+    std::vector<Item> m_items;     ///< Storage for the items
+    Handle            m_freeItems; ///< First unused item slot
+    std::size_t       m_itemCount; ///< Number of items in use
+};
+
+#include <SFML/Graphics/SpatialIndex.inl>
+
+} // namespace sf
+
+
+#endif // SFML_SPATIALINDEX_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::SpatialIndex
+/// \ingroup graphics
+///
+/// sf::SpatialIndex stores values (typically pointers or
+/// indices to your drawable entities) together with their
+/// bounding rectangle, and allows to efficiently find those
+/// which overlap a given area or contain a given point.
+///
+/// It is implemented as a loose quadtree: each item is stored
+/// in the deepest cell that is at least as large as the item
+/// and contains its center, and cells are allowed to overlap
+/// their neighbours by half their size. This keeps insertion,
+/// removal and moves cheap (a walk down the tree, O(log n)),
+/// and moving an item within its cell doesn't change the tree
+/// at all.
+///
+/// The typical use is to avoid a linear scan over all the
+/// entities of a large world when drawing only the visible
+/// ones, or when picking the entity under the mouse cursor.
+///
+/// Usage example:
+/// \code
+/// sf::SpatialIndex<sf::Sprite*> index(sf::FloatRect(0, 0, 100000, 100000));
+///
+/// // Register the sprites
+/// std::vector<sf::SpatialIndex<sf::Sprite*>::Handle> handles;
+/// for (std::size_t i = 0; i < sprites.size(); ++i)
+///     handles.push_back(index.insert(sprites[i].getGlobalBounds(), &sprites[i]));
+///
+/// // Update the index when a sprite moves
+/// sprites[42].move(10, 0);
+/// index.move(handles[42], sprites[42].getGlobalBounds());
+///
+/// // Draw only the visible sprites
+/// const sf::View& view = window.getView();
+/// sf::FloatRect visible(view.getCenter() - view.getSize() / 2.f, view.getSize());
+/// std::vector<sf::Sprite*> found;
+/// index.query(visible, found);
+/// for (std::size_t i = 0; i < found.size(); ++i)
+///     window.draw(*found[i]);
+///
+/// // Find the sprites under the mouse cursor
+/// found.clear();
+/// index.query(window.mapPixelToCoords(sf::Mouse::getPosition(window)), found);
+/// \endcode
+///
+/// Rectangles are expected to have positive width and height.
+///
+/// \see sf::Rect
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,295 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+const std::size_t SpatialIndex<T>::None;
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+SpatialIndex<T>::SpatialIndex(const FloatRect& bounds, unsigned int maxDepth) :
+m_bounds   (bounds),
+m_maxDepth (maxDepth),
+m_nodes    (),
+m_items    (),
+m_freeItems(None),
+m_itemCount(0)
+{
+    clear();
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+typename SpatialIndex<T>::Handle SpatialIndex<T>::insert(const FloatRect& rect, const T& value)
+{
+    // Reuse a free slot if possible
+    Handle handle;
+    if (m_freeItems != None)
+    {
+        handle = m_freeItems;
+        m_freeItems = m_items[handle].next;
+    }
+    else
+    {
+        handle = m_items.size();
+        m_items.push_back(Item());
+    }
+
+    Item& item = m_items[handle];
+    item.rect = rect;
+    item.value = value;
+    attach(handle, locate(rect));
+
+    ++m_itemCount;
+
+    return handle;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+void SpatialIndex<T>::remove(Handle handle)
+{
+    detach(handle);
+
+    // Put the slot back in the free list
+    Item& item = m_items[handle];
+    item.node = None;
+    item.next = m_freeItems;
+    m_freeItems = handle;
+
+    --m_itemCount;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+void SpatialIndex<T>::move(Handle handle, const FloatRect& rect)
+{
+    m_items[handle].rect = rect;
+
+    // Only relink the item if it changed cell
+    std::size_t node = locate(rect);
+    if (node != m_items[handle].node)
+    {
+        detach(handle);
+        attach(handle, node);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+void SpatialIndex<T>::clear()
+{
+    m_items.clear();
+    m_freeItems = None;
+    m_itemCount = 0;
+
+    Node root;
+    root.center = Vector2f(m_bounds.left + m_bounds.width / 2.f, m_bounds.top + m_bounds.height / 2.f);
+    root.halfSize = Vector2f(m_bounds.width / 2.f, m_bounds.height / 2.f);
+    root.parent = None;
+    for (int i = 0; i < 4; ++i)
+        root.children[i] = None;
+    root.firstItem = None;
+    root.count = 0;
+    root.depth = 0;
+
+    m_nodes.clear();
+    m_nodes.push_back(root);
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+std::size_t SpatialIndex<T>::getItemCount() const
+{
+    return m_itemCount;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+const T& SpatialIndex<T>::getValue(Handle handle) const
+{
+    return m_items[handle].value;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+const FloatRect& SpatialIndex<T>::getRect(Handle handle) const
+{
+    return m_items[handle].rect;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+std::size_t SpatialIndex<T>::query(const FloatRect& area, std::vector<T>& result) const
+{
+    return collect(area.left, area.top, area.left + area.width, area.top + area.height, result);
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+std::size_t SpatialIndex<T>::query(const Vector2f& point, std::vector<T>& result) const
+{
+    return collect(point.x, point.y, point.x, point.y, result);
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+std::size_t SpatialIndex<T>::locate(const FloatRect& rect)
+{
+    Vector2f center(rect.left + rect.width / 2.f, rect.top + rect.height / 2.f);
+
+    // Items centered outside the tree are kept at the root
+    if ((center.x < m_bounds.left) || (center.x > m_bounds.left + m_bounds.width) ||
+        (center.y < m_bounds.top)  || (center.y > m_bounds.top + m_bounds.height))
+        return 0;
+
+    std::size_t index = 0;
+    while (m_nodes[index].depth < m_maxDepth)
+    {
+        Vector2f childHalfSize = m_nodes[index].halfSize / 2.f;
+
+        // The loose cell of a child extends half a cell beyond its tight cell,
+        // so the item fits in it as long as it is not larger than the tight cell
+        if ((rect.width > childHalfSize.x * 2.f) || (rect.height > childHalfSize.y * 2.f))
+            break;
+
+        // Select the quadrant containing the center of the item
+        const Vector2f& nodeCenter = m_nodes[index].center;
+        int quadrant = (center.x < nodeCenter.x ? 0 : 1) + (center.y < nodeCenter.y ? 0 : 2);
+
+        std::size_t child = m_nodes[index].children[quadrant];
+        if (child == None)
+        {
+            // Create the child node on demand
+            Node node;
+            node.center.x = nodeCenter.x + ((quadrant & 1) ? childHalfSize.x : -childHalfSize.x);
+            node.center.y = nodeCenter.y + ((quadrant & 2) ? childHalfSize.y : -childHalfSize.y);
+            node.halfSize = childHalfSize;
+            node.parent = index;
+            for (int i = 0; i < 4; ++i)
+                node.children[i] = None;
+            node.firstItem = None;
+            node.count = 0;
+            node.depth = m_nodes[index].depth + 1;
+
+            child = m_nodes.size();
+            m_nodes[index].children[quadrant] = child;
+            m_nodes.push_back(node);
+        }
+
+        index = child;
+    }
+
+    return index;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+void SpatialIndex<T>::attach(Handle handle, std::size_t node)
+{
+    Item& item = m_items[handle];
+    item.node = node;
+    item.previous = None;
+    item.next = m_nodes[node].firstItem;
+    if (item.next != None)
+        m_items[item.next].previous = handle;
+    m_nodes[node].firstItem = handle;
+
+    // Update the item counts up to the root
+    for (std::size_t index = node; index != None; index = m_nodes[index].parent)
+        ++m_nodes[index].count;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+void SpatialIndex<T>::detach(Handle handle)
+{
+    Item& item = m_items[handle];
+    if (item.previous != None)
+        m_items[item.previous].next = item.next;
+    else
+        m_nodes[item.node].firstItem = item.next;
+    if (item.next != None)
+        m_items[item.next].previous = item.previous;
+
+    // Update the item counts up to the root
+    for (std::size_t index = item.node; index != None; index = m_nodes[index].parent)
+        --m_nodes[index].count;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+std::size_t SpatialIndex<T>::collect(float left, float top, float right, float bottom, std::vector<T>& result) const
+{
+    std::size_t found = 0;
+
+    std::vector<std::size_t> pending(1, 0);
+    while (!pending.empty())
+    {
+        const Node& node = m_nodes[pending.back()];
+        pending.pop_back();
+
+        // Test the items stored in this node
+        for (Handle handle = node.firstItem; handle != None; handle = m_items[handle].next)
+        {
+            const FloatRect& rect = m_items[handle].rect;
+            if ((rect.left <= right) && (rect.left + rect.width >= left) &&
+                (rect.top <= bottom) && (rect.top + rect.height >= top))
+            {
+                result.push_back(m_items[handle].value);
+                ++found;
+            }
+        }
+
+        // Visit the non-empty children whose loose cell overlaps the area
+        for (int i = 0; i < 4; ++i)
+        {
+            std::size_t index = node.children[i];
+            if ((index == None) || (m_nodes[index].count == 0))
+                continue;
+
+            const Node& child = m_nodes[index];
+            if ((child.center.x - 2.f * child.halfSize.x <= right) && (child.center.x + 2.f * child.halfSize.x >= left) &&
+                (child.center.y - 2.f * child.halfSize.y <= bottom) && (child.center.y + 2.f * child.halfSize.y >= top))
+                pending.push_back(index);
+        }
+    }
+
+    return found;
+}
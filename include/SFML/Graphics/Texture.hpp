@@ -58,6 +58,24 @@ public:
         Pixels      ///< Texture coordinates in range [0 .. size]
     };
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Formats in which the pixels of a texture can be stored
+    ///
+    /// Formats other than RGBA8 may not be supported by the
+    /// graphics driver, use isFormatAvailable to check.
+    ///
+    ////////////////////////////////////////////////////////////
+    enum Format
+    {
+        RGBA8,   ///< 4 channels, 8-bit unsigned normalized (the default, matches sf::Color)
+        R8,      ///< 1 channel, 8-bit unsigned normalized
+        RG8,     ///< 2 channels, 8-bit unsigned normalized
+        R16F,    ///< 1 channel, 16-bit floating point
+        RGBA16F, ///< 4 channels, 16-bit floating point
+        R32F,    ///< 1 channel, 32-bit floating point
+        RGBA32F  ///< 4 channels, 32-bit floating point
+    };
+
 public:
 
     ////////////////////////////////////////////////////////////
@@ -87,13 +105,23 @@ public:
     ///
     /// If this function fails, the texture is left unchanged.
     ///
+    /// The \a format argument defines how pixels are stored on
+    /// the graphics card: single-channel formats use less memory,
+    /// and floating point formats are not limited to the [0, 1]
+    /// range, which is useful for HDR rendering with sf::RenderTexture.
+    /// When the texture is drawn, the missing channels are read as
+    /// 0 for green and blue, and 1 for alpha.
+    ///
     /// \param width  Width of the texture
     /// \param height Height of the texture
+    /// \param format Format of the pixels
     ///
     /// \return True if creation was successful
     ///
+    /// \see isFormatAvailable
+    ///
     ////////////////////////////////////////////////////////////
-    bool create(unsigned int width, unsigned int height);
+    bool create(unsigned int width, unsigned int height, Format format = RGBA8);
 
     ////////////////////////////////////////////////////////////
     /// \brief Load the texture from a file on disk
@@ -221,6 +249,14 @@ public:
     ////////////////////////////////////////////////////////////
     Vector2u getSize() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the format of the texture pixels
+    ///
+    /// \return Format of the pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    Format getFormat() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Copy the texture pixels to an image
     ///
@@ -240,7 +276,10 @@ public:
     /// \brief Update the whole texture from an array of pixels
     ///
     /// The \a pixel array is assumed to have the same size as
-    /// the \a area rectangle, and to contain 32-bits RGBA pixels.
+    /// the \a area rectangle, and to contain one byte per channel
+    /// of the texture format (4 bytes per pixel for RGBA8, 1 for R8).
+    /// For floating point formats, the bytes are converted to the
+    /// [0, 1] range.
     ///
     /// No additional check is performed on the size of the pixel
     /// array, passing invalid arguments will lead to an undefined
@@ -258,7 +297,8 @@ public:
     /// \brief Update a part of the texture from an array of pixels
     ///
     /// The size of the \a pixel array must match the \a width and
-    /// \a height arguments, and it must contain 32-bits RGBA pixels.
+    /// \a height arguments, and it must contain one byte per channel
+    /// of the texture format (4 bytes per pixel for RGBA8, 1 for R8).
     ///
     /// No additional check is performed on the size of the pixel
     /// array or the bounds of the area to update, passing invalid
@@ -276,6 +316,46 @@ public:
     ////////////////////////////////////////////////////////////
     void update(const Uint8* pixels, unsigned int width, unsigned int height, unsigned int x, unsigned int y);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Update the whole texture from an array of floating point pixels
+    ///
+    /// The \a pixel array is assumed to have the same size as
+    /// the texture, and to contain one float per channel of the
+    /// texture format (4 floats per pixel for RGBA16F, 1 for R32F).
+    /// The conversion to the texture format, if any, is done by
+    /// the graphics driver.
+    ///
+    /// This function does nothing if \a pixels is null or if the
+    /// texture was not previously created.
+    ///
+    /// \param pixels Array of pixels to copy to the texture
+    ///
+    ////////////////////////////////////////////////////////////
+    void update(const float* pixels);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a part of the texture from an array of floating point pixels
+    ///
+    /// The size of the \a pixel array must match the \a width and
+    /// \a height arguments, and it must contain one float per channel
+    /// of the texture format (4 floats per pixel for RGBA16F, 1 for R32F).
+    ///
+    /// No additional check is performed on the size of the pixel
+    /// array or the bounds of the area to update, passing invalid
+    /// arguments will lead to an undefined behavior.
+    ///
+    /// This function does nothing if \a pixels is null or if the
+    /// texture was not previously created.
+    ///
+    /// \param pixels Array of pixels to copy to the texture
+    /// \param width  Width of the pixel region contained in \a pixels
+    /// \param height Height of the pixel region contained in \a pixels
+    /// \param x      X offset in the texture where to copy the source pixels
+    /// \param y      Y offset in the texture where to copy the source pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    void update(const float* pixels, unsigned int width, unsigned int height, unsigned int x, unsigned int y);
+
     ////////////////////////////////////////////////////////////
     /// \brief Update the texture from an image
     ///
@@ -477,10 +557,23 @@ public:
     ////////////////////////////////////////////////////////////
     static unsigned int getMaximumSize();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether or not the system supports a texture format
+    ///
+    /// RGBA8 is always available.
+    ///
+    /// \param format Format to check
+    ///
+    /// \return True if textures can be created with the format
+    ///
+    ////////////////////////////////////////////////////////////
+    static bool isFormatAvailable(Format format);
+
 private:
 
     friend class RenderTexture;
     friend class RenderTarget;
+    friend class TextureStreamer;
 
     ////////////////////////////////////////////////////////////
     /// \brief Get a valid image size according to hardware support
@@ -497,16 +590,47 @@ private:
     ////////////////////////////////////////////////////////////
     static unsigned int getValidSize(unsigned int size);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Upload pixels to a part of the texture
+    ///
+    /// \param pixels      Array of pixels to copy to the texture
+    /// \param width       Width of the pixel region contained in \a pixels
+    /// \param height      Height of the pixel region contained in \a pixels
+    /// \param x           X offset in the texture where to copy the source pixels
+    /// \param y           Y offset in the texture where to copy the source pixels
+    /// \param pixelFormat OpenGL format of the source pixels (channels)
+    /// \param pixelType   OpenGL type of the source pixels channels
+    /// \param pixelSize   Size of a source pixel, in bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    void upload(const void* pixels, unsigned int width, unsigned int height, unsigned int x, unsigned int y, unsigned int pixelFormat, unsigned int pixelType, std::size_t pixelSize);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Release the video memory of the texture
+    ///
+    /// The pixels are replaced with a single pixel of the given
+    /// color, but the texture keeps its size so that it can still
+    /// be drawn with the same texture coordinates. It is restored
+    /// by the next call to create. This is used by sf::TextureStreamer.
+    ///
+    /// \param placeholder Color of the placeholder pixel
+    ///
+    ////////////////////////////////////////////////////////////
+    void evict(const Color& placeholder);
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
     Vector2u     m_size;          ///< Public texture size
     Vector2u     m_actualSize;    ///< Actual texture size (can be greater than public size because of padding)
     unsigned int m_texture;       ///< Internal texture identifier
+    Format       m_format;        ///< Format of the pixels
     bool         m_isSmooth;      ///< Status of the smooth filter
     bool         m_isRepeated;    ///< Is the texture in repeat mode?
     mutable bool m_pixelsFlipped; ///< To work around the inconsistency in Y orientation
     bool         m_fboAttachment; ///< Is this texture owned by a framebuffer object?
+    bool         m_evicted;       ///< Are the pixels replaced with a placeholder (see evict)?
+    mutable bool m_used;          ///< Has the texture been bound since the flag was last reset (see sf::TextureStreamer)?
     Uint64       m_cacheId;       ///< Unique number that identifies the texture to the render target's cache
 };
 
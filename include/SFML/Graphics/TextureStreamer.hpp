@@ -0,0 +1,287 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_TEXTURESTREAMER_HPP
+#define SFML_TEXTURESTREAMER_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/System/Mutex.hpp>
+#include <SFML/System/NonCopyable.hpp>
+#include <SFML/System/Thread.hpp>
+#include <deque>
+#include <string>
+#include <vector>
+
+
+namespace sf
+{
+class Texture;
+
+////////////////////////////////////////////////////////////
+/// \brief Keeps the video memory used by a set of textures
+///        within a budget, reloading them on demand
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API TextureStreamer : NonCopyable
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// The budget is unlimited by default.
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureStreamer();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Waits for the pending loads and destroys all the textures
+    /// of the streamer.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~TextureStreamer();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load a streamed texture from a file on disk
+    ///
+    /// The first load is synchronous, so that the texture has
+    /// its final size. The file must stay available as long as
+    /// the texture may need to be reloaded.
+    ///
+    /// \param filename Path of the image file to load
+    ///
+    /// \return Pointer to the texture, or NULL if the file couldn't be loaded
+    ///
+    /// \see loadFromMemory
+    ///
+    ////////////////////////////////////////////////////////////
+    const Texture* loadFromFile(const std::string& filename);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load a streamed texture from a file in memory
+    ///
+    /// The first load is synchronous, so that the texture has
+    /// its final size. The data is not copied, so it must stay
+    /// alive as long as the streamer exists.
+    ///
+    /// \param data Pointer to the file data in memory
+    /// \param size Size of the data to load, in bytes
+    ///
+    /// \return Pointer to the texture, or NULL if the data couldn't be loaded
+    ///
+    /// \see loadFromFile
+    ///
+    ////////////////////////////////////////////////////////////
+    const Texture* loadFromMemory(const void* data, std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update the residency of the textures
+    ///
+    /// This function must be called once per frame, from the
+    /// thread that draws the textures. It uploads the textures
+    /// whose loading has finished, starts reloading the evicted
+    /// textures that were drawn since the last call, and evicts
+    /// the least recently drawn textures if the budget is exceeded.
+    /// Textures drawn since the last call are never evicted,
+    /// even if the budget is exceeded.
+    ///
+    ////////////////////////////////////////////////////////////
+    void update();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the maximum amount of video memory used by the textures
+    ///
+    /// \param bytes Budget, in bytes
+    ///
+    /// \see getBudget, getResidentSize
+    ///
+    ////////////////////////////////////////////////////////////
+    void setBudget(std::size_t bytes);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the maximum amount of video memory used by the textures
+    ///
+    /// \return Budget, in bytes
+    ///
+    /// \see setBudget
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getBudget() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the amount of video memory currently used by the textures
+    ///
+    /// \return Size of the resident textures, in bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getResidentSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the color displayed while a texture is not resident
+    ///
+    /// The default placeholder is transparent. The new color
+    /// applies to the textures evicted after this call.
+    ///
+    /// \param color Color of the placeholder
+    ///
+    ////////////////////////////////////////////////////////////
+    void setPlaceholderColor(const Color& color);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether a texture of the streamer is in video memory
+    ///
+    /// \param texture Texture returned by the streamer
+    ///
+    /// \return True if the texture pixels are loaded, false if it displays the placeholder
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isResident(const Texture& texture) const;
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Texture managed by the streamer
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Entry
+    {
+        Texture*     texture;  ///< The texture
+        std::string  filename; ///< Source file, if loaded from a file
+        const void*  data;     ///< Source data, if loaded from memory
+        std::size_t  size;     ///< Size of the source data
+        std::size_t  bytes;    ///< Video memory used by the texture when resident
+        Uint64       lastUse;  ///< Last frame during which the texture was drawn
+        bool         resident; ///< Are the pixels in video memory?
+        bool         loading;  ///< Is the texture being loaded in the background?
+        bool         failed;   ///< Did the last reload fail?
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Background loading request
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Request
+    {
+        std::size_t entry;    ///< Index of the entry to load
+        std::string filename; ///< Source file, if loaded from a file
+        const void* data;     ///< Source data, if loaded from memory
+        std::size_t size;     ///< Size of the source data
+        Image       image;    ///< Decoded pixels
+        bool        success;  ///< Was the image decoded successfully?
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a texture loaded from an image
+    ///
+    /// \param image Initial pixels of the texture
+    /// \param entry Entry describing the source of the texture
+    ///
+    /// \return Pointer to the texture, or NULL on failure
+    ///
+    ////////////////////////////////////////////////////////////
+    const Texture* add(const Image& image, Entry& entry);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Decode the requested images in the background
+    ///
+    ////////////////////////////////////////////////////////////
+    void loadRequests();
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<Entry>    m_entries;       ///< All the textures of the streamer
+    std::deque<Request*>  m_pending;       ///< Requests waiting to be decoded
+    std::vector<Request*> m_finished;      ///< Decoded requests, waiting to be uploaded
+    Thread                m_thread;        ///< Thread decoding the requests
+    bool                  m_threadRunning; ///< Is the decoding thread running?
+    Mutex                 m_mutex;         ///< Protects the requests and the thread state
+    std::size_t           m_budget;        ///< Maximum amount of video memory, in bytes
+    std::size_t           m_residentSize;  ///< Amount of video memory used by the resident textures
+    Color                 m_placeholder;   ///< Color of the evicted textures
+    Uint64                m_frame;         ///< Index of the current frame
+};
+
+} // namespace sf
+
+
+#endif // SFML_TEXTURESTREAMER_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::TextureStreamer
+/// \ingroup graphics
+///
+/// sf::TextureStreamer owns a set of textures loaded from files
+/// or from memory, and makes sure that the video memory they
+/// use stays within a budget. When the budget is exceeded, the
+/// textures that haven't been drawn for the longest time are
+/// evicted: their pixels are released and replaced with a
+/// single placeholder pixel. When an evicted texture is drawn
+/// again, it is decoded from its source in a background thread
+/// and uploaded during a later call to update; until then, it
+/// displays the placeholder color.
+///
+/// Evicted textures keep their size, so sprites using them don't
+/// need to know anything about streaming. Drawn textures are
+/// detected when they are bound for rendering (see sf::Texture::bind).
+///
+/// Keeping the textures within a budget that fits the video
+/// memory prevents the graphics driver from paging them, which
+/// causes long hitches.
+///
+/// The textures returned by the streamer are const, because
+/// any modification would be lost when they are reloaded.
+///
+/// Usage example:
+/// \code
+/// sf::TextureStreamer streamer;
+/// streamer.setBudget(128 * 1024 * 1024);
+/// streamer.setPlaceholderColor(sf::Color(128, 128, 128));
+///
+/// const sf::Texture* texture = streamer.loadFromFile("level1.png");
+/// sf::Sprite sprite(*texture);
+///
+/// while (window.isOpen())
+/// {
+///     // ... handle events ...
+///
+///     streamer.update();
+///
+///     window.clear();
+///     window.draw(sprite);
+///     window.display();
+/// }
+/// \endcode
+///
+/// \see sf::Texture
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,278 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_TILEMAP_HPP
+#define SFML_TILEMAP_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/Transformable.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <vector>
+
+
+namespace sf
+{
+class Texture;
+
+////////////////////////////////////////////////////////////
+/// \brief Grid of tiles taken from a tileset texture,
+///        rendered by chunks
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API TileMap : public Drawable, public Transformable
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Special tile index for empty cells, which are not drawn
+    ///
+    ////////////////////////////////////////////////////////////
+    static const Uint16 NoTile;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty tile map with no tileset.
+    ///
+    ////////////////////////////////////////////////////////////
+    TileMap();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the map with a given size
+    ///
+    /// All the previous tiles are discarded.
+    ///
+    /// \param width    Width of the map, in tiles
+    /// \param height   Height of the map, in tiles
+    /// \param tileSize Size of a tile, in pixels (both in the tileset and in local coordinates)
+    /// \param tile     Index of the tile to fill the map with
+    ///
+    ////////////////////////////////////////////////////////////
+    void create(unsigned int width, unsigned int height, const Vector2u& tileSize, Uint16 tile = NoTile);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the tileset texture
+    ///
+    /// Tiles are laid out in the texture row by row, from the
+    /// top-left corner: tile index \a i is located at column
+    /// i % (texture width / tile width) and row
+    /// i / (texture width / tile width).
+    ///
+    /// The \a tileset argument refers to a texture that must
+    /// exist as long as the tile map uses it. Indeed, the map
+    /// doesn't store its own copy of the texture, but rather keeps
+    /// a pointer to the one that you passed to this function.
+    ///
+    /// \param tileset New tileset texture
+    ///
+    /// \see getTileset
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTileset(const Texture& tileset);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the tileset texture
+    ///
+    /// If the map has no tileset, a NULL pointer is returned.
+    ///
+    /// \return Pointer to the tileset texture
+    ///
+    /// \see setTileset
+    ///
+    ////////////////////////////////////////////////////////////
+    const Texture* getTileset() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change a tile of the map
+    ///
+    /// Only the chunk containing the tile is rebuilt, the next
+    /// time it is drawn. This function doesn't check \a x and
+    /// \a y, they must be inside the map.
+    ///
+    /// \param x    Column of the tile
+    /// \param y    Row of the tile
+    /// \param tile New tile index (NoTile to leave the cell empty)
+    ///
+    /// \see getTile
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTile(unsigned int x, unsigned int y, Uint16 tile);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a tile of the map
+    ///
+    /// This function doesn't check \a x and \a y, they must
+    /// be inside the map.
+    ///
+    /// \param x Column of the tile
+    /// \param y Row of the tile
+    ///
+    /// \return Tile index
+    ///
+    /// \see setTile
+    ///
+    ////////////////////////////////////////////////////////////
+    Uint16 getTile(unsigned int x, unsigned int y) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the map
+    ///
+    /// \return Size of the map, in tiles
+    ///
+    ////////////////////////////////////////////////////////////
+    Vector2u getSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of a tile
+    ///
+    /// \return Size of a tile, in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    const Vector2u& getTileSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the local bounding rectangle of the entity
+    ///
+    /// The returned rectangle is in local coordinates, which means
+    /// that it ignores the transformations (translation, rotation,
+    /// scale, ...) that are applied to the entity.
+    ///
+    /// \return Local bounding rectangle of the entity
+    ///
+    ////////////////////////////////////////////////////////////
+    FloatRect getLocalBounds() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the global bounding rectangle of the entity
+    ///
+    /// The returned rectangle is in global coordinates, which means
+    /// that it takes into account the transformations (translation,
+    /// rotation, scale, ...) that are applied to the entity.
+    ///
+    /// \return Global bounding rectangle of the entity
+    ///
+    ////////////////////////////////////////////////////////////
+    FloatRect getGlobalBounds() const;
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the visible chunks of the map to a render target
+    ///
+    /// \param target Render target to draw to
+    /// \param states Current render states
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void draw(RenderTarget& target, RenderStates states) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Rebuild the geometry of a chunk
+    ///
+    /// \param x Column of the chunk
+    /// \param y Row of the chunk
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateChunk(unsigned int x, unsigned int y) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Mark the geometry of all the chunks as outdated
+    ///
+    ////////////////////////////////////////////////////////////
+    void invalidateChunks();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Block of tiles whose geometry is built at once
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Chunk
+    {
+        Chunk();
+
+        VertexArray vertices;    ///< Geometry of the chunk
+        bool        needUpdate;  ///< Does the geometry need to be recomputed?
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    const Texture*             m_tileset;   ///< Texture containing the tiles
+    Vector2u                   m_size;      ///< Size of the map, in tiles
+    Vector2u                   m_tileSize;  ///< Size of a tile, in pixels
+    Vector2u                   m_chunkGrid; ///< Number of chunks on each axis
+    std::vector<Uint16>        m_tiles;     ///< Tile indices, row by row
+    mutable std::vector<Chunk> m_chunks;    ///< Chunks, row by row
+};
+
+} // namespace sf
+
+
+#endif // SFML_TILEMAP_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::TileMap
+/// \ingroup graphics
+///
+/// sf::TileMap is a drawable class that displays a 2D grid of
+/// tiles, each one being a sub-rectangle of a tileset texture
+/// identified by its index.
+///
+/// It inherits all the functions from sf::Transformable:
+/// position, rotation, scale, origin.
+///
+/// Tile indices are stored in a compact array (2 bytes per
+/// tile), and the geometry is built lazily by chunks of
+/// 32x32 tiles: a chunk is only built the first time it
+/// becomes visible, changing a tile only rebuilds the chunk
+/// that contains it, and only the chunks intersecting the
+/// current view of the render target are drawn. This makes
+/// very large maps cheap both to edit and to draw.
+///
+/// Usage example:
+/// \code
+/// // Load the tileset
+/// sf::Texture tileset;
+/// tileset.loadFromFile("tileset.png");
+///
+/// // Create a 4096x4096 map of 16x16 tiles, filled with tile 0
+/// sf::TileMap map;
+/// map.create(4096, 4096, sf::Vector2u(16, 16), 0);
+/// map.setTileset(tileset);
+///
+/// // Change some tiles
+/// map.setTile(10, 20, 5);
+/// map.setTile(11, 20, sf::TileMap::NoTile);
+///
+/// // Draw it
+/// window.draw(map);
+/// \endcode
+///
+/// \see sf::Texture, sf::VertexArray
+///
+////////////////////////////////////////////////////////////
@@ -31,6 +31,7 @@
 #include <SFML/Graphics/Export.hpp>
 #include <SFML/Graphics/Rect.hpp>
 #include <SFML/System/Vector2.hpp>
+#include <cstddef>
 
 
 namespace sf
@@ -118,6 +119,24 @@ public:
     ////////////////////////////////////////////////////////////
     Vector2f transformPoint(const Vector2f& point) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Transform an array of 2D points
+    ///
+    /// This function gives the same results as calling
+    /// transformPoint on each point, but processes several
+    /// points at once using SIMD instructions when they are
+    /// available (SSE on x86, NEON on ARM).
+    ///
+    /// \a input and \a output may point to the same array,
+    /// to transform the points in place.
+    ///
+    /// \param input  Points to transform
+    /// \param output Array to fill with the transformed points
+    /// \param count  Number of points in both arrays
+    ///
+    ////////////////////////////////////////////////////////////
+    void transformPoints(const Vector2f* input, Vector2f* output, std::size_t count) const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Transform a rectangle
     ///
@@ -311,6 +311,30 @@ public:
     ////////////////////////////////////////////////////////////
     const Transform& getInverseTransform() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Compute the transforms of many objects at once
+    ///
+    /// This function computes the same transforms as getTransform,
+    /// for objects whose components are stored in separate arrays
+    /// rather than in sf::Transformable instances. It is meant
+    /// for systems that manage large numbers of entities, which
+    /// can then feed the results to Transform::transformPoints.
+    ///
+    /// All the arrays must contain at least \a count elements.
+    ///
+    /// \param positions  Positions of the objects
+    /// \param rotations  Rotations of the objects, in degrees
+    /// \param scales     Scale factors of the objects
+    /// \param origins    Local origins of the objects
+    /// \param transforms Array to fill with the resulting transforms
+    /// \param count      Number of objects
+    ///
+    /// \see getTransform
+    ///
+    ////////////////////////////////////////////////////////////
+    static void computeTransforms(const Vector2f* positions, const float* rotations, const Vector2f* scales,
+                                  const Vector2f* origins, Transform* transforms, std::size_t count);
+
 private:
 
     ////////////////////////////////////////////////////////////
@@ -0,0 +1,159 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+#ifndef SFML_THREADSIGNAL_HPP
+#define SFML_THREADSIGNAL_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Export.hpp>
+#include <SFML/System/NonCopyable.hpp>
+#include <SFML/System/Time.hpp>
+
+
+namespace sf
+{
+namespace priv
+{
+    class ThreadSignalImpl;
+}
+
+////////////////////////////////////////////////////////////
+/// \brief Wakes up a thread waiting for an event
+///
+////////////////////////////////////////////////////////////
+class SFML_SYSTEM_API ThreadSignal : NonCopyable
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// The signal is initially not notified.
+    ///
+    ////////////////////////////////////////////////////////////
+    ThreadSignal();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~ThreadSignal();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Notify the signal
+    ///
+    /// If a thread is waiting for the signal, it is woken up.
+    /// Otherwise the signal stays notified, and the next call
+    /// to wait() returns immediately.
+    ///
+    /// \see wait
+    ///
+    ////////////////////////////////////////////////////////////
+    void notify();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait until the signal is notified
+    ///
+    /// The signal is reset when this function returns.
+    ///
+    /// \see notify
+    ///
+    ////////////////////////////////////////////////////////////
+    void wait();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait until the signal is notified, or a timeout elapses
+    ///
+    /// The signal is reset when this function returns.
+    ///
+    /// \param timeout Maximum time to wait
+    ///
+    /// \return True if the signal was notified, false if the timeout elapsed
+    ///
+    /// \see notify
+    ///
+    ////////////////////////////////////////////////////////////
+    bool wait(Time timeout);
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    priv::ThreadSignalImpl* m_impl; ///< OS-specific implementation
+};
+
+} // namespace sf
+
+
+#endif // SFML_THREADSIGNAL_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::ThreadSignal
+/// \ingroup system
+///
+/// sf::ThreadSignal lets a thread sleep until another thread
+/// has something for it to do, instead of polling. It is
+/// typically used by worker threads which wait for requests,
+/// or for a deadline computed from their workload.
+///
+/// A signal remembers that it was notified until a thread
+/// waits for it, so a notification sent before the other
+/// thread starts waiting is never lost. Several notifications
+/// sent before a wait are merged into one.
+///
+/// Usage example:
+/// \code
+/// sf::ThreadSignal signal;
+/// sf::Mutex mutex;
+/// std::queue<Job> jobs;
+///
+/// void worker()
+/// {
+///     for (;;)
+///     {
+///         // sleep until there's a job, or until the next periodic update
+///         signal.wait(sf::milliseconds(500));
+///
+///         sf::Lock lock(mutex);
+///         while (!jobs.empty())
+///             ...
+///     }
+/// }
+///
+/// void addJob(const Job& job)
+/// {
+///     {
+///         sf::Lock lock(mutex);
+///         jobs.push(job);
+///     }
+///     signal.notify(); // wake up the worker
+/// }
+/// \endcode
+///
+/// \see sf::Thread, sf::Mutex
+///
+////////////////////////////////////////////////////////////
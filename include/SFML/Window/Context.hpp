@@ -43,6 +43,8 @@ namespace priv
 
 typedef void (*GlFunctionPointer)();
 
+typedef void (*ContextDestroyCallback)(Uint64 contextId, void* arg);
+
 ////////////////////////////////////////////////////////////
 /// \brief Class holding a valid drawing context
 ///
@@ -117,6 +119,50 @@ public:
     ////////////////////////////////////////////////////////////
     static const Context* getActiveContext();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the identifier of the context active on the current thread
+    ///
+    /// Unlike getActiveContext, this function also takes into
+    /// account the contexts of windows. Identifiers are unique
+    /// and never reused, so they can be used to associate
+    /// per-context OpenGL objects (such as frame buffer objects,
+    /// which are not shared between contexts) to a context.
+    ///
+    /// \return Identifier of the active context, or 0 if none is active
+    ///
+    ////////////////////////////////////////////////////////////
+    static Uint64 getActiveContextId();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the settings of the context active on the current thread
+    ///
+    /// Like getActiveContextId, this function also takes into
+    /// account the contexts of windows. It allows code that
+    /// doesn't own the active context to adapt its OpenGL
+    /// usage, for example to a core profile context.
+    ///
+    /// \return Settings of the active context, or default
+    ///         settings if no context is active
+    ///
+    ////////////////////////////////////////////////////////////
+    static ContextSettings getActiveContextSettings();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Register a function to be called when a context is destroyed
+    ///
+    /// The callback is invoked right before a context (including
+    /// window contexts) is destroyed, with this context active on
+    /// the current thread, so that it can release the OpenGL
+    /// objects that are not shared with other contexts and forget
+    /// everything it associated to \a contextId. Registering the
+    /// same callback and argument twice has no effect.
+    ///
+    /// \param callback Function to call
+    /// \param arg      Argument passed to the function
+    ///
+    ////////////////////////////////////////////////////////////
+    static void registerContextDestroyCallback(ContextDestroyCallback callback, void* arg);
+
     ////////////////////////////////////////////////////////////
     /// \brief Construct a in-memory context
     ///
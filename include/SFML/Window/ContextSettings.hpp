@@ -117,9 +117,11 @@ struct ContextSettings
 /// a compatibility context is created. You only need to specify
 /// the core flag if you want a core profile context to use with
 /// your own OpenGL rendering.
-/// <b>Warning: The graphics module will not function if you
-/// request a core profile context. Make sure the attributes are
-/// set to Default if you want to use the graphics module.</b>
+///
+/// The graphics module also works with core profile contexts
+/// of version 3.2 or later: render targets then draw with a
+/// built-in shader instead of the fixed function pipeline
+/// (see sf::RenderTarget for the requirements on your own shaders).
 ///
 /// Setting the debug attribute flag will request a context with
 /// additional debugging features enabled. Depending on the
@@ -83,6 +83,18 @@ public:
     ////////////////////////////////////////////////////////////
     static int getFormatFromChannelCount(unsigned int channelCount);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the OpenAL 32 bit floating point format that matches
+    ///        the given number of channels
+    ///
+    /// \param channelCount Number of channels
+    ///
+    /// \return Corresponding format, or 0 if floating point
+    ///         samples are not supported by the audio device
+    ///
+    ////////////////////////////////////////////////////////////
+    static int getFloatFormatFromChannelCount(unsigned int channelCount);
+
     ////////////////////////////////////////////////////////////
     /// \brief Change the global volume of all the sounds and musics
     ///
@@ -38,12 +38,13 @@ namespace sf
 {
 ////////////////////////////////////////////////////////////
 InputSoundFile::InputSoundFile() :
-m_reader      (NULL),
-m_stream      (NULL),
-m_streamOwned (false),
-m_sampleCount (0),
-m_channelCount(0),
-m_sampleRate  (0)
+m_reader       (NULL),
+m_stream       (NULL),
+m_streamOwned  (false),
+m_sampleCount  (0),
+m_channelCount (0),
+m_sampleRate   (0),
+m_bitsPerSample(0)
 {
 }
 
@@ -81,6 +82,7 @@ bool InputSoundFile::openFromFile(const std::string& filename)
 
     // Pass the stream to the reader
     SoundFileReader::Info info;
+    info.bitsPerSample = 0; // optional, readers may not fill it
     if (!m_reader->open(*file, info))
     {
         close();
@@ -91,6 +93,7 @@ bool InputSoundFile::openFromFile(const std::string& filename)
     m_sampleCount = info.sampleCount;
     m_channelCount = info.channelCount;
     m_sampleRate = info.sampleRate;
+    m_bitsPerSample = info.bitsPerSample;
 
     return true;
 }
@@ -117,6 +120,7 @@ bool InputSoundFile::openFromMemory(const void* data, std::size_t sizeInBytes)
 
     // Pass the stream to the reader
     SoundFileReader::Info info;
+    info.bitsPerSample = 0; // optional, readers may not fill it
     if (!m_reader->open(*memory, info))
     {
         close();
@@ -127,6 +131,7 @@ bool InputSoundFile::openFromMemory(const void* data, std::size_t sizeInBytes)
     m_sampleCount = info.sampleCount;
     m_channelCount = info.channelCount;
     m_sampleRate = info.sampleRate;
+    m_bitsPerSample = info.bitsPerSample;
 
     return true;
 }
@@ -156,6 +161,7 @@ bool InputSoundFile::openFromStream(InputStream& stream)
 
     // Pass the stream to the reader
     SoundFileReader::Info info;
+    info.bitsPerSample = 0; // optional, readers may not fill it
     if (!m_reader->open(stream, info))
     {
         close();
@@ -166,6 +172,7 @@ bool InputSoundFile::openFromStream(InputStream& stream)
     m_sampleCount = info.sampleCount;
     m_channelCount = info.channelCount;
     m_sampleRate = info.sampleRate;
+    m_bitsPerSample = info.bitsPerSample;
 
     return true;
 }
@@ -192,6 +199,13 @@ unsigned int InputSoundFile::getSampleRate() const
 }
 
 
+////////////////////////////////////////////////////////////
+unsigned int InputSoundFile::getBitsPerSample() const
+{
+    return m_bitsPerSample;
+}
+
+
 ////////////////////////////////////////////////////////////
 Time InputSoundFile::getDuration() const
 {
@@ -224,6 +238,16 @@ Uint64 InputSoundFile::read(Int16* samples, Uint64 maxCount)
 }
 
 
+////////////////////////////////////////////////////////////
+Uint64 InputSoundFile::read(float* samples, Uint64 maxCount)
+{
+    if (m_reader && samples && maxCount)
+        return m_reader->read(samples, maxCount);
+    else
+        return 0;
+}
+
+
 ////////////////////////////////////////////////////////////
 void InputSoundFile::close()
 {
@@ -243,6 +267,7 @@ void InputSoundFile::close()
     m_sampleCount = 0;
     m_channelCount = 0;
     m_sampleRate = 0;
+    m_bitsPerSample = 0;
 }
 
 } // namespace sf
@@ -27,19 +27,61 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Audio/Music.hpp>
 #include <SFML/Audio/ALCheck.hpp>
+#include <SFML/Audio/StreamScheduler.hpp>
 #include <SFML/System/Lock.hpp>
 #include <SFML/System/Err.hpp>
+#include <algorithm>
 #include <fstream>
 
 
 namespace sf
 {
+namespace priv
+{
 ////////////////////////////////////////////////////////////
-Music::Music() :
-m_file    (),
-m_duration()
+/// \brief Task of the streaming threads that decodes a music
+///        in advance, one block at a time
+///
+////////////////////////////////////////////////////////////
+class MusicReadAhead : public StreamTask
 {
+public:
+
+    MusicReadAhead(Music& music) :
+    m_music(music)
+    {
+    }
+
+    virtual bool run()
+    {
+        return m_music.decodeNextBlock();
+    }
+
+private:
+
+    Music& m_music; ///< Music to decode
+};
+
+} // namespace priv
 
+
+////////////////////////////////////////////////////////////
+Music::Music() :
+m_file             (),
+m_duration         (),
+m_readAheadTask    (NULL),
+m_readAhead        (Time::Zero),
+m_chunks           (),
+m_firstChunk       (0),
+m_readyChunks      (0),
+m_decodedCount     (0),
+m_chunkHanded      (false),
+m_chunkSize        (0),
+m_decodeFloat      (false),
+m_decodingEnded    (true),
+m_decodingCancelled(false)
+{
+    m_readAheadTask = new priv::MusicReadAhead(*this);
 }
 
 
@@ -48,6 +90,11 @@ Music::~Music()
 {
     // We must stop before destroying the file
     stop();
+
+    // Make sure that no streaming thread decodes the music anymore
+    cancelReadAhead();
+    priv::StreamScheduler::removeTask(*m_readAheadTask);
+    delete m_readAheadTask;
 }
 
 
@@ -57,6 +104,11 @@ bool Music::openFromFile(const std::string& filename)
     // First stop the music if it was already running
     stop();
 
+    // Make sure that the decoding thread doesn't use the file anymore
+    cancelReadAhead();
+    Lock lock(m_mutex);
+    resetReadAhead(false);
+
     // Open the underlying sound file
     if (!m_file.openFromFile(filename))
         return false;
@@ -74,6 +126,11 @@ bool Music::openFromMemory(const void* data, std::size_t sizeInBytes)
     // First stop the music if it was already running
     stop();
 
+    // Make sure that the decoding thread doesn't use the file anymore
+    cancelReadAhead();
+    Lock lock(m_mutex);
+    resetReadAhead(false);
+
     // Open the underlying sound file
     if (!m_file.openFromMemory(data, sizeInBytes))
         return false;
@@ -91,6 +148,11 @@ bool Music::openFromStream(InputStream& stream)
     // First stop the music if it was already running
     stop();
 
+    // Make sure that the decoding thread doesn't use the file anymore
+    cancelReadAhead();
+    Lock lock(m_mutex);
+    resetReadAhead(false);
+
     // Open the underlying sound file
     if (!m_file.openFromStream(stream))
         return false;
@@ -109,26 +171,125 @@ Time Music::getDuration() const
 }
 
 
+////////////////////////////////////////////////////////////
+void Music::setReadAheadDuration(Time duration)
+{
+    {
+        Lock lock(m_readAheadMutex);
+        m_readAhead = std::max(duration, Time::Zero);
+    }
+
+    // The task sleeps as long as there is nothing to decode in advance
+    if (duration > Time::Zero)
+        priv::StreamScheduler::addTask(*m_readAheadTask);
+}
+
+
+////////////////////////////////////////////////////////////
+Time Music::getReadAheadDuration() const
+{
+    Lock lock(m_readAheadMutex);
+    return m_readAhead;
+}
+
+
 ////////////////////////////////////////////////////////////
 bool Music::onGetData(SoundStream::Chunk& data)
 {
+    // Hand the chunks decoded in advance, if the read-ahead is enabled
+    for (;;)
+    {
+        bool slotFreed = false;
+        bool handed = false;
+        bool last = false;
+
+        {
+            Lock lock(m_readAheadMutex);
+
+            if (m_chunks.empty())
+                break;
+
+            // The previous chunk has been used by the stream: its slot can be decoded again
+            if (m_chunkHanded)
+            {
+                m_firstChunk = (m_firstChunk + 1) % m_chunks.size();
+                m_chunkHanded = false;
+                slotFreed = true;
+            }
+
+            if (m_readyChunks > 0)
+            {
+                const DecodedChunk& chunk = m_chunks[m_firstChunk];
+                if (m_decodeFloat)
+                    data.floatSamples = chunk.sampleCount ? &chunk.floatSamples[0] : NULL;
+                else
+                    data.samples = chunk.sampleCount ? &chunk.samples[0] : NULL;
+                data.sampleCount = chunk.sampleCount;
+
+                m_readyChunks--;
+                m_chunkHanded = true;
+                handed = true;
+                last = chunk.last;
+            }
+            else if (m_decodingEnded)
+            {
+                // Everything has been played
+                return false;
+            }
+        }
+
+        if (slotFreed)
+            priv::StreamScheduler::wakeTask(*m_readAheadTask);
+
+        if (handed)
+            return !last;
+
+        // The read-ahead task is late: decode the next chunk now rather than
+        // waiting for it, which may take long if the workers are busy; if the
+        // decoding was cancelled, the music is stopping
+        if (!decodeNextBlock())
+            return false;
+    }
+
     Lock lock(m_mutex);
 
-    // Fill the chunk parameters
-    data.samples     = &m_samples[0];
-    data.sampleCount = static_cast<std::size_t>(m_file.read(&m_samples[0], m_samples.size()));
+    // Size of one chunk of audio samples (at least one frame), following
+    // the chunk duration requested on the stream
+    std::size_t chunkSize = getChunkSampleCount();
+
+    // Fill the chunk parameters; decode directly to floating point
+    // samples if they can be played without conversion
+    if (isFloatPlaybackSupported())
+    {
+        m_floatSamples.resize(chunkSize);
+        data.floatSamples = &m_floatSamples[0];
+        data.sampleCount  = static_cast<std::size_t>(m_file.read(&m_floatSamples[0], chunkSize));
+    }
+    else
+    {
+        m_samples.resize(chunkSize);
+        data.samples     = &m_samples[0];
+        data.sampleCount = static_cast<std::size_t>(m_file.read(&m_samples[0], chunkSize));
+    }
 
     // Check if we have reached the end of the audio file
-    return data.sampleCount == m_samples.size();
+    return data.sampleCount == chunkSize;
 }
 
 
 ////////////////////////////////////////////////////////////
 void Music::onSeek(Time timeOffset)
 {
+    // Interrupt the chunk being decoded in advance, it is from the old position
+    cancelReadAhead();
+
     Lock lock(m_mutex);
 
     m_file.seek(timeOffset);
+
+    // Decode in advance from the new position
+    if (resetReadAhead(true))
+        priv::StreamScheduler::wakeTask(*m_readAheadTask);
 }
 
 
@@ -138,11 +299,130 @@ void Music::initialize()
     // Compute the music duration
     m_duration = m_file.getDuration();
 
-    // Resize the internal buffer so that it can contain 1 second of audio samples
-    m_samples.resize(m_file.getSampleRate() * m_file.getChannelCount());
-
     // Initialize the stream
     SoundStream::initialize(m_file.getChannelCount(), m_file.getSampleRate());
 }
 
+
+////////////////////////////////////////////////////////////
+std::size_t Music::getChunkSampleCount() const
+{
+    std::size_t frameCount = static_cast<std::size_t>(getChunkDuration().asSeconds() * m_file.getSampleRate());
+    return std::max(frameCount, std::size_t(1)) * m_file.getChannelCount();
+}
+
+
+////////////////////////////////////////////////////////////
+bool Music::resetReadAhead(bool decode)
+{
+    std::size_t chunkSize = getChunkSampleCount();
+    Time chunkDuration = getChunkDuration();
+
+    Lock lock(m_readAheadMutex);
+
+    // The chunk handed to the stream may still be in use (a looping stream seeks
+    // before playing the last chunk): move its samples to the buffers of the direct
+    // decoding, which are not used before the next call to onGetData; swapping the
+    // vectors keeps the samples at the same address
+    if (m_chunkHanded)
+    {
+        DecodedChunk& chunk = m_chunks[m_firstChunk];
+        m_samples.swap(chunk.samples);
+        m_floatSamples.swap(chunk.floatSamples);
+        m_chunkHanded = false;
+    }
+
+    // Enough chunks to cover the read-ahead duration, plus the one handed to the stream
+    std::size_t chunkCount = 0;
+    if (decode && (m_readAhead > Time::Zero) && (chunkDuration > Time::Zero))
+        chunkCount = static_cast<std::size_t>((m_readAhead.asMicroseconds() + chunkDuration.asMicroseconds() - 1) / chunkDuration.asMicroseconds()) + 1;
+
+    m_chunks.resize(chunkCount);
+    m_firstChunk = 0;
+
+    m_readyChunks       = 0;
+    m_decodedCount      = 0;
+    m_chunkSize         = chunkSize;
+    m_decodeFloat       = isFloatPlaybackSupported();
+    m_decodingEnded     = !decode;
+    m_decodingCancelled = false;
+
+    return !m_chunks.empty();
+}
+
+
+////////////////////////////////////////////////////////////
+void Music::cancelReadAhead()
+{
+    Lock lock(m_readAheadMutex);
+    m_decodingCancelled = true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Music::decodeNextBlock()
+{
+    Lock lock(m_mutex);
+
+    DecodedChunk* chunk = NULL;
+    std::size_t chunkSize = 0;
+    std::size_t count = 0;
+    bool decodeFloat = false;
+
+    // Find the slot being filled in the ring; the stream may free or take
+    // the chunks before it meanwhile, but that doesn't move it
+    {
+        Lock readAheadLock(m_readAheadMutex);
+
+        std::size_t used = m_readyChunks + (m_chunkHanded ? 1 : 0);
+        if (m_decodingCancelled || m_decodingEnded || (used >= m_chunks.size()))
+            return false;
+
+        chunk = &m_chunks[(m_firstChunk + used) % m_chunks.size()];
+        chunkSize = m_chunkSize;
+        count = m_decodedCount;
+        decodeFloat = m_decodeFloat;
+    }
+
+    if (count == 0)
+    {
+        if (decodeFloat)
+            chunk->floatSamples.resize(chunkSize);
+        else
+            chunk->samples.resize(chunkSize);
+    }
+
+    // Decode a single block, so that the streams serviced by the
+    // same worker are not delayed by a slow read from the source
+    const std::size_t blockSize = 4096 * m_file.getChannelCount();
+    std::size_t toRead = std::min(blockSize, chunkSize - count);
+    std::size_t read = 0;
+    if (decodeFloat)
+        read = static_cast<std::size_t>(m_file.read(&chunk->floatSamples[count], toRead));
+    else
+        read = static_cast<std::size_t>(m_file.read(&chunk->samples[count], toRead));
+    count += read;
+
+    Lock readAheadLock(m_readAheadMutex);
+
+    if (m_decodingCancelled)
+        return false;
+
+    // Publish the chunk once it is complete, or if the file ends
+    if ((read == toRead) && (count < chunkSize))
+    {
+        m_decodedCount = count;
+        return true;
+    }
+
+    chunk->sampleCount = count;
+    chunk->last = (count < chunkSize);
+    m_readyChunks++;
+    m_decodedCount = 0;
+    if (chunk->last)
+        m_decodingEnded = true;
+
+    return true;
+}
+
 } // namespace sf
@@ -0,0 +1,273 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/OfflineRenderer.hpp>
+#include <SFML/Audio/OutputSoundFile.hpp>
+#include <SFML/Audio/SoundStream.hpp>
+#include <SFML/Audio/SampleConversion.hpp>
+#include <SFML/System/Err.hpp>
+#include <algorithm>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+OfflineRenderer::OfflineRenderer(unsigned int channelCount, unsigned int sampleRate) :
+m_channelCount(channelCount),
+m_sampleRate  (sampleRate),
+m_mixer       (channelCount, sampleRate),
+m_streams     ()
+{
+    // The mixer validates the output format
+    m_channelCount = m_mixer.getChannelCount();
+    m_sampleRate   = m_mixer.getSampleRate();
+}
+
+
+////////////////////////////////////////////////////////////
+SoundMixer& OfflineRenderer::getMixer()
+{
+    return m_mixer;
+}
+
+
+////////////////////////////////////////////////////////////
+bool OfflineRenderer::addStream(SoundStream& stream, float volume, float pan)
+{
+    unsigned int channelCount = stream.getChannelCount();
+    if ((channelCount < 1) || (channelCount > 2))
+    {
+        err() << "Offline renderer only supports mono and stereo streams (" << channelCount << " channels)" << std::endl;
+        return false;
+    }
+
+    volume = std::min(std::max(volume, 0.f), 100.f) / 100.f;
+    pan = std::min(std::max(pan, -1.f), 1.f);
+
+    Stream data;
+    data.stream = &stream;
+    data.resampler = Resampler(channelCount, stream.getSampleRate(), m_sampleRate);
+    data.offset = 0;
+    data.ended  = false;
+
+    // Same routing as the mixer voices: balance on stereo outputs, average on mono outputs
+    if (m_channelCount == 2)
+    {
+        data.gains[0] = volume * std::min(1.f, 1.f - pan);
+        data.gains[1] = volume * std::min(1.f, 1.f + pan);
+    }
+    else
+    {
+        data.gains[0] = volume / channelCount;
+        data.gains[1] = 0.f;
+    }
+
+    // Render from the beginning
+    stream.onSeek(Time::Zero);
+
+    m_streams.push_back(data);
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool OfflineRenderer::isFinished() const
+{
+    if (m_mixer.getVoiceCount() > 0)
+        return false;
+
+    for (std::vector<Stream>::const_iterator it = m_streams.begin(); it != m_streams.end(); ++it)
+    {
+        if (!it->ended || (it->offset < it->samples.size()))
+            return false;
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t OfflineRenderer::render(float* samples, std::size_t frameCount)
+{
+    std::size_t renderedFrames = m_mixer.mix(samples, frameCount);
+
+    for (std::vector<Stream>::iterator it = m_streams.begin(); it != m_streams.end(); ++it)
+        renderedFrames = std::max(renderedFrames, renderStream(*it, samples, frameCount));
+
+    return renderedFrames;
+}
+
+
+////////////////////////////////////////////////////////////
+bool OfflineRenderer::renderToFile(const std::string& filename, Time maxDuration, bool floatSamples)
+{
+    OutputSoundFile file;
+    if (!file.openFromFile(filename, m_sampleRate, m_channelCount))
+        return false;
+
+    const std::size_t blockSize = 4096;
+    std::vector<float> samples(blockSize * m_channelCount);
+    std::vector<Int16> converted(floatSamples ? 0 : samples.size());
+
+    Uint64 remaining = static_cast<Uint64>(std::max(maxDuration.asSeconds(), 0.f) * m_sampleRate);
+    while ((remaining > 0) && !isFinished())
+    {
+        std::size_t frameCount = static_cast<std::size_t>(std::min<Uint64>(remaining, blockSize));
+
+        // Don't write the silence that follows the end of the last voice or stream
+        std::size_t renderedFrames = render(&samples[0], frameCount);
+        if (isFinished())
+            frameCount = renderedFrames;
+
+        std::size_t sampleCount = frameCount * m_channelCount;
+        if (floatSamples)
+        {
+            file.write(&samples[0], sampleCount);
+        }
+        else
+        {
+            priv::convertSamples(&samples[0], &converted[0], sampleCount);
+            file.write(&converted[0], sampleCount);
+        }
+
+        remaining -= frameCount;
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool OfflineRenderer::pullChunk(Stream& stream)
+{
+    stream.input.clear();
+    stream.samples.clear();
+    stream.offset = 0;
+
+    SoundStream::Chunk data = {NULL, 0, NULL};
+    bool more = stream.stream->onGetData(data);
+
+    // Store the chunk as floating point samples
+    if (data.sampleCount)
+    {
+        if (data.floatSamples)
+        {
+            stream.input.assign(data.floatSamples, data.floatSamples + data.sampleCount);
+        }
+        else if (data.samples)
+        {
+            stream.input.resize(data.sampleCount);
+            priv::convertSamples(data.samples, &stream.input[0], data.sampleCount);
+        }
+    }
+
+    if (!more)
+    {
+        // Restart looping streams, end the others after this chunk
+        if (stream.stream->getLoop())
+            stream.stream->onSeek(Time::Zero);
+        else
+            stream.ended = true;
+    }
+
+    // Convert the chunk to the sample rate of the renderer (the
+    // resampler copies it as is if the rates are the same)
+    const unsigned int channelCount = stream.stream->getChannelCount();
+    if (!stream.input.empty())
+        stream.resampler.process(&stream.input[0], stream.input.size() / channelCount, stream.samples);
+    if (stream.ended)
+        stream.resampler.flush(stream.samples);
+
+    return !stream.input.empty();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t OfflineRenderer::renderStream(Stream& stream, float* samples, std::size_t frameCount)
+{
+    const unsigned int channelCount = stream.stream->getChannelCount();
+
+    std::size_t done = 0;
+    while (done < frameCount)
+    {
+        // Get more data when the current chunk has been rendered
+        if (stream.offset >= stream.samples.size())
+        {
+            if (stream.ended)
+                return done;
+
+            // A stream that returns no data twice in a row (even after being
+            // restarted, if it loops) is considered as ended
+            if (!pullChunk(stream) && !stream.ended)
+            {
+                if (!pullChunk(stream) && !stream.ended)
+                {
+                    stream.ended = true;
+                    stream.resampler.flush(stream.samples);
+                }
+            }
+
+            continue;
+        }
+
+        const float* input = &stream.samples[stream.offset];
+        std::size_t count = std::min(frameCount - done, (stream.samples.size() - stream.offset) / channelCount);
+        if (count == 0)
+        {
+            // Incomplete frame at the end of the chunk
+            stream.offset = stream.samples.size();
+            continue;
+        }
+
+        float* output = samples + done * m_channelCount;
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            if (channelCount == m_channelCount)
+            {
+                for (unsigned int c = 0; c < m_channelCount; ++c)
+                    output[i * m_channelCount + c] += input[i * channelCount + c] * stream.gains[c];
+            }
+            else if (channelCount == 1)
+            {
+                output[i * 2]     += input[i] * stream.gains[0];
+                output[i * 2 + 1] += input[i] * stream.gains[1];
+            }
+            else
+            {
+                output[i] += (input[i * 2] + input[i * 2 + 1]) * stream.gains[0];
+            }
+        }
+
+        stream.offset += count * channelCount;
+        done += count;
+    }
+
+    return done;
+}
+
+} // namespace sf
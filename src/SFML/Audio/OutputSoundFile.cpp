@@ -77,6 +77,14 @@ void OutputSoundFile::write(const Int16* samples, Uint64 count)
 }
 
 
+////////////////////////////////////////////////////////////
+void OutputSoundFile::write(const float* samples, Uint64 count)
+{
+    if (m_writer && samples && count)
+        m_writer->write(samples, count);
+}
+
+
 ////////////////////////////////////////////////////////////
 void OutputSoundFile::close()
 {
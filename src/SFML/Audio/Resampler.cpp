@@ -0,0 +1,384 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/Resampler.hpp>
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+    #include <xmmintrin.h>
+    #define SFML_RESAMPLER_SSE
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+    #include <arm_neon.h>
+    #define SFML_RESAMPLER_NEON
+#endif
+
+
+namespace
+{
+    // Number of input frames used on each side of an output frame by the sinc filter, when upsampling
+    const std::size_t sincHalfTaps = 32;
+
+    // Number of precomputed fractional positions of the filter
+    const std::size_t phaseCount = 256;
+
+    // Cutoff frequency of the sinc filter, relative to the lowest Nyquist frequency
+    const double sincCutoff = 0.9;
+
+    const double pi = 3.14159265358979323846;
+
+    // Windowed sinc impulse response, x is in input frames
+    double windowedSinc(double x, double cutoff, double halfWidth)
+    {
+        double u = x / halfWidth;
+        if ((u <= -1.0) || (u >= 1.0))
+            return 0.0;
+
+        double sinc = (x == 0.0) ? 1.0 : std::sin(pi * cutoff * x) / (pi * cutoff * x);
+        double blackman = 0.42 + 0.5 * std::cos(pi * u) + 0.08 * std::cos(2.0 * pi * u);
+
+        return cutoff * sinc * blackman;
+    }
+
+    // Interpolate two rows of filter coefficients
+    void interpolateCoefficients(const float* row0, const float* row1, float t, float* coefficients, std::size_t taps)
+    {
+        std::size_t tap = 0;
+
+    #if defined(SFML_RESAMPLER_SSE)
+
+        __m128 t4 = _mm_set1_ps(t);
+        for (; tap + 4 <= taps; tap += 4)
+        {
+            __m128 a = _mm_loadu_ps(row0 + tap);
+            __m128 b = _mm_loadu_ps(row1 + tap);
+            _mm_storeu_ps(coefficients + tap, _mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(b, a), t4)));
+        }
+
+    #elif defined(SFML_RESAMPLER_NEON)
+
+        float32x4_t t4 = vdupq_n_f32(t);
+        for (; tap + 4 <= taps; tap += 4)
+        {
+            float32x4_t a = vld1q_f32(row0 + tap);
+            float32x4_t b = vld1q_f32(row1 + tap);
+            vst1q_f32(coefficients + tap, vmlaq_f32(a, vsubq_f32(b, a), t4));
+        }
+
+    #endif
+
+        for (; tap < taps; ++tap)
+            coefficients[tap] = row0[tap] + (row1[tap] - row0[tap]) * t;
+    }
+
+    // Apply the filter to interleaved input frames, writing one sum per channel;
+    // mono and stereo, the common cases, process 4 taps at a time
+    void convolve(const float* frame, const float* coefficients, std::size_t taps, std::size_t channelCount, float* sums)
+    {
+        std::size_t tap = 0;
+
+        for (std::size_t channel = 0; channel < channelCount; ++channel)
+            sums[channel] = 0.f;
+
+    #if defined(SFML_RESAMPLER_SSE)
+
+        if (channelCount == 1)
+        {
+            __m128 sum = _mm_setzero_ps();
+            for (; tap + 4 <= taps; tap += 4)
+                sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(frame + tap), _mm_loadu_ps(coefficients + tap)));
+
+            float lanes[4];
+            _mm_storeu_ps(lanes, sum);
+            sums[0] = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+        }
+        else if (channelCount == 2)
+        {
+            // Each coefficient is duplicated to match the left / right pairs of the frames
+            __m128 sum = _mm_setzero_ps();
+            for (; tap + 4 <= taps; tap += 4)
+            {
+                __m128 c = _mm_loadu_ps(coefficients + tap);
+                sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(frame + tap * 2), _mm_unpacklo_ps(c, c)));
+                sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(frame + tap * 2 + 4), _mm_unpackhi_ps(c, c)));
+            }
+
+            float lanes[4];
+            _mm_storeu_ps(lanes, sum);
+            sums[0] = lanes[0] + lanes[2];
+            sums[1] = lanes[1] + lanes[3];
+        }
+
+    #elif defined(SFML_RESAMPLER_NEON)
+
+        if (channelCount == 1)
+        {
+            float32x4_t sum = vdupq_n_f32(0.f);
+            for (; tap + 4 <= taps; tap += 4)
+                sum = vmlaq_f32(sum, vld1q_f32(frame + tap), vld1q_f32(coefficients + tap));
+
+            float lanes[4];
+            vst1q_f32(lanes, sum);
+            sums[0] = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+        }
+        else if (channelCount == 2)
+        {
+            // Each coefficient is duplicated to match the left / right pairs of the frames
+            float32x4_t sum = vdupq_n_f32(0.f);
+            for (; tap + 4 <= taps; tap += 4)
+            {
+                float32x4_t c = vld1q_f32(coefficients + tap);
+                float32x4x2_t pairs = vzipq_f32(c, c);
+                sum = vmlaq_f32(sum, vld1q_f32(frame + tap * 2), pairs.val[0]);
+                sum = vmlaq_f32(sum, vld1q_f32(frame + tap * 2 + 4), pairs.val[1]);
+            }
+
+            float lanes[4];
+            vst1q_f32(lanes, sum);
+            sums[0] = lanes[0] + lanes[2];
+            sums[1] = lanes[1] + lanes[3];
+        }
+
+    #endif
+
+        // Remaining taps, or every tap for other channel counts
+        for (; tap < taps; ++tap)
+        {
+            const float* input = frame + tap * channelCount;
+            for (std::size_t channel = 0; channel < channelCount; ++channel)
+                sums[channel] += input[channel] * coefficients[tap];
+        }
+    }
+}
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+Resampler::Resampler() :
+m_channelCount(1),
+m_inputRate   (1),
+m_outputRate  (1),
+m_quality     (Sinc),
+m_halfTaps    (0),
+m_filter      (),
+m_buffer      (),
+m_index       (0),
+m_fraction    (0)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+Resampler::Resampler(unsigned int channelCount, unsigned int inputRate, unsigned int outputRate, Quality quality) :
+m_channelCount(std::max(channelCount, 1u)),
+m_inputRate   (std::max(inputRate, 1u)),
+m_outputRate  (std::max(outputRate, 1u)),
+m_quality     (quality),
+m_halfTaps    (0),
+m_filter      (),
+m_buffer      (),
+m_index       (0),
+m_fraction    (0)
+{
+    if (m_inputRate != m_outputRate)
+    {
+        if (m_quality == Linear)
+        {
+            m_halfTaps = 1;
+        }
+        else
+        {
+            // When downsampling, the cutoff moves down to the output Nyquist frequency
+            // and the filter gets wider so that its transition band stays as steep
+            double ratio = std::min(1.0, static_cast<double>(m_outputRate) / m_inputRate);
+            double cutoff = sincCutoff * ratio;
+            m_halfTaps = static_cast<std::size_t>(std::ceil(sincHalfTaps / ratio));
+
+            // Precompute one row of coefficients per phase, plus one for the phase
+            // interpolation of the last one; each row is normalized to a unit gain
+            std::size_t taps = 2 * m_halfTaps;
+            m_filter.resize((phaseCount + 1) * taps);
+            for (std::size_t phase = 0; phase <= phaseCount; ++phase)
+            {
+                float* row = &m_filter[phase * taps];
+                double offset = static_cast<double>(phase) / phaseCount;
+                double sum = 0.0;
+
+                for (std::size_t tap = 0; tap < taps; ++tap)
+                {
+                    double x = static_cast<double>(tap) - static_cast<double>(m_halfTaps - 1) - offset;
+                    double value = windowedSinc(x, cutoff, static_cast<double>(m_halfTaps));
+                    row[tap] = static_cast<float>(value);
+                    sum += value;
+                }
+
+                for (std::size_t tap = 0; tap < taps; ++tap)
+                    row[tap] = static_cast<float>(row[tap] / sum);
+            }
+        }
+    }
+
+    reset();
+}
+
+
+////////////////////////////////////////////////////////////
+void Resampler::reset()
+{
+    // The first output frame is aligned on the first input frame: the frames
+    // before it, needed by the filter, are silent
+    std::size_t history = (m_halfTaps > 0) ? m_halfTaps - 1 : 0;
+    m_buffer.assign(history * m_channelCount, 0.f);
+    m_index = history;
+    m_fraction = 0;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t Resampler::process(const float* samples, std::size_t frameCount, std::vector<float>& output)
+{
+    if (!samples || (frameCount == 0))
+        return 0;
+
+    // Same rates: nothing to convert
+    if (m_halfTaps == 0)
+    {
+        output.insert(output.end(), samples, samples + frameCount * m_channelCount);
+        return frameCount;
+    }
+
+    m_buffer.insert(m_buffer.end(), samples, samples + frameCount * m_channelCount);
+
+    // Each output frame needs the m_halfTaps input frames that follow it
+    std::size_t frames = m_buffer.size() / m_channelCount;
+    std::size_t end = (frames > m_halfTaps) ? frames - m_halfTaps : 0;
+
+    return produce(output, end);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t Resampler::flush(std::vector<float>& output)
+{
+    if (m_halfTaps == 0)
+        return 0;
+
+    // Complete the pending input with silence, and produce the output
+    // frames up to the end of the actual input
+    std::size_t end = m_buffer.size() / m_channelCount;
+    m_buffer.resize(m_buffer.size() + m_halfTaps * m_channelCount, 0.f);
+
+    std::size_t count = produce(output, end);
+    reset();
+
+    return count;
+}
+
+
+////////////////////////////////////////////////////////////
+void Resampler::resample(const float* samples, std::size_t frameCount, unsigned int channelCount, unsigned int inputRate,
+                         unsigned int outputRate, std::vector<float>& output, Quality quality)
+{
+    output.clear();
+
+    Resampler resampler(channelCount, inputRate, outputRate, quality);
+
+    // Reserve the exact output size: ceil(frameCount * outputRate / inputRate) frames
+    std::size_t outputFrames = static_cast<std::size_t>((static_cast<double>(frameCount) * resampler.m_outputRate + resampler.m_inputRate - 1) / resampler.m_inputRate);
+    output.reserve(outputFrames * resampler.m_channelCount);
+
+    resampler.process(samples, frameCount, output);
+    resampler.flush(output);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t Resampler::produce(std::vector<float>& output, std::size_t end)
+{
+    const std::size_t channelCount = m_channelCount;
+    const std::size_t taps = 2 * m_halfTaps;
+    const std::size_t step = m_inputRate / m_outputRate;
+    const std::size_t fractionStep = m_inputRate % m_outputRate;
+    const double fractionScale = 1.0 / m_outputRate;
+
+    std::vector<float> coefficients(m_quality == Linear ? 0 : taps);
+    std::vector<float> sums(channelCount);
+    std::size_t count = 0;
+
+    while (m_index < end)
+    {
+        const float* frame = &m_buffer[(m_index + 1 - m_halfTaps) * channelCount];
+        double fraction = m_fraction * fractionScale;
+
+        if (m_quality == Linear)
+        {
+            float t = static_cast<float>(fraction);
+            for (std::size_t channel = 0; channel < channelCount; ++channel)
+            {
+                float a = frame[channel];
+                float b = frame[channelCount + channel];
+                output.push_back(a + (b - a) * t);
+            }
+        }
+        else
+        {
+            // Interpolate the coefficients between the two nearest phases
+            double position = fraction * phaseCount;
+            std::size_t phase = static_cast<std::size_t>(position);
+            float t = static_cast<float>(position - phase);
+            const float* row0 = &m_filter[phase * taps];
+            interpolateCoefficients(row0, row0 + taps, t, &coefficients[0], taps);
+
+            convolve(frame, &coefficients[0], taps, channelCount, &sums[0]);
+            output.insert(output.end(), sums.begin(), sums.end());
+        }
+
+        // Advance by inputRate / outputRate input frames, with an exact fraction
+        m_index += step;
+        m_fraction += fractionStep;
+        if (m_fraction >= m_outputRate)
+        {
+            m_fraction -= m_outputRate;
+            ++m_index;
+        }
+
+        ++count;
+    }
+
+    // Drop the input frames that no output frame will need anymore
+    if (m_index + 1 > m_halfTaps)
+    {
+        std::size_t consumed = std::min(m_index + 1 - m_halfTaps, m_buffer.size() / channelCount);
+        m_buffer.erase(m_buffer.begin(), m_buffer.begin() + consumed * channelCount);
+        m_index -= consumed;
+    }
+
+    return count;
+}
+
+} // namespace sf
@@ -0,0 +1,63 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/SampleConversion.hpp>
+
+
+namespace sf
+{
+namespace priv
+{
+////////////////////////////////////////////////////////////
+void convertSamples(const Int16* input, float* output, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; ++i)
+        output[i] = input[i] * (1.f / 32768.f);
+}
+
+
+////////////////////////////////////////////////////////////
+void convertSamples(const float* input, Int16* output, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        // Clip to the valid range (NaN gives silence)
+        float value = input[i];
+        if (value > 1.f)
+            value = 1.f;
+        else if (value < -1.f)
+            value = -1.f;
+        else if (value != value)
+            value = 0.f;
+
+        output[i] = static_cast<Int16>(value * 32767.f);
+    }
+}
+
+} // namespace priv
+
+} // namespace sf
@@ -0,0 +1,68 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_SAMPLECONVERSION_HPP
+#define SFML_SAMPLECONVERSION_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Config.hpp>
+#include <cstddef>
+
+
+namespace sf
+{
+namespace priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Convert 16 bit integer samples to floating point samples
+///
+/// The output samples are in the range [-1, 1[.
+///
+/// \param input  Samples to convert
+/// \param output Array to fill with the converted samples
+/// \param count  Number of samples to convert
+///
+////////////////////////////////////////////////////////////
+void convertSamples(const Int16* input, float* output, std::size_t count);
+
+////////////////////////////////////////////////////////////
+/// \brief Convert floating point samples to 16 bit integer samples
+///
+/// Input samples outside the range [-1, 1] are clipped.
+///
+/// \param input  Samples to convert
+/// \param output Array to fill with the converted samples
+/// \param count  Number of samples to convert
+///
+////////////////////////////////////////////////////////////
+void convertSamples(const float* input, Int16* output, std::size_t count);
+
+} // namespace priv
+
+} // namespace sf
+
+
+#endif // SFML_SAMPLECONVERSION_HPP
@@ -34,14 +34,18 @@ namespace sf
 {
 ////////////////////////////////////////////////////////////
 Sound::Sound() :
-m_buffer(NULL)
+m_buffer       (NULL),
+m_previousSound(NULL),
+m_nextSound    (NULL)
 {
 }
 
 
 ////////////////////////////////////////////////////////////
 Sound::Sound(const SoundBuffer& buffer) :
-m_buffer(NULL)
+m_buffer       (NULL),
+m_previousSound(NULL),
+m_nextSound    (NULL)
 {
     setBuffer(buffer);
 }
@@ -49,8 +53,10 @@ m_buffer(NULL)
 
 ////////////////////////////////////////////////////////////
 Sound::Sound(const Sound& copy) :
-SoundSource(copy),
-m_buffer   (NULL)
+SoundSource    (copy),
+m_buffer       (NULL),
+m_previousSound(NULL),
+m_nextSound    (NULL)
 {
     if (copy.m_buffer)
         setBuffer(*copy.m_buffer);
@@ -31,7 +31,10 @@
 #include <SFML/Audio/Sound.hpp>
 #include <SFML/Audio/AudioDevice.hpp>
 #include <SFML/Audio/ALCheck.hpp>
+#include <SFML/Audio/SampleConversion.hpp>
 #include <SFML/System/Err.hpp>
+#include <SFML/System/Lock.hpp>
+#include <algorithm>
 #include <memory>
 
 
@@ -39,8 +42,20 @@ namespace sf
 {
 ////////////////////////////////////////////////////////////
 SoundBuffer::SoundBuffer() :
-m_buffer  (0),
-m_duration()
+m_buffer         (0),
+m_samples        (),
+m_floatSamples   (),
+m_isFloat        (false),
+m_floatDecoding  (false),
+m_duration       (),
+m_channelCount   (0),
+m_sampleRate     (0),
+m_sounds         (NULL),
+m_filename       (),
+m_sampleCount    (0),
+m_samplesReleased(false),
+m_mixerVoices    (0),
+m_mutex          ()
 {
     // Create the buffer
     alCheck(alGenBuffers(1, &m_buffer));
@@ -49,31 +64,51 @@ m_duration()
 
 ////////////////////////////////////////////////////////////
 SoundBuffer::SoundBuffer(const SoundBuffer& copy) :
-m_buffer  (0),
-m_samples (copy.m_samples),
-m_duration(copy.m_duration),
-m_sounds  () // don't copy the attached sounds
+m_buffer         (0),
+m_samples        (),
+m_floatSamples   (),
+m_isFloat        (copy.m_isFloat),
+m_floatDecoding  (copy.m_floatDecoding),
+m_duration       (copy.m_duration),
+m_channelCount   (0),
+m_sampleRate     (0),
+m_sounds         (NULL), // don't copy the attached sounds
+m_filename       (copy.m_filename),
+m_sampleCount    (0),
+m_samplesReleased(false),
+m_mixerVoices    (0), // don't copy the mixer voices either
+m_mutex          ()
 {
     // Create the buffer
     alCheck(alGenBuffers(1, &m_buffer));
 
+    // Copy the samples, decoding them again if they were released; conversions are not copied
+    {
+        Lock lock(copy.m_mutex);
+        copy.reloadSamples();
+        if (m_isFloat)
+            m_floatSamples = copy.m_floatSamples;
+        else
+            m_samples = copy.m_samples;
+    }
+
     // Update the internal buffer with the new samples
-    update(copy.getChannelCount(), copy.getSampleRate());
+    update(copy.m_channelCount, copy.m_sampleRate);
 }
 
 
 ////////////////////////////////////////////////////////////
 SoundBuffer::~SoundBuffer()
 {
-    // To prevent the iterator from becoming invalid, move the entire buffer to another
-    // container. Otherwise calling resetBuffer would result in detachSound being
-    // called which removes the sound from the internal list.
-    SoundList sounds;
-    sounds.swap(m_sounds);
-
-    // Detach the buffer from the sounds that use it (to avoid OpenAL errors)
-    for (SoundList::const_iterator it = sounds.begin(); it != sounds.end(); ++it)
-        (*it)->resetBuffer();
+    // Detach the buffer from the sounds that use it (to avoid OpenAL errors); the sounds
+    // are removed from the list first, as after an assignment they may still point to
+    // the other buffer, which would then fail to remove them
+    while (m_sounds)
+    {
+        Sound* sound = m_sounds;
+        detachSound(sound);
+        sound->resetBuffer();
+    }
 
     // Destroy the buffer
     if (m_buffer)
@@ -85,10 +120,16 @@ SoundBuffer::~SoundBuffer()
 bool SoundBuffer::loadFromFile(const std::string& filename)
 {
     InputSoundFile file;
-    if (file.openFromFile(filename))
-        return initialize(file);
+    if (file.openFromFile(filename) && initialize(file))
+    {
+        // Remember the file, to be able to decode the samples again if they are released
+        m_filename = filename;
+        return true;
+    }
     else
+    {
         return false;
+    }
 }
 
 
@@ -121,6 +162,9 @@ bool SoundBuffer::loadFromSamples(const Int16* samples, Uint64 sampleCount, unsi
     {
         // Copy the new audio samples
         m_samples.assign(samples, samples + sampleCount);
+        std::vector<float>().swap(m_floatSamples);
+        m_isFloat = false;
+        m_filename.clear();
 
         // Update the internal buffer with the new samples
         return update(channelCount, sampleRate);
@@ -140,15 +184,162 @@ bool SoundBuffer::loadFromSamples(const Int16* samples, Uint64 sampleCount, unsi
 }
 
 
+////////////////////////////////////////////////////////////
+bool SoundBuffer::loadFromSamples(const float* samples, Uint64 sampleCount, unsigned int channelCount, unsigned int sampleRate)
+{
+    if (samples && sampleCount && channelCount && sampleRate)
+    {
+        // Copy the new audio samples
+        m_floatSamples.assign(samples, samples + sampleCount);
+        std::vector<Int16>().swap(m_samples);
+        m_isFloat = true;
+        m_filename.clear();
+
+        // Update the internal buffer with the new samples
+        return update(channelCount, sampleRate);
+    }
+    else
+    {
+        // Error...
+        err() << "Failed to load sound buffer from samples ("
+              << "array: "      << samples      << ", "
+              << "count: "      << sampleCount  << ", "
+              << "channels: "   << channelCount << ", "
+              << "samplerate: " << sampleRate   << ")"
+              << std::endl;
+
+        return false;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundBuffer::setFloatDecoding(bool enabled)
+{
+    m_floatDecoding = enabled;
+}
+
+
+////////////////////////////////////////////////////////////
+bool SoundBuffer::isFloatDecoding() const
+{
+    return m_floatDecoding;
+}
+
+
+////////////////////////////////////////////////////////////
+bool SoundBuffer::resample(unsigned int sampleRate, Resampler::Quality quality)
+{
+    unsigned int channelCount = getChannelCount();
+    unsigned int currentRate = getSampleRate();
+    std::size_t sampleCount = static_cast<std::size_t>(getSampleCount());
+
+    if (!sampleRate || !sampleCount || !channelCount || !currentRate)
+    {
+        err() << "Failed to resample sound buffer (empty buffer or invalid sample rate)" << std::endl;
+        return false;
+    }
+
+    if (sampleRate == currentRate)
+        return true;
+
+    // The conversion is done in floating point; 16 bits samples are converted
+    // to a temporary array, so that no conversion is left in the buffer
+    Lock lock(m_mutex);
+    reloadSamples();
+    std::vector<float> input;
+    if (!m_isFloat)
+    {
+        input.resize(m_samples.size());
+        if (!input.empty())
+            priv::convertSamples(&m_samples[0], &input[0], input.size());
+    }
+    const std::vector<float>& samples = m_isFloat ? m_floatSamples : input;
+    if (samples.size() != sampleCount)
+        return false;
+
+    std::vector<float> output;
+    Resampler::resample(&samples[0], sampleCount / channelCount, channelCount, currentRate, sampleRate, output, quality);
+
+    // Store the result in the original format, and drop the cached conversion
+    if (m_isFloat)
+    {
+        m_floatSamples.swap(output);
+        std::vector<Int16>().swap(m_samples);
+    }
+    else
+    {
+        m_samples.resize(output.size());
+        if (!output.empty())
+            priv::convertSamples(&output[0], &m_samples[0], output.size());
+        std::vector<float>().swap(m_floatSamples);
+    }
+
+    // The samples don't match their file anymore
+    m_filename.clear();
+
+    return update(channelCount, sampleRate);
+}
+
+
+////////////////////////////////////////////////////////////
+bool SoundBuffer::releaseSamples()
+{
+    Lock lock(m_mutex);
+
+    if (m_filename.empty())
+    {
+        err() << "Failed to release the samples of a sound buffer (they were not loaded from a file)" << std::endl;
+        return false;
+    }
+
+    if (m_mixerVoices > 0)
+    {
+        err() << "Failed to release the samples of a sound buffer (they are played by a sound mixer)" << std::endl;
+        return false;
+    }
+
+    // Swap with empty vectors to actually free the memory
+    std::vector<Int16>().swap(m_samples);
+    std::vector<float>().swap(m_floatSamples);
+    m_samplesReleased = true;
+
+    return true;
+}
+
+
 ////////////////////////////////////////////////////////////
 bool SoundBuffer::saveToFile(const std::string& filename) const
 {
+    // Make sure that the samples are available (they may fail to be decoded again)
+    Lock lock(m_mutex);
+    reloadSamples();
+    if (m_sampleCount == 0)
+    {
+        err() << "Failed to save sound buffer to \"" << filename << "\" (no samples)" << std::endl;
+        return false;
+    }
+
     // Create the sound file in write mode
     OutputSoundFile file;
     if (file.openFromFile(filename, getSampleRate(), getChannelCount()))
     {
-        // Write the samples to the opened file
-        file.write(&m_samples[0], m_samples.size());
+        // Write the samples to the opened file; floating point samples
+        // are converted by blocks, so that no conversion is left in the buffer
+        if (m_isFloat)
+        {
+            Int16 block[4096];
+            for (std::size_t offset = 0; offset < m_floatSamples.size(); offset += 4096)
+            {
+                std::size_t count = std::min<std::size_t>(4096, m_floatSamples.size() - offset);
+                priv::convertSamples(&m_floatSamples[offset], block, count);
+                file.write(block, count);
+            }
+        }
+        else
+        {
+            file.write(&m_samples[0], m_samples.size());
+        }
 
         return true;
     }
@@ -162,34 +353,61 @@ bool SoundBuffer::saveToFile(const std::string& filename) const
 ////////////////////////////////////////////////////////////
 const Int16* SoundBuffer::getSamples() const
 {
+    Lock lock(m_mutex);
+
+    reloadSamples();
+
+    // Convert the floating point samples on first access
+    if (m_isFloat && (m_samples.size() != m_floatSamples.size()))
+    {
+        m_samples.resize(m_floatSamples.size());
+        if (!m_floatSamples.empty())
+            priv::convertSamples(&m_floatSamples[0], &m_samples[0], m_floatSamples.size());
+    }
+
     return m_samples.empty() ? NULL : &m_samples[0];
 }
 
 
+////////////////////////////////////////////////////////////
+const float* SoundBuffer::getFloatSamples() const
+{
+    Lock lock(m_mutex);
+
+    reloadSamples();
+
+    // Convert the 16 bits samples on first access
+    if (!m_isFloat && (m_floatSamples.size() != m_samples.size()))
+    {
+        m_floatSamples.resize(m_samples.size());
+        if (!m_samples.empty())
+            priv::convertSamples(&m_samples[0], &m_floatSamples[0], m_samples.size());
+    }
+
+    return m_floatSamples.empty() ? NULL : &m_floatSamples[0];
+}
+
+
 ////////////////////////////////////////////////////////////
 Uint64 SoundBuffer::getSampleCount() const
 {
-    return m_samples.size();
+    Lock lock(m_mutex);
+
+    return m_sampleCount;
 }
 
 
 ////////////////////////////////////////////////////////////
 unsigned int SoundBuffer::getSampleRate() const
 {
-    ALint sampleRate;
-    alCheck(alGetBufferi(m_buffer, AL_FREQUENCY, &sampleRate));
-
-    return sampleRate;
+    return m_sampleRate;
 }
 
 
 ////////////////////////////////////////////////////////////
 unsigned int SoundBuffer::getChannelCount() const
 {
-    ALint channelCount;
-    alCheck(alGetBufferi(m_buffer, AL_CHANNELS, &channelCount));
-
-    return channelCount;
+    return m_channelCount;
 }
 
 
@@ -205,10 +423,18 @@ SoundBuffer& SoundBuffer::operator =(const SoundBuffer& right)
 {
     SoundBuffer temp(right);
 
-    std::swap(m_samples,  temp.m_samples);
-    std::swap(m_buffer,   temp.m_buffer);
-    std::swap(m_duration, temp.m_duration);
-    std::swap(m_sounds,   temp.m_sounds); // swap sounds too, so that they are detached when temp is destroyed
+    std::swap(m_samples,         temp.m_samples);
+    std::swap(m_floatSamples,    temp.m_floatSamples);
+    std::swap(m_isFloat,         temp.m_isFloat);
+    std::swap(m_floatDecoding,   temp.m_floatDecoding);
+    std::swap(m_buffer,          temp.m_buffer);
+    std::swap(m_duration,        temp.m_duration);
+    std::swap(m_channelCount,    temp.m_channelCount);
+    std::swap(m_sampleRate,      temp.m_sampleRate);
+    std::swap(m_sounds,          temp.m_sounds); // swap sounds too, so that they are detached when temp is destroyed
+    std::swap(m_filename,        temp.m_filename);
+    std::swap(m_sampleCount,     temp.m_sampleCount);
+    std::swap(m_samplesReleased, temp.m_samplesReleased);
 
     return *this;
 }
@@ -222,17 +448,35 @@ bool SoundBuffer::initialize(InputSoundFile& file)
     unsigned int channelCount = file.getChannelCount();
     unsigned int sampleRate   = file.getSampleRate();
 
-    // Read the samples from the provided file
-    m_samples.resize(static_cast<std::size_t>(sampleCount));
-    if (file.read(&m_samples[0], sampleCount) == sampleCount)
+    // Samples more precise than 16 bits (or of unknown precision, if requested) are
+    // decoded to floating point, unless the device would convert them to 16 bits anyway
+    unsigned int bitsPerSample = file.getBitsPerSample();
+    bool precise = (bitsPerSample > 16) || ((bitsPerSample == 0) && m_floatDecoding);
+    m_isFloat = precise && priv::AudioDevice::getFloatFormatFromChannelCount(channelCount);
+    m_filename.clear();
+
+    // Read the samples from the provided file, and drop the samples of the other type
+    Uint64 readCount = 0;
+    if (m_isFloat)
     {
-        // Update the internal buffer with the new samples
-        return update(channelCount, sampleRate);
+        std::vector<Int16>().swap(m_samples);
+        m_floatSamples.resize(static_cast<std::size_t>(sampleCount));
+        if (sampleCount)
+            readCount = file.read(&m_floatSamples[0], sampleCount);
     }
     else
     {
-        return false;
+        std::vector<float>().swap(m_floatSamples);
+        m_samples.resize(static_cast<std::size_t>(sampleCount));
+        if (sampleCount)
+            readCount = file.read(&m_samples[0], sampleCount);
     }
+
+    // Update the internal buffer with the new samples
+    if (readCount == sampleCount)
+        return update(channelCount, sampleRate);
+    else
+        return false;
 }
 
 
@@ -240,11 +484,15 @@ bool SoundBuffer::initialize(InputSoundFile& file)
 bool SoundBuffer::update(unsigned int channelCount, unsigned int sampleRate)
 {
     // Check parameters
-    if (!channelCount || !sampleRate || m_samples.empty())
+    Uint64 sampleCount = m_isFloat ? m_floatSamples.size() : m_samples.size();
+    if (!channelCount || !sampleRate || !sampleCount)
         return false;
 
+    // Floating point samples are played as is if the device supports them
+    ALenum floatFormat = m_isFloat ? priv::AudioDevice::getFloatFormatFromChannelCount(channelCount) : 0;
+
     // Find the good format according to the number of channels
-    ALenum format = priv::AudioDevice::getFormatFromChannelCount(channelCount);
+    ALenum format = floatFormat ? floatFormat : priv::AudioDevice::getFormatFromChannelCount(channelCount);
 
     // Check if the format is valid
     if (format == 0)
@@ -253,23 +501,44 @@ bool SoundBuffer::update(unsigned int channelCount, unsigned int sampleRate)
         return false;
     }
 
-    // First make a copy of the list of sounds so we can reattach later
-    SoundList sounds(m_sounds);
-
-    // Detach the buffer from the sounds that use it (to avoid OpenAL errors)
-    for (SoundList::const_iterator it = sounds.begin(); it != sounds.end(); ++it)
-        (*it)->resetBuffer();
+    // Detach the buffer from the sounds that use it (to avoid OpenAL errors); they
+    // stay in the list so that the buffer can be reattached afterwards
+    for (Sound* sound = m_sounds; sound; sound = sound->m_nextSound)
+    {
+        sound->stop();
+        alCheck(alSourcei(sound->m_source, AL_BUFFER, 0));
+    }
 
     // Fill the buffer
-    ALsizei size = static_cast<ALsizei>(m_samples.size()) * sizeof(Int16);
-    alCheck(alBufferData(m_buffer, format, &m_samples[0], size, sampleRate));
+    if (floatFormat)
+    {
+        ALsizei size = static_cast<ALsizei>(sampleCount) * sizeof(float);
+        alCheck(alBufferData(m_buffer, format, &m_floatSamples[0], size, sampleRate));
+    }
+    else if (m_isFloat)
+    {
+        // The device can't play floating point samples: upload a temporary 16 bits conversion
+        std::vector<Int16> samples(static_cast<std::size_t>(sampleCount));
+        priv::convertSamples(&m_floatSamples[0], &samples[0], samples.size());
+        ALsizei size = static_cast<ALsizei>(sampleCount) * sizeof(Int16);
+        alCheck(alBufferData(m_buffer, format, &samples[0], size, sampleRate));
+    }
+    else
+    {
+        ALsizei size = static_cast<ALsizei>(sampleCount) * sizeof(Int16);
+        alCheck(alBufferData(m_buffer, format, &m_samples[0], size, sampleRate));
+    }
 
-    // Compute the duration
-    m_duration = seconds(static_cast<float>(m_samples.size()) / sampleRate / channelCount);
+    // Compute the duration, and keep the format so that it can be queried without the audio device
+    m_channelCount = channelCount;
+    m_sampleRate = sampleRate;
+    m_sampleCount = sampleCount;
+    m_samplesReleased = false;
+    m_duration = seconds(static_cast<float>(sampleCount) / sampleRate / channelCount);
 
     // Now reattach the buffer to the sounds that use it
-    for (SoundList::const_iterator it = sounds.begin(); it != sounds.end(); ++it)
-        (*it)->setBuffer(*this);
+    for (Sound* sound = m_sounds; sound; sound = sound->m_nextSound)
+        alCheck(alSourcei(sound->m_source, AL_BUFFER, m_buffer));
 
     return true;
 }
@@ -278,14 +547,86 @@ bool SoundBuffer::update(unsigned int channelCount, unsigned int sampleRate)
 ////////////////////////////////////////////////////////////
 void SoundBuffer::attachSound(Sound* sound) const
 {
-    m_sounds.insert(sound);
+    // Insert the sound at the front of the list
+    sound->m_previousSound = NULL;
+    sound->m_nextSound = m_sounds;
+    if (m_sounds)
+        m_sounds->m_previousSound = sound;
+    m_sounds = sound;
 }
 
 
 ////////////////////////////////////////////////////////////
 void SoundBuffer::detachSound(Sound* sound) const
 {
-    m_sounds.erase(sound);
+    // Sounds that are not in the list are ignored
+    if (sound->m_previousSound)
+        sound->m_previousSound->m_nextSound = sound->m_nextSound;
+    else if (m_sounds == sound)
+        m_sounds = sound->m_nextSound;
+    else
+        return;
+
+    if (sound->m_nextSound)
+        sound->m_nextSound->m_previousSound = sound->m_previousSound;
+
+    sound->m_previousSound = NULL;
+    sound->m_nextSound = NULL;
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundBuffer::reloadSamples() const
+{
+    Lock lock(m_mutex);
+
+    if (!m_samplesReleased)
+        return;
+
+    // Don't try again on every access if decoding fails
+    m_samplesReleased = false;
+
+    // Decode the samples to the type they were stored as
+    InputSoundFile file;
+    if (file.openFromFile(m_filename) && m_sampleCount)
+    {
+        if (m_isFloat)
+        {
+            m_floatSamples.resize(static_cast<std::size_t>(m_sampleCount));
+            if (file.read(&m_floatSamples[0], m_sampleCount) == m_sampleCount)
+                return;
+        }
+        else
+        {
+            m_samples.resize(static_cast<std::size_t>(m_sampleCount));
+            if (file.read(&m_samples[0], m_sampleCount) == m_sampleCount)
+                return;
+        }
+    }
+
+    // Leave the buffer consistently empty, so that its users don't read missing samples
+    err() << "Failed to decode the released samples of sound buffer again from \"" << m_filename << "\"" << std::endl;
+    std::vector<Int16>().swap(m_samples);
+    std::vector<float>().swap(m_floatSamples);
+    m_sampleCount = 0;
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundBuffer::addMixerVoice() const
+{
+    Lock lock(m_mutex);
+
+    m_mixerVoices++;
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundBuffer::removeMixerVoice() const
+{
+    Lock lock(m_mutex);
+
+    m_mixerVoices--;
 }
 
 } // namespace sf
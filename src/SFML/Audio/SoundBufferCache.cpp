@@ -0,0 +1,153 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/SoundBufferCache.hpp>
+#include <SFML/Audio/SoundBuffer.hpp>
+#include <SFML/System/Lock.hpp>
+#include <SFML/System/Err.hpp>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+SoundBufferCache::SoundBufferCache() :
+m_entries       (),
+m_releaseSamples(false),
+m_mutex         ()
+{
+}
+
+
+////////////////////////////////////////////////////////////
+SoundBufferCache::~SoundBufferCache()
+{
+    for (EntryMap::iterator it = m_entries.begin(); it != m_entries.end(); ++it)
+        delete it->second.buffer;
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundBufferCache::setReleaseSamples(bool release)
+{
+    Lock lock(m_mutex);
+    m_releaseSamples = release;
+}
+
+
+////////////////////////////////////////////////////////////
+bool SoundBufferCache::getReleaseSamples() const
+{
+    Lock lock(m_mutex);
+    return m_releaseSamples;
+}
+
+
+////////////////////////////////////////////////////////////
+const SoundBuffer* SoundBufferCache::acquire(const std::string& filename)
+{
+    bool releaseSamples = false;
+
+    {
+        Lock lock(m_mutex);
+
+        EntryMap::iterator it = m_entries.find(filename);
+        if (it != m_entries.end())
+        {
+            it->second.references++;
+            return it->second.buffer;
+        }
+
+        releaseSamples = m_releaseSamples;
+    }
+
+    // Load the file without holding the lock, so that other threads
+    // can still acquire the buffers already loaded meanwhile
+    SoundBuffer* buffer = new SoundBuffer;
+    if (!buffer->loadFromFile(filename))
+    {
+        delete buffer;
+        return NULL;
+    }
+
+    if (releaseSamples)
+        buffer->releaseSamples();
+
+    Lock lock(m_mutex);
+
+    // Another thread may have loaded the same file in the meantime: keep its buffer
+    EntryMap::iterator it = m_entries.find(filename);
+    if (it != m_entries.end())
+    {
+        delete buffer;
+        it->second.references++;
+        return it->second.buffer;
+    }
+
+    Entry entry;
+    entry.buffer = buffer;
+    entry.references = 1;
+    m_entries.insert(std::make_pair(filename, entry));
+
+    return buffer;
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundBufferCache::release(const std::string& filename)
+{
+    SoundBuffer* unused = NULL;
+
+    {
+        Lock lock(m_mutex);
+
+        EntryMap::iterator it = m_entries.find(filename);
+        if (it == m_entries.end())
+        {
+            err() << "Failed to release sound buffer \"" << filename << "\" (it is not in the cache)" << std::endl;
+            return;
+        }
+
+        if (--it->second.references == 0)
+        {
+            unused = it->second.buffer;
+            m_entries.erase(it);
+        }
+    }
+
+    // Destroy the buffer outside of the lock, it may stop sounds
+    delete unused;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SoundBufferCache::getBufferCount() const
+{
+    Lock lock(m_mutex);
+    return m_entries.size();
+}
+
+} // namespace sf
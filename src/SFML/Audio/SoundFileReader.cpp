@@ -0,0 +1,58 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/SoundFileReader.hpp>
+#include <SFML/Audio/SampleConversion.hpp>
+#include <algorithm>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+Uint64 SoundFileReader::read(float* samples, Uint64 maxCount)
+{
+    // Read 16 bits samples in blocks, and convert them
+    Int16 buffer[4096];
+
+    Uint64 count = 0;
+    while (count < maxCount)
+    {
+        Uint64 blockCount = std::min<Uint64>(maxCount - count, sizeof(buffer) / sizeof(*buffer));
+        Uint64 readCount = read(buffer, blockCount);
+
+        priv::convertSamples(buffer, samples + count, static_cast<std::size_t>(readCount));
+        count += readCount;
+
+        // End of file
+        if (readCount < blockCount)
+            break;
+    }
+
+    return count;
+}
+
+} // namespace sf
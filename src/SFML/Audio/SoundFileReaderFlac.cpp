@@ -26,6 +26,7 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Audio/SoundFileReaderFlac.hpp>
+#include <SFML/Audio/SampleConversion.hpp>
 #include <SFML/System/InputStream.hpp>
 #include <SFML/System/Err.hpp>
 #include <cassert>
@@ -103,18 +104,40 @@ namespace
         return data->stream->tell() == data->stream->getSize();
     }
 
-    FLAC__StreamDecoderWriteStatus streamWrite(const FLAC__StreamDecoder*, const FLAC__Frame* frame, const FLAC__int32* const buffer[], void* clientData)
+    void decodeSample(FLAC__int32 value, unsigned int bitsPerSample, sf::Int16& sample)
     {
-        sf::priv::SoundFileReaderFlac::ClientData* data = static_cast<sf::priv::SoundFileReaderFlac::ClientData*>(clientData);
+        switch (bitsPerSample)
+        {
+            case 8:
+                sample = static_cast<sf::Int16>(value << 8);
+                break;
+            case 16:
+                sample = static_cast<sf::Int16>(value);
+                break;
+            case 24:
+                sample = static_cast<sf::Int16>(value >> 8);
+                break;
+            case 32:
+                sample = static_cast<sf::Int16>(value >> 16);
+                break;
+            default:
+                assert(false);
+                break;
+        }
+    }
 
-        // If there's no output buffer, it means that we are seeking
-        if (!data->buffer)
-            return FLAC__STREAM_DECODER_WRITE_STATUS_CONTINUE;
+    void decodeSample(FLAC__int32 value, unsigned int bitsPerSample, float& sample)
+    {
+        sample = value * (1.f / (static_cast<sf::Uint32>(1) << (bitsPerSample - 1)));
+    }
 
+    template <typename T>
+    void writeSamples(const FLAC__Frame* frame, const FLAC__int32* const buffer[], T*& output, sf::Uint64& remaining, std::vector<T>& leftovers)
+    {
         // Reserve memory if we're going to use the leftovers buffer
         unsigned int frameSamples = frame->header.blocksize * frame->header.channels;
-        if (data->remaining < frameSamples)
-            data->leftovers.reserve(static_cast<std::size_t>(frameSamples - data->remaining));
+        if (remaining < frameSamples)
+            leftovers.reserve(static_cast<std::size_t>(frameSamples - remaining));
 
         // Decode the samples
         for (unsigned i = 0; i < frame->header.blocksize; ++i)
@@ -122,39 +145,34 @@ namespace
             for (unsigned int j = 0; j < frame->header.channels; ++j)
             {
                 // Decode the current sample
-                sf::Int16 sample = 0;
-                switch (frame->header.bits_per_sample)
-                {
-                    case 8:
-                        sample = buffer[j][i] << 8;
-                        break;
-                    case 16:
-                        sample = buffer[j][i];
-                        break;
-                    case 24:
-                        sample = buffer[j][i] >> 8;
-                        break;
-                    case 32:
-                        sample = buffer[j][i] >> 16;
-                        break;
-                    default:
-                        assert(false);
-                        break;
-                }
+                T sample = 0;
+                decodeSample(buffer[j][i], frame->header.bits_per_sample, sample);
 
-                if (data->remaining > 0)
+                if (remaining > 0)
                 {
                     // There's room in the output buffer, copy the sample there
-                    *data->buffer++ = sample;
-                    data->remaining--;
+                    *output++ = sample;
+                    remaining--;
                 }
                 else
                 {
                     // We have decoded all the requested samples, put the sample in a temporary buffer until next call
-                    data->leftovers.push_back(sample);
+                    leftovers.push_back(sample);
                 }
             }
         }
+    }
+
+    FLAC__StreamDecoderWriteStatus streamWrite(const FLAC__StreamDecoder*, const FLAC__Frame* frame, const FLAC__int32* const buffer[], void* clientData)
+    {
+        sf::priv::SoundFileReaderFlac::ClientData* data = static_cast<sf::priv::SoundFileReaderFlac::ClientData*>(clientData);
+
+        // Decode the samples to the type requested by the reader;
+        // if there's no output buffer, it means that we are seeking
+        if (data->buffer)
+            writeSamples(frame, buffer, data->buffer, data->remaining, data->leftovers);
+        else if (data->floatBuffer)
+            writeSamples(frame, buffer, data->floatBuffer, data->remaining, data->floatLeftovers);
 
         return FLAC__STREAM_DECODER_WRITE_STATUS_CONTINUE;
     }
@@ -168,6 +186,7 @@ namespace
             data->info.sampleCount = meta->data.stream_info.total_samples * meta->data.stream_info.channels;
             data->info.sampleRate = meta->data.stream_info.sample_rate;
             data->info.channelCount = meta->data.stream_info.channels;
+            data->info.bitsPerSample = meta->data.stream_info.bits_per_sample;
         }
     }
 
@@ -234,6 +253,9 @@ bool SoundFileReaderFlac::open(InputStream& stream, Info& info)
 
     // Initialize the decoder with our callbacks
     m_clientData.stream = &stream;
+    m_clientData.buffer = NULL;
+    m_clientData.floatBuffer = NULL;
+    m_clientData.remaining = 0;
     FLAC__stream_decoder_init_stream(m_decoder, &streamRead, &streamSeek, &streamTell, &streamLength, &streamEof, &streamWrite, &streamMetadata, &streamError, &m_clientData);
 
     // Read the header
@@ -258,8 +280,10 @@ void SoundFileReaderFlac::seek(Uint64 sampleOffset)
 
     // Reset the callback data (the "write" callback will be called)
     m_clientData.buffer = NULL;
+    m_clientData.floatBuffer = NULL;
     m_clientData.remaining = 0;
     m_clientData.leftovers.clear();
+    m_clientData.floatLeftovers.clear();
 
     FLAC__stream_decoder_seek_absolute(m_decoder, sampleOffset);
 }
@@ -270,29 +294,64 @@ Uint64 SoundFileReaderFlac::read(Int16* samples, Uint64 maxCount)
 {
     assert(m_decoder);
 
+    // Leftovers of a previous floating point read must be converted
+    std::vector<float>& floatLeftovers = m_clientData.floatLeftovers;
+    if (!floatLeftovers.empty())
+    {
+        m_clientData.leftovers.resize(floatLeftovers.size());
+        priv::convertSamples(&floatLeftovers[0], &m_clientData.leftovers[0], floatLeftovers.size());
+        floatLeftovers.clear();
+    }
+
+    return readSamples(samples, maxCount, m_clientData.buffer, m_clientData.leftovers);
+}
+
+
+////////////////////////////////////////////////////////////
+Uint64 SoundFileReaderFlac::read(float* samples, Uint64 maxCount)
+{
+    assert(m_decoder);
+
+    // Leftovers of a previous integer read must be converted
+    std::vector<Int16>& leftovers = m_clientData.leftovers;
+    if (!leftovers.empty())
+    {
+        m_clientData.floatLeftovers.resize(leftovers.size());
+        priv::convertSamples(&leftovers[0], &m_clientData.floatLeftovers[0], leftovers.size());
+        leftovers.clear();
+    }
+
+    return readSamples(samples, maxCount, m_clientData.floatBuffer, m_clientData.floatLeftovers);
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+Uint64 SoundFileReaderFlac::readSamples(T* samples, Uint64 maxCount, T*& buffer, std::vector<T>& leftovers)
+{
     // If there are leftovers from previous call, use it first
-    Uint64 left = m_clientData.leftovers.size();
+    Uint64 left = leftovers.size();
     if (left > 0)
     {
         if (left > maxCount)
         {
             // There are more leftovers than needed
-            std::copy(m_clientData.leftovers.begin(), m_clientData.leftovers.end(), samples);
-            std::vector<Int16> leftovers(m_clientData.leftovers.begin() + maxCount, m_clientData.leftovers.end());
-            m_clientData.leftovers.swap(leftovers);
+            std::copy(leftovers.begin(), leftovers.begin() + static_cast<std::size_t>(maxCount), samples);
+            std::vector<T> remaining(leftovers.begin() + static_cast<std::size_t>(maxCount), leftovers.end());
+            leftovers.swap(remaining);
             return maxCount;
         }
         else
         {
             // We can use all the leftovers and decode new frames
-            std::copy(m_clientData.leftovers.begin(), m_clientData.leftovers.end(), samples);
+            std::copy(leftovers.begin(), leftovers.end(), samples);
         }
     }
 
     // Reset the data that will be used in the callback
-    m_clientData.buffer = samples + left;
+    buffer = samples + left;
     m_clientData.remaining = maxCount - left;
-    m_clientData.leftovers.clear();
+    leftovers.clear();
 
     // Decode frames one by one until we reach the requested sample count, the end of file or an error
     while (m_clientData.remaining > 0)
@@ -307,6 +366,9 @@ Uint64 SoundFileReaderFlac::read(Int16* samples, Uint64 maxCount)
             break;
     }
 
+    // Don't keep a pointer to the caller's array
+    buffer = NULL;
+
     return maxCount - m_clientData.remaining;
 }
 
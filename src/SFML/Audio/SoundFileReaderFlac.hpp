@@ -101,6 +101,17 @@ public:
     ////////////////////////////////////////////////////////////
     virtual Uint64 read(Int16* samples, Uint64 maxCount);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Read audio samples from the open file, as floating point numbers
+    ///
+    /// \param samples  Pointer to the sample array to fill
+    /// \param maxCount Maximum number of samples to read
+    ///
+    /// \return Number of samples actually read (may be less than \a maxCount)
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual Uint64 read(float* samples, Uint64 maxCount);
+
 public:
 
     ////////////////////////////////////////////////////////////
@@ -112,8 +123,10 @@ public:
         InputStream*          stream;
         SoundFileReader::Info info;
         Int16*                buffer;
+        float*                floatBuffer;
         Uint64                remaining;
         std::vector<Int16>    leftovers;
+        std::vector<float>    floatLeftovers;
         bool                  error;
     };
 
@@ -125,6 +138,20 @@ private:
     ////////////////////////////////////////////////////////////
     void close();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Decode audio samples of the requested type
+    ///
+    /// \param samples   Pointer to the sample array to fill
+    /// \param maxCount  Maximum number of samples to read
+    /// \param buffer    Output pointer of the client data matching the sample type
+    /// \param leftovers Leftovers of the client data matching the sample type
+    ///
+    /// \return Number of samples actually read (may be less than \a maxCount)
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename T>
+    Uint64 readSamples(T* samples, Uint64 maxCount, T*& buffer, std::vector<T>& leftovers);
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
@@ -117,6 +117,7 @@ bool SoundFileReaderOgg::open(InputStream& stream, Info& info)
     vorbis_info* vorbisInfo = ov_info(&m_vorbis, -1);
     info.channelCount = vorbisInfo->channels;
     info.sampleRate = vorbisInfo->rate;
+    info.bitsPerSample = 0; // Vorbis is lossy, its samples have no precision of their own
     info.sampleCount = static_cast<std::size_t>(ov_pcm_total(&m_vorbis, -1) * vorbisInfo->channels);
 
     // We must keep the channel count for the seek function
@@ -163,6 +164,43 @@ Uint64 SoundFileReaderOgg::read(Int16* samples, Uint64 maxCount)
 }
 
 
+////////////////////////////////////////////////////////////
+Uint64 SoundFileReaderOgg::read(float* samples, Uint64 maxCount)
+{
+    assert(m_vorbis.datasource);
+
+    // Vorbis decodes to floats natively, ask for them to avoid a conversion to 16 bits integers;
+    // it returns whole frames, with one array per channel
+    Uint64 count = 0;
+    while (count + m_channelCount <= maxCount)
+    {
+        float** channels = NULL;
+        int framesToRead = static_cast<int>(std::min<Uint64>((maxCount - count) / m_channelCount, 4096));
+        long framesRead = ov_read_float(&m_vorbis, &channels, framesToRead, NULL);
+        if (framesRead > 0)
+        {
+            // Interleave the channels
+            for (unsigned int j = 0; j < m_channelCount; ++j)
+            {
+                const float* channel = channels[j];
+                for (long i = 0; i < framesRead; ++i)
+                    samples[i * m_channelCount + j] = channel[i];
+            }
+
+            count += framesRead * m_channelCount;
+            samples += framesRead * m_channelCount;
+        }
+        else
+        {
+            // error or end of file
+            break;
+        }
+    }
+
+    return count;
+}
+
+
 ////////////////////////////////////////////////////////////
 void SoundFileReaderOgg::close()
 {
@@ -31,6 +31,16 @@
 #include <algorithm>
 #include <cctype>
 #include <cassert>
+#include <cstring>
+
+// The samples are little endian, the vectorized conversions need a little endian host
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #include <emmintrin.h>
+    #define SFML_WAV_SSE2
+#elif (defined(__ARM_NEON__) || defined(__ARM_NEON)) && !defined(__ARM_BIG_ENDIAN)
+    #include <arm_neon.h>
+    #define SFML_WAV_NEON
+#endif
 
 
 namespace
@@ -87,7 +97,202 @@ namespace
         return true;
     }
 
+    // The following functions convert blocks of little endian samples
+    // to 16 bit signed samples or to normalized floats. The most common
+    // formats have SSE2 / NEON versions; the 8 and 24 bit ones would need
+    // byte shuffles that SSE2 lacks, and are left to the compiler
+
+    void convert8bit(const sf::Uint8* data, sf::Int16* samples, std::size_t count)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+            samples[i] = static_cast<sf::Int16>((data[i] - 128) << 8);
+    }
+
+    void convert16bit(const sf::Uint8* data, sf::Int16* samples, std::size_t count)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+            samples[i] = static_cast<sf::Int16>(data[i * 2] | (data[i * 2 + 1] << 8));
+    }
+
+    void convert24bit(const sf::Uint8* data, sf::Int16* samples, std::size_t count)
+    {
+        // Keep the 16 most significant bits
+        for (std::size_t i = 0; i < count; ++i)
+            samples[i] = static_cast<sf::Int16>(data[i * 3 + 1] | (data[i * 3 + 2] << 8));
+    }
+
+    void convert32bit(const sf::Uint8* data, sf::Int16* samples, std::size_t count)
+    {
+        // Keep the 16 most significant bits
+        for (std::size_t i = 0; i < count; ++i)
+            samples[i] = static_cast<sf::Int16>(data[i * 4 + 2] | (data[i * 4 + 3] << 8));
+    }
+
+    void convertFloat(const sf::Uint8* data, sf::Int16* samples, std::size_t count)
+    {
+        std::size_t i = 0;
+
+    #if defined(SFML_WAV_SSE2)
+
+        // Convert 8 samples at a time; NaN is zeroed before clipping, the conversion truncates like the cast
+        const __m128 one = _mm_set1_ps(1.f);
+        const __m128 minusOne = _mm_set1_ps(-1.f);
+        const __m128 scale = _mm_set1_ps(32767.f);
+        for (; i + 8 <= count; i += 8)
+        {
+            __m128 low = _mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i * 4)));
+            __m128 high = _mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i * 4 + 16)));
+            low = _mm_and_ps(low, _mm_cmpord_ps(low, low));
+            high = _mm_and_ps(high, _mm_cmpord_ps(high, high));
+            low = _mm_mul_ps(_mm_max_ps(_mm_min_ps(low, one), minusOne), scale);
+            high = _mm_mul_ps(_mm_max_ps(_mm_min_ps(high, one), minusOne), scale);
+            __m128i packed = _mm_packs_epi32(_mm_cvttps_epi32(low), _mm_cvttps_epi32(high));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(samples + i), packed);
+        }
+
+    #elif defined(SFML_WAV_NEON)
+
+        // Convert 4 samples at a time; NaN is zeroed before clipping, the conversion truncates like the cast
+        const float32x4_t one = vdupq_n_f32(1.f);
+        const float32x4_t minusOne = vdupq_n_f32(-1.f);
+        for (; i + 4 <= count; i += 4)
+        {
+            float32x4_t value = vreinterpretq_f32_u8(vld1q_u8(data + i * 4));
+            value = vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(value), vceqq_f32(value, value)));
+            value = vmulq_n_f32(vmaxq_f32(vminq_f32(value, one), minusOne), 32767.f);
+            vst1_s16(samples + i, vmovn_s32(vcvtq_s32_f32(value)));
+        }
+
+    #endif
+
+        for (; i < count; ++i)
+        {
+            sf::Uint32 bits = data[i * 4] | (data[i * 4 + 1] << 8) | (data[i * 4 + 2] << 16) | (static_cast<sf::Uint32>(data[i * 4 + 3]) << 24);
+
+            float value;
+            std::memcpy(&value, &bits, sizeof(value));
+
+            // Clip to the valid range (NaN gives silence)
+            if (value > 1.f)
+                value = 1.f;
+            else if (value < -1.f)
+                value = -1.f;
+            else if (value != value)
+                value = 0.f;
+
+            samples[i] = static_cast<sf::Int16>(value * 32767.f);
+        }
+    }
+
+    void convert8bit(const sf::Uint8* data, float* samples, std::size_t count)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+            samples[i] = (data[i] - 128) * (1.f / 128.f);
+    }
+
+    void convert16bit(const sf::Uint8* data, float* samples, std::size_t count)
+    {
+        std::size_t i = 0;
+
+    #if defined(SFML_WAV_SSE2)
+
+        // Convert 8 samples at a time, sign extending them by shifting them into the high half of 32 bit integers
+        const __m128 scale = _mm_set1_ps(1.f / 32768.f);
+        const __m128i zero = _mm_setzero_si128();
+        for (; i + 8 <= count; i += 8)
+        {
+            __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i * 2));
+            __m128i low = _mm_srai_epi32(_mm_unpacklo_epi16(zero, value), 16);
+            __m128i high = _mm_srai_epi32(_mm_unpackhi_epi16(zero, value), 16);
+            _mm_storeu_ps(samples + i, _mm_mul_ps(_mm_cvtepi32_ps(low), scale));
+            _mm_storeu_ps(samples + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(high), scale));
+        }
+
+    #elif defined(SFML_WAV_NEON)
+
+        // Convert 8 samples at a time
+        for (; i + 8 <= count; i += 8)
+        {
+            int16x8_t value = vreinterpretq_s16_u8(vld1q_u8(data + i * 2));
+            vst1q_f32(samples + i, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(value))), 1.f / 32768.f));
+            vst1q_f32(samples + i + 4, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(value))), 1.f / 32768.f));
+        }
+
+    #endif
+
+        for (; i < count; ++i)
+            samples[i] = static_cast<sf::Int16>(data[i * 2] | (data[i * 2 + 1] << 8)) * (1.f / 32768.f);
+    }
+
+    void convert24bit(const sf::Uint8* data, float* samples, std::size_t count)
+    {
+        // Place the sample in the most significant bits, so that the sign is right
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            sf::Uint32 bits = (data[i * 3] << 8) | (data[i * 3 + 1] << 16) | (static_cast<sf::Uint32>(data[i * 3 + 2]) << 24);
+            samples[i] = static_cast<sf::Int32>(bits) * (1.f / 2147483648.f);
+        }
+    }
+
+    void convert32bit(const sf::Uint8* data, float* samples, std::size_t count)
+    {
+        std::size_t i = 0;
+
+    #if defined(SFML_WAV_SSE2)
+
+        // Convert 4 samples at a time
+        const __m128 scale = _mm_set1_ps(1.f / 2147483648.f);
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i * 4));
+            _mm_storeu_ps(samples + i, _mm_mul_ps(_mm_cvtepi32_ps(value), scale));
+        }
+
+    #elif defined(SFML_WAV_NEON)
+
+        // Convert 4 samples at a time
+        for (; i + 4 <= count; i += 4)
+        {
+            int32x4_t value = vreinterpretq_s32_u8(vld1q_u8(data + i * 4));
+            vst1q_f32(samples + i, vmulq_n_f32(vcvtq_f32_s32(value), 1.f / 2147483648.f));
+        }
+
+    #endif
+
+        for (; i < count; ++i)
+        {
+            sf::Uint32 bits = data[i * 4] | (data[i * 4 + 1] << 8) | (data[i * 4 + 2] << 16) | (static_cast<sf::Uint32>(data[i * 4 + 3]) << 24);
+            samples[i] = static_cast<sf::Int32>(bits) * (1.f / 2147483648.f);
+        }
+    }
+
+    void convertFloat(const sf::Uint8* data, float* samples, std::size_t count)
+    {
+    #if defined(SFML_WAV_SSE2) || defined(SFML_WAV_NEON)
+
+        // The host is little endian, the samples can be copied as they are
+        std::memcpy(samples, data, count * sizeof(float));
+
+    #else
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            sf::Uint32 bits = data[i * 4] | (data[i * 4 + 1] << 8) | (data[i * 4 + 2] << 16) | (static_cast<sf::Uint32>(data[i * 4 + 3]) << 24);
+            std::memcpy(&samples[i], &bits, sizeof(float));
+        }
+
+    #endif
+    }
+
     const sf::Uint64 mainChunkSize = 12;
+
+    // Size of the blocks of raw audio data read from the stream
+    const std::size_t bufferSize = 65536;
+
+    // Audio formats found in the "fmt" chunk
+    const sf::Uint16 formatPcm        = 0x0001;
+    const sf::Uint16 formatFloat      = 0x0003;
+    const sf::Uint16 formatExtensible = 0xFFFE;
 }
 
 namespace sf
@@ -110,7 +315,10 @@ bool SoundFileReaderWav::check(InputStream& stream)
 SoundFileReaderWav::SoundFileReaderWav() :
 m_stream        (NULL),
 m_bytesPerSample(0),
-m_dataStart     (0)
+m_isFloat       (false),
+m_dataStart     (0),
+m_dataEnd       (0),
+m_buffer        ()
 {
 }
 
@@ -135,57 +343,73 @@ void SoundFileReaderWav::seek(Uint64 sampleOffset)
 {
     assert(m_stream);
 
-    m_stream->seek(m_dataStart + sampleOffset * m_bytesPerSample);
+    m_stream->seek(std::min(m_dataStart + sampleOffset * m_bytesPerSample, m_dataEnd));
 }
 
 
 ////////////////////////////////////////////////////////////
 Uint64 SoundFileReaderWav::read(Int16* samples, Uint64 maxCount)
+{
+    return readSamples(samples, maxCount);
+}
+
+
+////////////////////////////////////////////////////////////
+Uint64 SoundFileReaderWav::read(float* samples, Uint64 maxCount)
+{
+    return readSamples(samples, maxCount);
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+Uint64 SoundFileReaderWav::readSamples(T* samples, Uint64 maxCount)
 {
     assert(m_stream);
 
+    // Don't read past the data chunk
+    Int64 position = m_stream->tell();
+    if ((position < 0) || (static_cast<Uint64>(position) >= m_dataEnd))
+        return 0;
+    maxCount = std::min(maxCount, (m_dataEnd - position) / m_bytesPerSample);
+
+    if (m_buffer.empty())
+        m_buffer.resize(bufferSize);
+
+    // Read the data in large blocks, and convert them directly into the caller's array
     Uint64 count = 0;
     while (count < maxCount)
     {
-        switch (m_bytesPerSample)
+        std::size_t blockCount = static_cast<std::size_t>(std::min<Uint64>(maxCount - count, bufferSize / m_bytesPerSample));
+
+        // Streams may return less than requested before their end, keep reading
+        // until the block is complete so that we never stop in the middle of a sample
+        std::size_t blockSize = blockCount * m_bytesPerSample;
+        std::size_t bytesRead = 0;
+        while (bytesRead < blockSize)
         {
-            case 1:
-            {
-                Uint8 sample = 0;
-                if (decode(*m_stream, sample))
-                    *samples++ = (static_cast<Int16>(sample) - 128) << 8;
-                else
-                    return count;
+            Int64 read = m_stream->read(&m_buffer[bytesRead], blockSize - bytesRead);
+            if (read <= 0)
                 break;
-            }
 
-            case 2:
-            {
-                Int16 sample = 0;
-                if (decode(*m_stream, sample))
-                    *samples++ = sample;
-                else
-                    return count;
-                break;
-            }
+            bytesRead += static_cast<std::size_t>(read);
+        }
 
-            case 3:
-            {
-                Uint32 sample = 0;
-                if (decode24bit(*m_stream, sample))
-                    *samples++ = sample >> 8;
-                else
-                    return count;
-                break;
-            }
+        std::size_t readCount = bytesRead / m_bytesPerSample;
+        if (readCount == 0)
+            break;
 
+        switch (m_bytesPerSample)
+        {
+            case 1:  convert8bit(&m_buffer[0], samples + count, readCount);  break;
+            case 2:  convert16bit(&m_buffer[0], samples + count, readCount); break;
+            case 3:  convert24bit(&m_buffer[0], samples + count, readCount); break;
             case 4:
             {
-                Uint32 sample = 0;
-                if (decode(*m_stream, sample))
-                    *samples++ = sample >> 16;
+                if (m_isFloat)
+                    convertFloat(&m_buffer[0], samples + count, readCount);
                 else
-                    return count;
+                    convert32bit(&m_buffer[0], samples + count, readCount);
                 break;
             }
 
@@ -196,7 +420,11 @@ Uint64 SoundFileReaderWav::read(Int16* samples, Uint64 maxCount)
             }
         }
 
-        ++count;
+        count += readCount;
+
+        // End of stream
+        if (readCount < blockCount)
+            break;
     }
 
     return count;
@@ -235,7 +463,7 @@ bool SoundFileReaderWav::parseHeader(Info& info)
             Uint16 format = 0;
             if (!decode(*m_stream, format))
                 return false;
-            if (format != 1) // PCM
+            if ((format != formatPcm) && (format != formatFloat) && (format != formatExtensible))
                 return false;
 
             // Channel count
@@ -264,17 +492,45 @@ bool SoundFileReaderWav::parseHeader(Info& info)
             Uint16 bitsPerSample = 0;
             if (!decode(*m_stream, bitsPerSample))
                 return false;
+            Uint32 bytesRead = 16;
+
+            // The extensible format stores the actual format in the first bytes of its sub-format GUID
+            if (format == formatExtensible)
+            {
+                if (subChunkSize < 26)
+                    return false;
+
+                Uint16 extensionSize = 0;
+                Uint16 validBitsPerSample = 0;
+                Uint32 channelMask = 0;
+                if (!decode(*m_stream, extensionSize) || !decode(*m_stream, validBitsPerSample) || !decode(*m_stream, channelMask))
+                    return false;
+                if (!decode(*m_stream, format))
+                    return false;
+                if ((format != formatPcm) && (format != formatFloat))
+                    return false;
+
+                bytesRead += 10;
+            }
+
+            m_isFloat = (format == formatFloat);
+            if (m_isFloat && (bitsPerSample != 32))
+            {
+                err() << "Unsupported sample size: " << bitsPerSample << " bit floating point (Supported floating point sample size is 32 bit)" << std::endl;
+                return false;
+            }
             if (bitsPerSample != 8 && bitsPerSample != 16 && bitsPerSample != 24 && bitsPerSample != 32)
             {
                 err() << "Unsupported sample size: " << bitsPerSample << " bit (Supported sample sizes are 8/16/24/32 bit)" << std::endl;
                 return false;
             }
             m_bytesPerSample = bitsPerSample / 8;
+            info.bitsPerSample = bitsPerSample;
 
-            // Skip potential extra information (should not exist for PCM)
-            if (subChunkSize > 16)
+            // Skip potential extra information
+            if (subChunkSize > bytesRead)
             {
-                if (m_stream->seek(m_stream->tell() + subChunkSize - 16) == -1)
+                if (m_stream->seek(m_stream->tell() + subChunkSize - bytesRead) == -1)
                     return false;
             }
         }
@@ -285,8 +541,9 @@ bool SoundFileReaderWav::parseHeader(Info& info)
             // Compute the total number of samples
             info.sampleCount = subChunkSize / m_bytesPerSample;
 
-            // Store the starting position of samples in the file
+            // Store the starting and ending positions of samples in the file
             m_dataStart = m_stream->tell();
+            m_dataEnd = m_dataStart + info.sampleCount * m_bytesPerSample;
 
             dataChunkFound = true;
         }
@@ -30,6 +30,7 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Audio/SoundFileReader.hpp>
 #include <string>
+#include <vector>
 
 
 namespace sf
@@ -93,8 +94,31 @@ public:
     ////////////////////////////////////////////////////////////
     virtual Uint64 read(Int16* samples, Uint64 maxCount);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Read audio samples from the open file, as floating point numbers
+    ///
+    /// \param samples  Pointer to the sample array to fill
+    /// \param maxCount Maximum number of samples to read
+    ///
+    /// \return Number of samples actually read (may be less than \a maxCount)
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual Uint64 read(float* samples, Uint64 maxCount);
+
 private:
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Read blocks of raw audio data and convert them to the requested sample type
+    ///
+    /// \param samples  Pointer to the sample array to fill
+    /// \param maxCount Maximum number of samples to read
+    ///
+    /// \return Number of samples actually read (may be less than \a maxCount)
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename T>
+    Uint64 readSamples(T* samples, Uint64 maxCount);
+
     ////////////////////////////////////////////////////////////
     /// \brief Read the header of the open file
     ///
@@ -108,9 +132,12 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    InputStream* m_stream;         ///< Source stream to read from
-    unsigned int m_bytesPerSample; ///< Size of a sample, in bytes
-    Uint64       m_dataStart;      ///< Starting position of the audio data in the open file
+    InputStream*       m_stream;         ///< Source stream to read from
+    unsigned int       m_bytesPerSample; ///< Size of a sample, in bytes
+    bool               m_isFloat;        ///< Are the samples stored as IEEE floats rather than integers?
+    Uint64             m_dataStart;      ///< Starting position of the audio data in the open file
+    Uint64             m_dataEnd;        ///< Position following the last byte of audio data in the open file
+    std::vector<Uint8> m_buffer;         ///< Raw audio data read from the stream, before conversion
 };
 
 } // namespace priv
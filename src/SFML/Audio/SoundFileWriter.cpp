@@ -0,0 +1,53 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/SoundFileWriter.hpp>
+#include <SFML/Audio/SampleConversion.hpp>
+#include <algorithm>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+void SoundFileWriter::write(const float* samples, Uint64 count)
+{
+    // Convert the samples in blocks, and write them as 16 bits samples
+    Int16 buffer[4096];
+
+    while (count > 0)
+    {
+        std::size_t blockCount = static_cast<std::size_t>(std::min<Uint64>(count, sizeof(buffer) / sizeof(*buffer)));
+
+        priv::convertSamples(samples, buffer, blockCount);
+        write(buffer, blockCount);
+
+        samples += blockCount;
+        count -= blockCount;
+    }
+}
+
+} // namespace sf
@@ -148,6 +148,27 @@ void SoundFileWriterOgg::write(const Int16* samples, Uint64 count)
 }
 
 
+////////////////////////////////////////////////////////////
+void SoundFileWriterOgg::write(const float* samples, Uint64 count)
+{
+    // Prepare a buffer to hold our samples
+    int frameCount = static_cast<int>(count / m_channelCount);
+    float** buffer = vorbis_analysis_buffer(&m_state, frameCount);
+    assert(buffer);
+
+    // Write the samples to the buffer, vorbis encodes floating point samples directly
+    for (int i = 0; i < frameCount; ++i)
+        for (unsigned int j = 0; j < m_channelCount; ++j)
+            buffer[j][i] = *samples++;
+
+    // Tell the library how many samples we've written
+    vorbis_analysis_wrote(&m_state, frameCount);
+
+    // Flush any produced block
+    flushBlocks();
+}
+
+
 ////////////////////////////////////////////////////////////
 void SoundFileWriterOgg::flushBlocks()
 {
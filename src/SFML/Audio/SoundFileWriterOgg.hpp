@@ -90,6 +90,15 @@ public:
     ////////////////////////////////////////////////////////////
     virtual void write(const Int16* samples, Uint64 count);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Write floating point audio samples to the open file
+    ///
+    /// \param samples Pointer to the sample array to write
+    /// \param count   Number of samples to write
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void write(const float* samples, Uint64 count);
+
 private:
 
     ////////////////////////////////////////////////////////////
@@ -26,10 +26,12 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Audio/SoundFileWriterWav.hpp>
+#include <SFML/Audio/SampleConversion.hpp>
 #include <SFML/System/Err.hpp>
 #include <algorithm>
 #include <cctype>
 #include <cassert>
+#include <cstring>
 
 
 namespace
@@ -68,6 +70,13 @@ namespace
         };
         stream.write(reinterpret_cast<const char*>(bytes), sizeof(bytes));
     }
+
+    void encode(std::ostream& stream, float value)
+    {
+        sf::Uint32 bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        encode(stream, bits);
+    }
 }
 
 namespace sf
@@ -88,7 +97,9 @@ bool SoundFileWriterWav::check(const std::string& filename)
 SoundFileWriterWav::SoundFileWriterWav() :
 m_file        (),
 m_sampleCount (0),
-m_channelCount(0)
+m_channelCount(0),
+m_sampleRate  (0),
+m_isFloat     (false)
 {
 }
 
@@ -118,8 +129,9 @@ bool SoundFileWriterWav::open(const std::string& filename, unsigned int sampleRa
         return false;
     }
 
-    // Save the channel count
+    // Save the sound attributes (the header is written again if the samples are floating point)
     m_channelCount = channelCount;
+    m_sampleRate = sampleRate;
 
     return true;
 }
@@ -132,8 +144,64 @@ void SoundFileWriterWav::write(const Int16* samples, Uint64 count)
 
     m_sampleCount += count;
 
-    while (count--)
-        encode(m_file, *samples++);
+    if (m_isFloat)
+    {
+        // Convert the samples in blocks
+        float buffer[4096];
+        while (count > 0)
+        {
+            std::size_t blockCount = static_cast<std::size_t>(std::min<Uint64>(count, sizeof(buffer) / sizeof(*buffer)));
+            priv::convertSamples(samples, buffer, blockCount);
+            for (std::size_t i = 0; i < blockCount; ++i)
+                encode(m_file, buffer[i]);
+
+            samples += blockCount;
+            count -= blockCount;
+        }
+    }
+    else
+    {
+        while (count--)
+            encode(m_file, *samples++);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundFileWriterWav::write(const float* samples, Uint64 count)
+{
+    assert(m_file.good());
+
+    // Switch the file to floating point samples if nothing has been written yet
+    if ((m_sampleCount == 0) && !m_isFloat && (count > 0))
+    {
+        m_isFloat = true;
+        m_file.seekp(0);
+        writeHeader(m_sampleRate, m_channelCount);
+    }
+
+    m_sampleCount += count;
+
+    if (m_isFloat)
+    {
+        while (count--)
+            encode(m_file, *samples++);
+    }
+    else
+    {
+        // Convert the samples in blocks
+        Int16 buffer[4096];
+        while (count > 0)
+        {
+            std::size_t blockCount = static_cast<std::size_t>(std::min<Uint64>(count, sizeof(buffer) / sizeof(*buffer)));
+            priv::convertSamples(samples, buffer, blockCount);
+            for (std::size_t i = 0; i < blockCount; ++i)
+                encode(m_file, buffer[i]);
+
+            samples += blockCount;
+            count -= blockCount;
+        }
+    }
 }
 
 
@@ -158,18 +226,19 @@ bool SoundFileWriterWav::writeHeader(unsigned int sampleRate, unsigned int chann
     Uint32 fmtChunkSize = 16;
     encode(m_file, fmtChunkSize);
 
-    // Write the format (PCM)
-    Uint16 format = 1;
+    // Write the format (PCM or IEEE float)
+    Uint16 format = m_isFloat ? 3 : 1;
     encode(m_file, format);
 
     // Write the sound attributes
+    Uint16 bytesPerSample = m_isFloat ? 4 : 2;
     encode(m_file, static_cast<Uint16>(channelCount));
     encode(m_file, static_cast<Uint32>(sampleRate));
-    Uint32 byteRate = sampleRate * channelCount * 2;
+    Uint32 byteRate = sampleRate * channelCount * bytesPerSample;
     encode(m_file, byteRate);
-    Uint16 blockAlign = channelCount * 2;
+    Uint16 blockAlign = channelCount * bytesPerSample;
     encode(m_file, blockAlign);
-    Uint16 bitsPerSample = 16;
+    Uint16 bitsPerSample = bytesPerSample * 8;
     encode(m_file, bitsPerSample);
 
     // Write the sub-chunk 2 ("data") id and size
@@ -191,7 +260,7 @@ void SoundFileWriterWav::close()
         m_file.flush();
 
         // Update the main chunk size and data sub-chunk size
-        Uint32 dataChunkSize = static_cast<Uint32>(m_sampleCount * m_channelCount * 2);
+        Uint32 dataChunkSize = static_cast<Uint32>(m_sampleCount * (m_isFloat ? 4 : 2));
         Uint32 mainChunkSize = dataChunkSize + 36;
         m_file.seekp(4);
         encode(m_file, mainChunkSize);
@@ -90,6 +90,18 @@ public:
     ////////////////////////////////////////////////////////////
     virtual void write(const Int16* samples, Uint64 count);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Write floating point audio samples to the open file
+    ///
+    /// If they are the first samples written to the file, the
+    /// file stores floating point samples instead of 16 bits ones.
+    ///
+    /// \param samples Pointer to the sample array to write
+    /// \param count   Number of samples to write
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void write(const float* samples, Uint64 count);
+
 private:
 
     ////////////////////////////////////////////////////////////
@@ -115,6 +127,8 @@ private:
     std::ofstream m_file;         ///< File stream to write to
     Uint64        m_sampleCount;  ///< Total number of samples written to the file
     unsigned int  m_channelCount; ///< Number of channels of the sound
+    unsigned int  m_sampleRate;   ///< Sample rate of the sound
+    bool          m_isFloat;      ///< Does the file store floating point samples?
 };
 
 } // namespace priv
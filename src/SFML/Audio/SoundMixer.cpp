@@ -0,0 +1,646 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/SoundMixer.hpp>
+#include <SFML/Audio/SoundBuffer.hpp>
+#include <SFML/Audio/SampleConversion.hpp>
+#include <SFML/System/Lock.hpp>
+#include <SFML/System/Err.hpp>
+#include <algorithm>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+    #include <xmmintrin.h>
+    #define SFML_MIXER_SSE
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+    #include <arm_neon.h>
+    #define SFML_MIXER_NEON
+#endif
+
+
+namespace
+{
+    // Positions are stored as 32.32 fixed point numbers
+    const sf::Uint64 fixedOne = static_cast<sf::Uint64>(1) << 32;
+    const sf::Uint64 fractionMask = fixedOne - 1;
+
+    // Number of frames converted or interpolated at once, in a temporary array on the stack
+    const std::size_t blockFrames = 256;
+
+    // Read a sample as a floating point number, the same way as sf::priv::convertSamples
+    inline float toFloat(float sample)
+    {
+        return sample;
+    }
+
+    inline float toFloat(sf::Int16 sample)
+    {
+        return sample * (1.f / 32768.f);
+    }
+
+    // Get frames as floating point samples; 16 bits samples are converted to the block
+    inline const float* readFrames(const float* input, float*, std::size_t)
+    {
+        return input;
+    }
+
+    inline const float* readFrames(const sf::Int16* input, float* block, std::size_t sampleCount)
+    {
+        sf::priv::convertSamples(input, block, sampleCount);
+        return block;
+    }
+
+    // Add a frame of the voice to a frame of the output, routing the
+    // input channels to the output channels
+    template <unsigned int InChannels, unsigned int OutChannels>
+    inline void accumulate(const float* frame, float* output, const float* gains)
+    {
+        if (InChannels == OutChannels)
+        {
+            for (unsigned int c = 0; c < OutChannels; ++c)
+                output[c] += frame[c] * gains[c];
+        }
+        else if (InChannels == 1)
+        {
+            for (unsigned int c = 0; c < OutChannels; ++c)
+                output[c] += frame[0] * gains[c];
+        }
+        else
+        {
+            // Downmix to mono; the gain includes the 1 / InChannels factor
+            float sum = 0.f;
+            for (unsigned int c = 0; c < InChannels; ++c)
+                sum += frame[c];
+            output[0] += sum * gains[0];
+        }
+    }
+
+    // Add frames of the voice to the output, 4 frames at a time when SIMD is available
+    template <unsigned int InChannels, unsigned int OutChannels>
+    void mixDirect(const float* input, float* output, std::size_t count, const float* gains)
+    {
+        std::size_t i = 0;
+
+    #if defined(SFML_MIXER_SSE)
+
+        if ((InChannels == 1) && (OutChannels == 1))
+        {
+            __m128 gain = _mm_set1_ps(gains[0]);
+            for (; i + 4 <= count; i += 4)
+                _mm_storeu_ps(output + i, _mm_add_ps(_mm_loadu_ps(output + i), _mm_mul_ps(_mm_loadu_ps(input + i), gain)));
+        }
+        else if (InChannels == OutChannels)
+        {
+            __m128 gain = _mm_setr_ps(gains[0], gains[1], gains[0], gains[1]);
+            for (; i + 4 <= count; i += 4)
+            {
+                const float* in = input + i * 2;
+                float* out = output + i * 2;
+                _mm_storeu_ps(out,     _mm_add_ps(_mm_loadu_ps(out),     _mm_mul_ps(_mm_loadu_ps(in),     gain)));
+                _mm_storeu_ps(out + 4, _mm_add_ps(_mm_loadu_ps(out + 4), _mm_mul_ps(_mm_loadu_ps(in + 4), gain)));
+            }
+        }
+        else if (InChannels == 1)
+        {
+            // Mono to stereo: each sample is duplicated to both output channels
+            __m128 gain = _mm_setr_ps(gains[0], gains[1], gains[0], gains[1]);
+            for (; i + 4 <= count; i += 4)
+            {
+                __m128 frames = _mm_loadu_ps(input + i);
+                float* out = output + i * 2;
+                _mm_storeu_ps(out,     _mm_add_ps(_mm_loadu_ps(out),     _mm_mul_ps(_mm_unpacklo_ps(frames, frames), gain)));
+                _mm_storeu_ps(out + 4, _mm_add_ps(_mm_loadu_ps(out + 4), _mm_mul_ps(_mm_unpackhi_ps(frames, frames), gain)));
+            }
+        }
+        else
+        {
+            // Stereo to mono: the left and right samples are separated, then added
+            __m128 gain = _mm_set1_ps(gains[0]);
+            for (; i + 4 <= count; i += 4)
+            {
+                __m128 first = _mm_loadu_ps(input + i * 2);
+                __m128 second = _mm_loadu_ps(input + i * 2 + 4);
+                __m128 sum = _mm_add_ps(_mm_shuffle_ps(first, second, _MM_SHUFFLE(2, 0, 2, 0)),
+                                        _mm_shuffle_ps(first, second, _MM_SHUFFLE(3, 1, 3, 1)));
+                _mm_storeu_ps(output + i, _mm_add_ps(_mm_loadu_ps(output + i), _mm_mul_ps(sum, gain)));
+            }
+        }
+
+    #elif defined(SFML_MIXER_NEON)
+
+        if ((InChannels == 1) && (OutChannels == 1))
+        {
+            float32x4_t gain = vdupq_n_f32(gains[0]);
+            for (; i + 4 <= count; i += 4)
+                vst1q_f32(output + i, vaddq_f32(vld1q_f32(output + i), vmulq_f32(vld1q_f32(input + i), gain)));
+        }
+        else if (InChannels == OutChannels)
+        {
+            const float pairs[4] = {gains[0], gains[1], gains[0], gains[1]};
+            float32x4_t gain = vld1q_f32(pairs);
+            for (; i + 4 <= count; i += 4)
+            {
+                const float* in = input + i * 2;
+                float* out = output + i * 2;
+                vst1q_f32(out,     vaddq_f32(vld1q_f32(out),     vmulq_f32(vld1q_f32(in),     gain)));
+                vst1q_f32(out + 4, vaddq_f32(vld1q_f32(out + 4), vmulq_f32(vld1q_f32(in + 4), gain)));
+            }
+        }
+        else if (InChannels == 1)
+        {
+            // Mono to stereo: each sample is duplicated to both output channels
+            const float pairs[4] = {gains[0], gains[1], gains[0], gains[1]};
+            float32x4_t gain = vld1q_f32(pairs);
+            for (; i + 4 <= count; i += 4)
+            {
+                float32x4_t frames = vld1q_f32(input + i);
+                float32x4x2_t duplicated = vzipq_f32(frames, frames);
+                float* out = output + i * 2;
+                vst1q_f32(out,     vaddq_f32(vld1q_f32(out),     vmulq_f32(duplicated.val[0], gain)));
+                vst1q_f32(out + 4, vaddq_f32(vld1q_f32(out + 4), vmulq_f32(duplicated.val[1], gain)));
+            }
+        }
+        else
+        {
+            // Stereo to mono: the left and right samples are separated, then added
+            float32x4_t gain = vdupq_n_f32(gains[0]);
+            for (; i + 4 <= count; i += 4)
+            {
+                float32x4x2_t channels = vld2q_f32(input + i * 2);
+                float32x4_t sum = vaddq_f32(channels.val[0], channels.val[1]);
+                vst1q_f32(output + i, vaddq_f32(vld1q_f32(output + i), vmulq_f32(sum, gain)));
+            }
+        }
+
+    #endif
+
+        for (; i < count; ++i)
+            accumulate<InChannels, OutChannels>(input + i * InChannels, output + i * OutChannels, gains);
+    }
+
+    // Compute frames with linear interpolation between the input frames
+    template <typename T, unsigned int InChannels>
+    void interpolate(const T* input, sf::Uint64 frameCount, bool loop, sf::Uint64 position, sf::Uint64 step,
+                     float* output, std::size_t count)
+    {
+        float second[blockFrames * InChannels];
+        float weights[blockFrames * InChannels];
+
+        // Gather the two frames that surround each position (the gathering can't be vectorized)
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            sf::Uint64 index = position >> 32;
+            float t = static_cast<float>(position & fractionMask) * (1.f / 4294967296.f);
+
+            // The frame following the last one is the first one if looping, otherwise the last one is held
+            sf::Uint64 next = index + 1;
+            if (next >= frameCount)
+                next = loop ? 0 : index;
+
+            for (unsigned int c = 0; c < InChannels; ++c)
+            {
+                output[i * InChannels + c] = toFloat(input[index * InChannels + c]);
+                second[i * InChannels + c] = toFloat(input[next * InChannels + c]);
+                weights[i * InChannels + c] = t;
+            }
+
+            position += step;
+        }
+
+        // Interpolate between them
+        std::size_t sampleCount = count * InChannels;
+        std::size_t i = 0;
+
+    #if defined(SFML_MIXER_SSE)
+
+        for (; i + 4 <= sampleCount; i += 4)
+        {
+            __m128 a = _mm_loadu_ps(output + i);
+            __m128 b = _mm_loadu_ps(second + i);
+            _mm_storeu_ps(output + i, _mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(b, a), _mm_loadu_ps(weights + i))));
+        }
+
+    #elif defined(SFML_MIXER_NEON)
+
+        for (; i + 4 <= sampleCount; i += 4)
+        {
+            float32x4_t a = vld1q_f32(output + i);
+            float32x4_t b = vld1q_f32(second + i);
+            vst1q_f32(output + i, vaddq_f32(a, vmulq_f32(vsubq_f32(b, a), vld1q_f32(weights + i))));
+        }
+
+    #endif
+
+        for (; i < sampleCount; ++i)
+            output[i] = output[i] + (second[i] - output[i]) * weights[i];
+    }
+
+    // Mix frames of a voice, read directly if they are aligned with the output
+    // (pitch 1, same sample rate), interpolated otherwise
+    template <typename T, unsigned int InChannels, unsigned int OutChannels>
+    void mixFrames(const T* input, sf::Uint64 frameCount, bool loop, sf::Uint64 position, sf::Uint64 step,
+                   float* output, std::size_t count, const float* gains)
+    {
+        bool direct = (step == fixedOne) && ((position & fractionMask) == 0);
+
+        float block[blockFrames * InChannels];
+        while (count > 0)
+        {
+            std::size_t blockCount = std::min(count, blockFrames);
+
+            const float* frames = block;
+            if (direct)
+                frames = readFrames(input + (position >> 32) * InChannels, block, blockCount * InChannels);
+            else
+                interpolate<T, InChannels>(input, frameCount, loop, position, step, block, blockCount);
+
+            mixDirect<InChannels, OutChannels>(frames, output, blockCount, gains);
+
+            position += blockCount * step;
+            output += blockCount * OutChannels;
+            count -= blockCount;
+        }
+    }
+
+    // Select the version of mixFrames that matches the channel counts
+    template <typename T>
+    void mixFrames(const T* input, unsigned int inChannels, unsigned int outChannels, sf::Uint64 frameCount, bool loop,
+                   sf::Uint64 position, sf::Uint64 step, float* output, std::size_t count, const float* gains)
+    {
+        if (inChannels == 1)
+        {
+            if (outChannels == 1)
+                mixFrames<T, 1, 1>(input, frameCount, loop, position, step, output, count, gains);
+            else
+                mixFrames<T, 1, 2>(input, frameCount, loop, position, step, output, count, gains);
+        }
+        else
+        {
+            if (outChannels == 1)
+                mixFrames<T, 2, 1>(input, frameCount, loop, position, step, output, count, gains);
+            else
+                mixFrames<T, 2, 2>(input, frameCount, loop, position, step, output, count, gains);
+        }
+    }
+}
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+SoundMixer::SoundMixer(unsigned int channelCount, unsigned int sampleRate) :
+m_channelCount(channelCount),
+m_sampleRate  (sampleRate),
+m_voices      (),
+m_freeSlots   (),
+m_voiceCount  (0),
+m_mutex       ()
+{
+    if ((m_channelCount < 1) || (m_channelCount > 2))
+    {
+        err() << "Sound mixer only supports 1 or 2 output channels (" << m_channelCount << " requested)" << std::endl;
+        m_channelCount = std::min(std::max(m_channelCount, 1u), 2u);
+    }
+
+    if (m_sampleRate == 0)
+    {
+        err() << "Sound mixer sample rate must not be 0" << std::endl;
+        m_sampleRate = 44100;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+SoundMixer::~SoundMixer()
+{
+    // Unregister the voices from their sound buffers
+    stopAll();
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int SoundMixer::getChannelCount() const
+{
+    return m_channelCount;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int SoundMixer::getSampleRate() const
+{
+    return m_sampleRate;
+}
+
+
+////////////////////////////////////////////////////////////
+Uint64 SoundMixer::play(const SoundBuffer& buffer, float volume, float pitch, float pan, bool loop)
+{
+    // Register the voice before getting the samples, so that they can't be released
+    // until the voice ends; the buffer is not locked while the voice is added, as
+    // the mixer unregisters its voices while holding its own lock
+    buffer.addMixerVoice();
+
+    // The samples are read in the format they are stored as, to avoid keeping a converted copy
+    const float* samples = buffer.m_isFloat ? buffer.getFloatSamples() : NULL;
+    const Int16* intSamples = buffer.m_isFloat ? NULL : buffer.getSamples();
+
+    Uint64 voice = addVoice(&buffer, samples, intSamples, buffer.getSampleCount(), buffer.getChannelCount(),
+                            buffer.getSampleRate(), volume, pitch, pan, loop);
+    if (voice == 0)
+        buffer.removeMixerVoice();
+
+    return voice;
+}
+
+
+////////////////////////////////////////////////////////////
+Uint64 SoundMixer::play(const float* samples, Uint64 sampleCount, unsigned int channelCount, unsigned int sampleRate,
+                        float volume, float pitch, float pan, bool loop)
+{
+    return addVoice(NULL, samples, NULL, sampleCount, channelCount, sampleRate, volume, pitch, pan, loop);
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundMixer::stop(Uint64 voice)
+{
+    Lock lock(m_mutex);
+
+    if (findVoice(voice))
+        removeVoice(static_cast<std::size_t>(voice & 0xFFFFFFFF));
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundMixer::stopAll()
+{
+    Lock lock(m_mutex);
+
+    for (std::size_t i = 0; i < m_voices.size(); ++i)
+    {
+        if (m_voices[i].active)
+            removeVoice(i);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool SoundMixer::isPlaying(Uint64 voice) const
+{
+    Lock lock(m_mutex);
+
+    return const_cast<SoundMixer*>(this)->findVoice(voice) != NULL;
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundMixer::setVolume(Uint64 voice, float volume)
+{
+    Lock lock(m_mutex);
+
+    Voice* data = findVoice(voice);
+    if (data)
+    {
+        data->volume = std::min(std::max(volume, 0.f), 100.f) / 100.f;
+        updateGains(*data);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundMixer::setPitch(Uint64 voice, float pitch)
+{
+    Lock lock(m_mutex);
+
+    Voice* data = findVoice(voice);
+    if (data)
+        updateStep(*data, pitch);
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundMixer::setPan(Uint64 voice, float pan)
+{
+    Lock lock(m_mutex);
+
+    Voice* data = findVoice(voice);
+    if (data)
+    {
+        data->pan = std::min(std::max(pan, -1.f), 1.f);
+        updateGains(*data);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SoundMixer::getVoiceCount() const
+{
+    Lock lock(m_mutex);
+
+    return m_voiceCount;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SoundMixer::mix(float* samples, std::size_t frameCount)
+{
+    std::fill(samples, samples + frameCount * m_channelCount, 0.f);
+
+    Lock lock(m_mutex);
+
+    std::size_t mixedFrames = 0;
+    for (std::size_t i = 0; i < m_voices.size(); ++i)
+    {
+        Voice& voice = m_voices[i];
+        if (!voice.active)
+            continue;
+
+        // Release the voices that have ended
+        std::size_t voiceFrames = 0;
+        if (!mixVoice(voice, samples, frameCount, voiceFrames))
+            removeVoice(i);
+
+        mixedFrames = std::max(mixedFrames, voiceFrames);
+    }
+
+    return mixedFrames;
+}
+
+
+////////////////////////////////////////////////////////////
+Uint64 SoundMixer::addVoice(const SoundBuffer* buffer, const float* samples, const Int16* intSamples, Uint64 sampleCount,
+                            unsigned int channelCount, unsigned int sampleRate, float volume, float pitch, float pan, bool loop)
+{
+    if ((!samples && !intSamples) || !sampleCount || !sampleRate)
+        return 0;
+
+    if ((channelCount < 1) || (channelCount > 2))
+    {
+        err() << "Sound mixer only supports mono and stereo samples (" << channelCount << " channels)" << std::endl;
+        return 0;
+    }
+
+    Lock lock(m_mutex);
+
+    // Reuse a free slot, or create a new one
+    std::size_t index = 0;
+    if (!m_freeSlots.empty())
+    {
+        index = m_freeSlots.back();
+        m_freeSlots.pop_back();
+    }
+    else
+    {
+        index = m_voices.size();
+        m_voices.push_back(Voice());
+        m_voices.back().generation = 0;
+    }
+
+    Voice& voice = m_voices[index];
+    voice.buffer       = buffer;
+    voice.samples      = samples;
+    voice.intSamples   = intSamples;
+    voice.frameCount   = sampleCount / channelCount;
+    voice.channelCount = channelCount;
+    voice.sampleRate   = sampleRate;
+    voice.position     = 0;
+    voice.volume       = std::min(std::max(volume, 0.f), 100.f) / 100.f;
+    voice.pan          = std::min(std::max(pan, -1.f), 1.f);
+    voice.loop         = loop;
+    voice.active       = true;
+    voice.generation++;
+    updateGains(voice);
+    updateStep(voice, pitch);
+
+    m_voiceCount++;
+
+    // The handle combines the generation of the slot and its index, so that
+    // handles of ended voices are never confused with the ones of new voices
+    return (static_cast<Uint64>(voice.generation) << 32) | index;
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundMixer::removeVoice(std::size_t index)
+{
+    Voice& voice = m_voices[index];
+    if (voice.buffer)
+        voice.buffer->removeMixerVoice();
+
+    voice.buffer = NULL;
+    voice.active = false;
+    m_freeSlots.push_back(index);
+    m_voiceCount--;
+}
+
+
+////////////////////////////////////////////////////////////
+SoundMixer::Voice* SoundMixer::findVoice(Uint64 voice)
+{
+    std::size_t index = static_cast<std::size_t>(voice & 0xFFFFFFFF);
+    Uint32 generation = static_cast<Uint32>(voice >> 32);
+
+    if ((index < m_voices.size()) && m_voices[index].active && (m_voices[index].generation == generation))
+        return &m_voices[index];
+    else
+        return NULL;
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundMixer::updateGains(Voice& voice) const
+{
+    if (m_channelCount == 2)
+    {
+        // Balance: the centered position plays both channels at full volume
+        voice.gains[0] = voice.volume * std::min(1.f, 1.f - voice.pan);
+        voice.gains[1] = voice.volume * std::min(1.f, 1.f + voice.pan);
+    }
+    else
+    {
+        // Mono output: stereo voices are averaged
+        voice.gains[0] = voice.volume / voice.channelCount;
+        voice.gains[1] = 0.f;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundMixer::updateStep(Voice& voice, float pitch) const
+{
+    // The step also converts the sample rate of the buffer to the one of the mixer
+    double step = static_cast<double>(std::max(pitch, 0.f)) * voice.sampleRate / m_sampleRate;
+    voice.step = std::max(static_cast<Uint64>(step * fixedOne), static_cast<Uint64>(1));
+}
+
+
+////////////////////////////////////////////////////////////
+bool SoundMixer::mixVoice(Voice& voice, float* samples, std::size_t frameCount, std::size_t& mixedFrames) const
+{
+    mixedFrames = 0;
+
+    const Uint64 end = voice.frameCount << 32;
+    if (end == 0)
+        return false;
+
+    std::size_t done = 0;
+    while (done < frameCount)
+    {
+        // Loop or end the voice when it reaches the end of its buffer
+        if (voice.position >= end)
+        {
+            if (!voice.loop)
+            {
+                mixedFrames = done;
+                return false;
+            }
+
+            voice.position %= end;
+        }
+
+        // Mix up to the end of the buffer
+        Uint64 available = (end - voice.position + voice.step - 1) / voice.step;
+        std::size_t count = static_cast<std::size_t>(std::min<Uint64>(frameCount - done, available));
+        float* output = samples + done * m_channelCount;
+
+        if (voice.samples)
+            mixFrames(voice.samples, voice.channelCount, m_channelCount, voice.frameCount, voice.loop,
+                      voice.position, voice.step, output, count, voice.gains);
+        else
+            mixFrames(voice.intSamples, voice.channelCount, m_channelCount, voice.frameCount, voice.loop,
+                      voice.position, voice.step, output, count, voice.gains);
+
+        voice.position += count * voice.step;
+        done += count;
+    }
+
+    mixedFrames = done;
+
+    // The voice has ended if it reached the end of its buffer without looping
+    return voice.loop || (voice.position < end);
+}
+
+} // namespace sf
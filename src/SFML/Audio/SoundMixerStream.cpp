@@ -0,0 +1,79 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/SoundMixerStream.hpp>
+#include <SFML/Audio/SoundMixer.hpp>
+#include <algorithm>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+SoundMixerStream::SoundMixerStream(SoundMixer& mixer) :
+m_mixer  (mixer),
+m_samples()
+{
+    setChunkDuration(milliseconds(20));
+    setBufferCount(4);
+
+    initialize(m_mixer.getChannelCount(), m_mixer.getSampleRate());
+}
+
+
+////////////////////////////////////////////////////////////
+SoundMixerStream::~SoundMixerStream()
+{
+    // We must stop before the mixer can be destroyed
+    stop();
+}
+
+
+////////////////////////////////////////////////////////////
+bool SoundMixerStream::onGetData(SoundStream::Chunk& data)
+{
+    // Mix one chunk (at least one frame)
+    std::size_t frameCount = static_cast<std::size_t>(getChunkDuration().asSeconds() * m_mixer.getSampleRate());
+    frameCount = std::max(frameCount, std::size_t(1));
+
+    m_samples.resize(frameCount * m_mixer.getChannelCount());
+    m_mixer.mix(&m_samples[0], frameCount);
+
+    // Floating point samples are converted by the stream if the device doesn't support them
+    data.floatSamples = &m_samples[0];
+    data.sampleCount  = m_samples.size();
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundMixerStream::onSeek(Time)
+{
+    // Nothing to do: the mixer output has no position
+}
+
+} // namespace sf
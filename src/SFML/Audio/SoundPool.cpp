@@ -0,0 +1,181 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/SoundPool.hpp>
+#include <SFML/Audio/SoundBuffer.hpp>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+SoundPool::SoundPool(unsigned int voiceCount) :
+m_voices   (),
+m_playCount(0)
+{
+    // Each voice is copied from a default one, and gets its own audio source
+    Voice voice;
+    voice.priority   = 0;
+    voice.order      = 0;
+    voice.generation = 0;
+    m_voices.resize(voiceCount > 0 ? voiceCount : 1, voice);
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int SoundPool::getVoiceCount() const
+{
+    return static_cast<unsigned int>(m_voices.size());
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int SoundPool::getActiveVoiceCount() const
+{
+    unsigned int count = 0;
+    for (std::vector<Voice>::const_iterator it = m_voices.begin(); it != m_voices.end(); ++it)
+    {
+        if (it->sound.getStatus() != Sound::Stopped)
+            count++;
+    }
+
+    return count;
+}
+
+
+////////////////////////////////////////////////////////////
+Uint64 SoundPool::play(const SoundBuffer& buffer, int priority, float volume, float pitch, bool loop)
+{
+    // Look for a free voice, and for the least important busy voice in case there's none
+    std::size_t index = m_voices.size();
+    std::size_t victim = m_voices.size();
+    float victimVolume = 0.f;
+
+    for (std::size_t i = 0; i < m_voices.size(); ++i)
+    {
+        const Voice& voice = m_voices[i];
+        if (voice.sound.getStatus() == Sound::Stopped)
+        {
+            index = i;
+            break;
+        }
+
+        float voiceVolume = voice.sound.getVolume();
+        if (victim == m_voices.size())
+        {
+            victim = i;
+            victimVolume = voiceVolume;
+            continue;
+        }
+
+        const Voice& current = m_voices[victim];
+        bool lessImportant = (voice.priority < current.priority) ||
+                             ((voice.priority == current.priority) && (voiceVolume < victimVolume)) ||
+                             ((voice.priority == current.priority) && (voiceVolume == victimVolume) && (voice.order < current.order));
+        if (lessImportant)
+        {
+            victim = i;
+            victimVolume = voiceVolume;
+        }
+    }
+
+    // All the voices are busy: steal one, unless they are all more important than the new sound
+    if (index == m_voices.size())
+    {
+        if (m_voices[victim].priority > priority)
+            return 0;
+
+        index = victim;
+    }
+
+    // Restore the default attributes, the previous sound may have changed them
+    Voice& voice = m_voices[index];
+    voice.sound.setBuffer(buffer);
+    voice.sound.setLoop(loop);
+    voice.sound.setVolume(volume);
+    voice.sound.setPitch(pitch);
+    voice.sound.setPosition(0.f, 0.f, 0.f);
+    voice.sound.setRelativeToListener(false);
+    voice.sound.setMinDistance(1.f);
+    voice.sound.setAttenuation(1.f);
+    voice.sound.play();
+
+    voice.priority = priority;
+    voice.order = m_playCount++;
+    voice.generation++;
+
+    // The handle combines the generation of the voice and its index, so that
+    // handles of ended or stolen sounds are never confused with the ones of new sounds
+    return (static_cast<Uint64>(voice.generation) << 32) | index;
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundPool::stop(Uint64 voice)
+{
+    std::size_t index = findVoice(voice);
+    if (index < m_voices.size())
+        m_voices[index].sound.stop();
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundPool::stopAll()
+{
+    for (std::vector<Voice>::iterator it = m_voices.begin(); it != m_voices.end(); ++it)
+        it->sound.stop();
+}
+
+
+////////////////////////////////////////////////////////////
+bool SoundPool::isPlaying(Uint64 voice) const
+{
+    std::size_t index = findVoice(voice);
+    return (index < m_voices.size()) && (m_voices[index].sound.getStatus() != Sound::Stopped);
+}
+
+
+////////////////////////////////////////////////////////////
+Sound* SoundPool::getSound(Uint64 voice)
+{
+    std::size_t index = findVoice(voice);
+    return (index < m_voices.size()) ? &m_voices[index].sound : NULL;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SoundPool::findVoice(Uint64 voice) const
+{
+    std::size_t index = static_cast<std::size_t>(voice & 0xFFFFFFFF);
+    Uint32 generation = static_cast<Uint32>(voice >> 32);
+
+    if ((index < m_voices.size()) && (generation != 0) && (m_voices[index].generation == generation))
+        return index;
+    else
+        return m_voices.size();
+}
+
+} // namespace sf
@@ -28,30 +28,45 @@
 #include <SFML/Audio/SoundStream.hpp>
 #include <SFML/Audio/AudioDevice.hpp>
 #include <SFML/Audio/ALCheck.hpp>
-#include <SFML/System/Sleep.hpp>
+#include <SFML/Audio/SampleConversion.hpp>
+#include <SFML/Audio/StreamScheduler.hpp>
 #include <SFML/System/Err.hpp>
 #include <SFML/System/Lock.hpp>
-
-#ifdef _MSC_VER
-    #pragma warning(disable: 4355) // 'this' used in base member initializer list
-#endif
+#include <algorithm>
 
 
 namespace sf
 {
 ////////////////////////////////////////////////////////////
 SoundStream::SoundStream() :
-m_thread          (&SoundStream::streamData, this),
+m_streamMutex     (),
 m_threadMutex     (),
 m_threadStartState(Stopped),
 m_isStreaming     (false),
+m_bufferCount     (3),
+m_chunkDuration   (seconds(1)),
+m_buffers         (),
+m_bufferSamples   (),
+m_bufferSources   (),
+m_queue           (),
 m_channelCount    (0),
 m_sampleRate      (0),
 m_format          (0),
+m_floatFormat     (0),
+m_convertedSamples(),
+m_outputRate      (0),
+m_outputQuality   (Resampler::Sinc),
+m_streamRate      (0),
+m_resampler       (),
+m_resamplerInput  (),
+m_resampledSamples(),
+m_pendingSources  (0),
 m_loop            (false),
-m_samplesProcessed(0)
+m_samplesProcessed(0),
+m_endBuffers      (),
+m_requestStop     (false)
 {
-
+    priv::StreamScheduler::registerStream();
 }
 
 
@@ -60,14 +75,18 @@ SoundStream::~SoundStream()
 {
     // Stop the sound if it was playing
 
-    // Request the thread to terminate
+    // Request the streaming to terminate
     {
         Lock lock(m_threadMutex);
         m_isStreaming = false;
     }
 
-    // Wait for the thread to terminate
-    m_thread.wait();
+    // Make sure that no streaming thread is using the stream anymore
+    priv::StreamScheduler::removeStream(*this);
+    if (!m_buffers.empty())
+        stopStreaming();
+
+    priv::StreamScheduler::unregisterStream();
 }
 
 
@@ -79,17 +98,26 @@ void SoundStream::initialize(unsigned int channelCount, unsigned int sampleRate)
 
     // Deduce the format from the number of channels
     m_format = priv::AudioDevice::getFormatFromChannelCount(channelCount);
+    m_floatFormat = priv::AudioDevice::getFloatFormatFromChannelCount(channelCount);
 
     // Check if the format is valid
     if (m_format == 0)
     {
         m_channelCount = 0;
         m_sampleRate   = 0;
+        m_floatFormat  = 0;
         err() << "Unsupported number of channels (" << m_channelCount << ")" << std::endl;
     }
 }
 
 
+////////////////////////////////////////////////////////////
+bool SoundStream::isFloatPlaybackSupported() const
+{
+    return m_floatFormat != 0;
+}
+
+
 ////////////////////////////////////////////////////////////
 void SoundStream::play()
 {
@@ -124,15 +152,22 @@ void SoundStream::play()
         // If the sound is playing, stop it and continue as if it was stopped
         stop();
     }
+    else
+    {
+        // The stream may have just reached its end: make sure it is fully released
+        priv::StreamScheduler::removeStream(*this);
+        if (!m_buffers.empty())
+            stopStreaming();
+    }
 
     // Move to the beginning
     onSeek(Time::Zero);
 
-    // Start updating the stream in a separate thread to avoid blocking the application
+    // Start updating the stream in a streaming thread to avoid blocking the application
     m_samplesProcessed = 0;
     m_isStreaming = true;
     m_threadStartState = Playing;
-    m_thread.launch();
+    priv::StreamScheduler::addStream(*this);
 }
 
 
@@ -156,14 +191,16 @@ void SoundStream::pause()
 ////////////////////////////////////////////////////////////
 void SoundStream::stop()
 {
-    // Request the thread to terminate
+    // Request the streaming to terminate
     {
         Lock lock(m_threadMutex);
         m_isStreaming = false;
     }
 
-    // Wait for the thread to terminate
-    m_thread.wait();
+    // Wait until no streaming thread is using the stream anymore, and release its buffers
+    priv::StreamScheduler::removeStream(*this);
+    if (!m_buffers.empty())
+        stopStreaming();
 
     // Move to the beginning
     onSeek(Time::Zero);
@@ -225,7 +262,7 @@ void SoundStream::setPlayingOffset(Time timeOffset)
 
     m_isStreaming = true;
     m_threadStartState = oldStatus;
-    m_thread.launch();
+    priv::StreamScheduler::addStream(*this);
 }
 
 
@@ -261,28 +298,160 @@ bool SoundStream::getLoop() const
 
 
 ////////////////////////////////////////////////////////////
-void SoundStream::streamData()
+void SoundStream::setStreamingThreadCount(unsigned int count)
 {
-    bool requestStop = false;
+    priv::StreamScheduler::setThreadCount(count);
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int SoundStream::getStreamingThreadCount()
+{
+    return priv::StreamScheduler::getThreadCount();
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundStream::setOutputSampleRate(unsigned int sampleRate, Resampler::Quality quality)
+{
+    Lock lock(m_threadMutex);
+    m_outputRate = sampleRate;
+    m_outputQuality = quality;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int SoundStream::getOutputSampleRate() const
+{
+    Lock lock(m_threadMutex);
+    return m_outputRate;
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundStream::setBufferCount(unsigned int count)
+{
+    if (count < 2)
+    {
+        err() << "Sound streams need at least 2 buffers (" << count << " requested)" << std::endl;
+        count = 2;
+    }
+
+    Lock lock(m_threadMutex);
+    m_bufferCount = count;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int SoundStream::getBufferCount() const
+{
+    Lock lock(m_threadMutex);
+    return m_bufferCount;
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundStream::setChunkDuration(Time duration)
+{
+    Lock lock(m_threadMutex);
+    m_chunkDuration = duration;
+}
+
+
+////////////////////////////////////////////////////////////
+Time SoundStream::getChunkDuration() const
+{
+    Lock lock(m_threadMutex);
+    return m_chunkDuration;
+}
+
+
+////////////////////////////////////////////////////////////
+bool SoundStream::streamData(Time& delay)
+{
+    bool isStreaming = false;
+    Status threadStartState = Stopped;
 
     {
         Lock lock(m_threadMutex);
 
-        // Check if the thread was launched Stopped
-        if (m_threadStartState == Stopped)
+        isStreaming = m_isStreaming;
+        threadStartState = m_threadStartState;
+    }
+
+    // Stop was requested
+    if (!isStreaming)
+    {
+        if (!m_buffers.empty())
+            stopStreaming();
+
+        return false;
+    }
+
+    if (m_buffers.empty())
+    {
+        // Check if the stream was started Stopped
+        if (threadStartState == Stopped)
         {
+            Lock lock(m_threadMutex);
             m_isStreaming = false;
-            return;
+            return false;
         }
+
+        // First call: create the buffers and start playing
+        startStreaming();
+    }
+    else
+    {
+        // Refill the buffers that have been played
+        updateStreaming();
+    }
+
+    {
+        Lock lock(m_threadMutex);
+        isStreaming = m_isStreaming;
+    }
+
+    // The stream has reached its end
+    if (!isStreaming)
+    {
+        stopStreaming();
+        return false;
+    }
+
+    // Come back when the next buffer has been played; if the source
+    // has stopped, handle it right away
+    if (SoundSource::getStatus() != Stopped)
+        delay = getRefillDelay();
+    else
+        delay = Time::Zero;
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundStream::startStreaming()
+{
+    {
+        Lock lock(m_threadMutex);
+
+        m_buffers.assign(m_bufferCount, 0);
+        m_bufferSamples.assign(m_bufferCount, 0);
+        m_bufferSources.assign(m_bufferCount, 0);
+        m_endBuffers.assign(m_bufferCount, false);
+
+        // Start converting to the requested sample rate from a clean state
+        m_streamRate = m_outputRate ? m_outputRate : m_sampleRate;
+        m_resampler = Resampler(m_channelCount, m_sampleRate, m_streamRate, m_outputQuality);
+        m_pendingSources = 0;
     }
 
     // Create the buffers
-    alCheck(alGenBuffers(BufferCount, m_buffers));
-    for (int i = 0; i < BufferCount; ++i)
-        m_endBuffers[i] = false;
+    alCheck(alGenBuffers(static_cast<ALsizei>(m_buffers.size()), &m_buffers[0]));
 
     // Fill the queue
-    requestStop = fillQueue();
+    m_requestStop = fillQueue();
 
     // Play the sound
     alCheck(alSourcePlay(m_source));
@@ -290,98 +459,92 @@ void SoundStream::streamData()
     {
         Lock lock(m_threadMutex);
 
-        // Check if the thread was launched Paused
+        // Check if the stream was started Paused
         if (m_threadStartState == Paused)
             alCheck(alSourcePause(m_source));
     }
+}
 
-    for (;;)
+
+////////////////////////////////////////////////////////////
+void SoundStream::updateStreaming()
+{
+    // The stream has been interrupted!
+    if (SoundSource::getStatus() == Stopped)
     {
+        if (!m_requestStop)
         {
-            Lock lock(m_threadMutex);
-            if (!m_isStreaming)
-                break;
+            // Just continue
+            alCheck(alSourcePlay(m_source));
         }
-
-        // The stream has been interrupted!
-        if (SoundSource::getStatus() == Stopped)
+        else
         {
-            if (!requestStop)
-            {
-                // Just continue
-                alCheck(alSourcePlay(m_source));
-            }
-            else
-            {
-                // End streaming
-                Lock lock(m_threadMutex);
-                m_isStreaming = false;
-            }
+            // End streaming
+            Lock lock(m_threadMutex);
+            m_isStreaming = false;
+            return;
         }
+    }
+
+    // Get the number of buffers that have been processed (i.e. ready for reuse)
+    ALint nbProcessed = 0;
+    alCheck(alGetSourcei(m_source, AL_BUFFERS_PROCESSED, &nbProcessed));
 
-        // Get the number of buffers that have been processed (i.e. ready for reuse)
-        ALint nbProcessed = 0;
-        alCheck(alGetSourcei(m_source, AL_BUFFERS_PROCESSED, &nbProcessed));
+    while (nbProcessed--)
+    {
+        // Pop the first unused buffer from the queue; OpenAL processes
+        // buffers in order, so its number is at the front of ours
+        ALuint buffer;
+        alCheck(alSourceUnqueueBuffers(m_source, 1, &buffer));
 
-        while (nbProcessed--)
+        unsigned int bufferNum = m_queue.front();
+        m_queue.pop_front();
+
+        // Retrieve its size and add it to the samples count
+        if (m_endBuffers[bufferNum])
         {
-            // Pop the first unused buffer from the queue
-            ALuint buffer;
-            alCheck(alSourceUnqueueBuffers(m_source, 1, &buffer));
-
-            // Find its number
-            unsigned int bufferNum = 0;
-            for (int i = 0; i < BufferCount; ++i)
-                if (m_buffers[i] == buffer)
-                {
-                    bufferNum = i;
-                    break;
-                }
-
-            // Retrieve its size and add it to the samples count
-            if (m_endBuffers[bufferNum])
+            // This was the last buffer: reset the sample count
+            m_samplesProcessed = 0;
+            m_endBuffers[bufferNum] = false;
+        }
+        else
+        {
+            ALint bits;
+            alCheck(alGetBufferi(buffer, AL_BITS, &bits));
+
+            // Bits can be 0 if the format or parameters are corrupt, avoid division by zero
+            if (bits == 0)
             {
-                // This was the last buffer: reset the sample count
-                m_samplesProcessed = 0;
-                m_endBuffers[bufferNum] = false;
+                err() << "Bits in sound stream are 0: make sure that the audio format is not corrupt "
+                      << "and initialize() has been called correctly" << std::endl;
+
+                // Abort streaming
+                Lock lock(m_threadMutex);
+                m_isStreaming = false;
+                m_requestStop = true;
+                break;
             }
             else
             {
-                ALint size, bits;
-                alCheck(alGetBufferi(buffer, AL_SIZE, &size));
-                alCheck(alGetBufferi(buffer, AL_BITS, &bits));
-
-                // Bits can be 0 if the format or parameters are corrupt, avoid division by zero
-                if (bits == 0)
-                {
-                    err() << "Bits in sound stream are 0: make sure that the audio format is not corrupt "
-                          << "and initialize() has been called correctly" << std::endl;
-
-                    // Abort streaming (exit main loop)
-                    Lock lock(m_threadMutex);
-                    m_isStreaming = false;
-                    requestStop = true;
-                    break;
-                }
-                else
-                {
-                    m_samplesProcessed += size / (bits / 8);
-                }
-            }
-
-            // Fill it and push it back into the playing queue
-            if (!requestStop)
-            {
-                if (fillAndPushBuffer(bufferNum))
-                    requestStop = true;
+                // Count the samples of the stream, which differ from the samples of
+                // the buffer if the stream is converted to another sample rate
+                m_samplesProcessed += m_bufferSources[bufferNum];
             }
         }
 
-        // Leave some time for the other threads if the stream is still playing
-        if (SoundSource::getStatus() != Stopped)
-            sleep(milliseconds(10));
+        // Fill it and push it back into the playing queue
+        if (!m_requestStop)
+        {
+            if (fillAndPushBuffer(bufferNum))
+                m_requestStop = true;
+        }
     }
+}
+
 
+////////////////////////////////////////////////////////////
+void SoundStream::stopStreaming()
+{
     // Stop the playback
     alCheck(alSourceStop(m_source));
 
@@ -390,7 +553,8 @@ void SoundStream::streamData()
 
     // Delete the buffers
     alCheck(alSourcei(m_source, AL_BUFFER, 0));
-    alCheck(alDeleteBuffers(BufferCount, m_buffers));
+    alCheck(alDeleteBuffers(static_cast<ALsizei>(m_buffers.size()), &m_buffers[0]));
+    m_buffers.clear();
 }
 
 
@@ -400,7 +564,7 @@ bool SoundStream::fillAndPushBuffer(unsigned int bufferNum)
     bool requestStop = false;
 
     // Acquire audio data
-    Chunk data = {NULL, 0};
+    Chunk data = {NULL, 0, NULL};
     if (!onGetData(data))
     {
         // Mark the buffer as the last one (so that we know when to reset the playing position)
@@ -413,7 +577,7 @@ bool SoundStream::fillAndPushBuffer(unsigned int bufferNum)
             onSeek(Time::Zero);
 
             // If we previously had no data, try to fill the buffer once again
-            if (!data.samples || (data.sampleCount == 0))
+            if ((!data.samples && !data.floatSamples) || (data.sampleCount == 0))
             {
                 return fillAndPushBuffer(bufferNum);
             }
@@ -425,17 +589,75 @@ bool SoundStream::fillAndPushBuffer(unsigned int bufferNum)
         }
     }
 
+    const Int16* samples = data.samples;
+    const float* floatSamples = data.floatSamples;
+    std::size_t sampleCount = (samples || floatSamples) ? data.sampleCount : 0;
+    std::size_t sourceCount = sampleCount;
+
+    // Convert the chunk to the output sample rate
+    if (m_streamRate != m_sampleRate)
+    {
+        m_resampledSamples.clear();
+
+        if (sampleCount)
+        {
+            if (!floatSamples)
+            {
+                m_resamplerInput.resize(sampleCount);
+                priv::convertSamples(samples, &m_resamplerInput[0], sampleCount);
+                floatSamples = &m_resamplerInput[0];
+            }
+
+            m_resampler.process(floatSamples, sampleCount / m_channelCount, m_resampledSamples);
+        }
+
+        // Don't lose the last samples held back by the filter
+        if (requestStop)
+            m_resampler.flush(m_resampledSamples);
+
+        m_pendingSources += sampleCount;
+
+        // A very short chunk may not be enough to produce any output yet
+        if (m_resampledSamples.empty() && sampleCount && !requestStop)
+            return fillAndPushBuffer(bufferNum);
+
+        samples = NULL;
+        floatSamples = m_resampledSamples.empty() ? NULL : &m_resampledSamples[0];
+        sampleCount = m_resampledSamples.size();
+        sourceCount = m_pendingSources;
+    }
+
     // Fill the buffer if some data was returned
-    if (data.samples && data.sampleCount)
+    if (sampleCount)
     {
         unsigned int buffer = m_buffers[bufferNum];
 
         // Fill the buffer
-        ALsizei size = static_cast<ALsizei>(data.sampleCount) * sizeof(Int16);
-        alCheck(alBufferData(buffer, m_format, data.samples, size, m_sampleRate));
+        if (floatSamples && m_floatFormat)
+        {
+            ALsizei size = static_cast<ALsizei>(sampleCount) * sizeof(float);
+            alCheck(alBufferData(buffer, m_floatFormat, floatSamples, size, m_streamRate));
+        }
+        else
+        {
+            // Floating point samples are not supported by the device: convert them
+            if (floatSamples)
+            {
+                m_convertedSamples.resize(sampleCount);
+                priv::convertSamples(floatSamples, &m_convertedSamples[0], sampleCount);
+                samples = &m_convertedSamples[0];
+            }
+
+            ALsizei size = static_cast<ALsizei>(sampleCount) * sizeof(Int16);
+            alCheck(alBufferData(buffer, m_format, samples, size, m_streamRate));
+        }
 
         // Push it into the sound queue
         alCheck(alSourceQueueBuffers(m_source, 1, &buffer));
+        m_bufferSamples[bufferNum] = sampleCount;
+        m_bufferSources[bufferNum] = sourceCount;
+        m_pendingSources = 0;
+        m_queue.push_back(bufferNum);
     }
 
     return requestStop;
@@ -447,7 +669,7 @@ bool SoundStream::fillQueue()
 {
     // Fill and enqueue all the available buffers
     bool requestStop = false;
-    for (int i = 0; (i < BufferCount) && !requestStop; ++i)
+    for (unsigned int i = 0; (i < m_buffers.size()) && !requestStop; ++i)
     {
         if (fillAndPushBuffer(i))
             requestStop = true;
@@ -468,6 +690,33 @@ void SoundStream::clearQueue()
     ALuint buffer;
     for (ALint i = 0; i < nbQueued; ++i)
         alCheck(alSourceUnqueueBuffers(m_source, 1, &buffer));
+
+    m_queue.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+Time SoundStream::getRefillDelay() const
+{
+    // Never spin: even when a buffer is already processed, give the device a little time
+    const Time minimumDelay = milliseconds(1);
+
+    if (m_queue.empty() || !m_streamRate || !m_channelCount)
+        return minimumDelay;
+
+    // The sample offset is relative to the first buffer still queued
+    ALint offset = 0;
+    alCheck(alGetSourcei(m_source, AL_SAMPLE_OFFSET, &offset));
+
+    Int64 frames    = static_cast<Int64>(m_bufferSamples[m_queue.front()] / m_channelCount);
+    Int64 remaining = frames - offset;
+    if (remaining <= 0)
+        return minimumDelay;
+
+    float pitch = std::max(getPitch(), 0.01f);
+    Time delay = seconds(static_cast<float>(remaining) / m_streamRate / pitch);
+
+    return std::max(delay, minimumDelay);
 }
 
 } // namespace sf
@@ -0,0 +1,421 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/StreamScheduler.hpp>
+#include <SFML/Audio/SoundStream.hpp>
+#include <SFML/System/Lock.hpp>
+
+
+namespace
+{
+    // Sound streams counter, number of worker threads and their mutex
+    unsigned int streamCount = 0;
+    unsigned int threadCount = 1;
+    sf::Mutex mutex;
+
+    // The scheduler is instantiated when the first stream starts playing,
+    // and destroyed when no sound stream is alive anymore
+    sf::priv::StreamScheduler* globalScheduler = NULL;
+}
+
+
+namespace sf
+{
+namespace priv
+{
+////////////////////////////////////////////////////////////
+StreamTask::StreamTask() :
+m_mutex    (),
+m_wakeMutex(),
+m_scheduler(NULL),
+m_woken    (false)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void StreamScheduler::registerStream()
+{
+    Lock lock(mutex);
+
+    streamCount++;
+}
+
+
+////////////////////////////////////////////////////////////
+void StreamScheduler::unregisterStream()
+{
+    Lock lock(mutex);
+
+    streamCount--;
+
+    // If there's no more stream alive, we can stop the worker threads
+    if ((streamCount == 0) && globalScheduler)
+    {
+        delete globalScheduler;
+        globalScheduler = NULL;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void StreamScheduler::addStream(SoundStream& stream)
+{
+    Lock lock(mutex);
+
+    if (!globalScheduler)
+        globalScheduler = new StreamScheduler(threadCount);
+
+    StreamScheduler& scheduler = *globalScheduler;
+
+    {
+        Lock schedulerLock(scheduler.m_mutex);
+
+        Entry entry;
+        entry.id     = scheduler.m_nextId++;
+        entry.stream = &stream;
+        entry.task   = NULL;
+        entry.due    = scheduler.m_clock.getElapsedTime();
+        entry.busy   = false;
+        entry.idle   = false;
+        scheduler.m_entries.push_front(entry);
+    }
+
+    // Wake a worker up so that the new stream starts immediately
+    scheduler.m_signal.notify();
+}
+
+
+////////////////////////////////////////////////////////////
+void StreamScheduler::removeStream(SoundStream& stream)
+{
+    Lock lock(mutex);
+
+    if (!globalScheduler)
+        return;
+
+    {
+        Lock schedulerLock(globalScheduler->m_mutex);
+
+        std::list<Entry>::iterator it = globalScheduler->m_entries.begin();
+        while (it != globalScheduler->m_entries.end())
+        {
+            if (it->stream == &stream)
+                it = globalScheduler->m_entries.erase(it);
+            else
+                ++it;
+        }
+    }
+
+    // If a worker is currently servicing the stream, wait until it's done
+    Lock streamLock(stream.m_streamMutex);
+}
+
+
+////////////////////////////////////////////////////////////
+void StreamScheduler::addTask(StreamTask& task)
+{
+    Lock lock(mutex);
+
+    // The global mutex serializes the additions and removals, the mutex
+    // of the task is not held along with the one of the scheduler
+    {
+        Lock taskLock(task.m_wakeMutex);
+
+        if (task.m_scheduler)
+            return;
+    }
+
+    if (!globalScheduler)
+        globalScheduler = new StreamScheduler(threadCount);
+
+    StreamScheduler& scheduler = *globalScheduler;
+
+    {
+        Lock schedulerLock(scheduler.m_mutex);
+
+        Entry entry;
+        entry.id     = scheduler.m_nextId++;
+        entry.stream = NULL;
+        entry.task   = &task;
+        entry.due    = scheduler.m_clock.getElapsedTime();
+        entry.busy   = false;
+        entry.idle   = false;
+        scheduler.m_entries.push_front(entry);
+    }
+
+    {
+        Lock taskLock(task.m_wakeMutex);
+
+        task.m_scheduler = &scheduler;
+        task.m_woken = false;
+    }
+
+    // Wake a worker up so that the new task runs immediately
+    scheduler.m_signal.notify();
+}
+
+
+////////////////////////////////////////////////////////////
+void StreamScheduler::removeTask(StreamTask& task)
+{
+    Lock lock(mutex);
+
+    StreamScheduler* scheduler = NULL;
+    {
+        Lock taskLock(task.m_wakeMutex);
+
+        scheduler = task.m_scheduler;
+        task.m_scheduler = NULL;
+    }
+
+    if (!scheduler)
+        return;
+
+    {
+        Lock schedulerLock(scheduler->m_mutex);
+
+        std::list<Entry>::iterator it = scheduler->m_entries.begin();
+        while (it != scheduler->m_entries.end())
+        {
+            if (it->task == &task)
+                it = scheduler->m_entries.erase(it);
+            else
+                ++it;
+        }
+    }
+
+    // If a worker is currently running the task, wait until it's done
+    Lock runLock(task.m_mutex);
+}
+
+
+////////////////////////////////////////////////////////////
+void StreamScheduler::wakeTask(StreamTask& task)
+{
+    // Only flag the task: the workers check the flag of the sleeping tasks
+    Lock taskLock(task.m_wakeMutex);
+
+    if (task.m_scheduler)
+    {
+        task.m_woken = true;
+        task.m_scheduler->m_signal.notify();
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void StreamScheduler::setThreadCount(unsigned int count)
+{
+    Lock lock(mutex);
+
+    if (count < 1)
+        count = 1;
+
+    if (count == threadCount)
+        return;
+
+    threadCount = count;
+
+    // Restart the workers, the scheduled streams are kept
+    if (globalScheduler)
+    {
+        globalScheduler->stopThreads();
+        globalScheduler->startThreads(threadCount);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int StreamScheduler::getThreadCount()
+{
+    Lock lock(mutex);
+
+    return threadCount;
+}
+
+
+////////////////////////////////////////////////////////////
+StreamScheduler::StreamScheduler(unsigned int threadCount) :
+m_mutex  (),
+m_signal (),
+m_entries(),
+m_threads(),
+m_running(false),
+m_nextId (0),
+m_clock  ()
+{
+    startThreads(threadCount);
+}
+
+
+////////////////////////////////////////////////////////////
+StreamScheduler::~StreamScheduler()
+{
+    stopThreads();
+}
+
+
+////////////////////////////////////////////////////////////
+void StreamScheduler::startThreads(unsigned int threadCount)
+{
+    m_running = true;
+
+    for (unsigned int i = 0; i < threadCount; ++i)
+    {
+        m_threads.push_back(new Thread(&StreamScheduler::run, this));
+        m_threads.back()->launch();
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void StreamScheduler::stopThreads()
+{
+    {
+        Lock lock(m_mutex);
+        m_running = false;
+    }
+
+    // Each worker wakes the next one up before terminating
+    m_signal.notify();
+
+    for (std::vector<Thread*>::iterator it = m_threads.begin(); it != m_threads.end(); ++it)
+    {
+        (*it)->wait();
+        delete *it;
+    }
+
+    m_threads.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+void StreamScheduler::run()
+{
+    m_mutex.lock();
+
+    while (m_running)
+    {
+        Time now = m_clock.getElapsedTime();
+
+        // Find the most urgent stream or awake task that no other worker is servicing;
+        // on equal due times, the least recently serviced one comes first
+        std::list<Entry>::iterator next = m_entries.end();
+        for (std::list<Entry>::iterator it = m_entries.begin(); it != m_entries.end(); ++it)
+        {
+            // Sleeping tasks which have been woken up are due immediately
+            if (it->idle)
+            {
+                Lock taskLock(it->task->m_wakeMutex);
+                if (it->task->m_woken)
+                {
+                    it->task->m_woken = false;
+                    it->idle = false;
+                    it->due  = now;
+                }
+            }
+
+            if (!it->busy && !it->idle && ((next == m_entries.end()) || (it->due < next->due)))
+                next = it;
+        }
+
+        if ((next == m_entries.end()) || (next->due > now))
+        {
+            // Nothing to do yet: sleep until the next stream is due, or until we are notified
+            bool idle = (next == m_entries.end());
+            Time timeout = idle ? Time::Zero : next->due - now;
+
+            m_mutex.unlock();
+
+            if (idle)
+                m_signal.wait();
+            else
+                m_signal.wait(timeout);
+
+            m_mutex.lock();
+            continue;
+        }
+
+        // Service the stream or run the task outside of the scheduler lock; their own
+        // mutex tells removeStream and removeTask when we are done with them
+        next->busy = true;
+        Uint64 id = next->id;
+        SoundStream* stream = next->stream;
+        StreamTask* task = next->task;
+        if (stream)
+            stream->m_streamMutex.lock();
+        else
+            task->m_mutex.lock();
+
+        m_mutex.unlock();
+
+        Time delay = Time::Zero;
+        bool keep = true;
+        bool idle = false;
+        if (stream)
+        {
+            keep = stream->streamData(delay);
+            stream->m_streamMutex.unlock();
+        }
+        else
+        {
+            idle = !task->run();
+            task->m_mutex.unlock();
+        }
+
+        m_mutex.lock();
+
+        // The entry may have been removed while we were servicing it
+        for (std::list<Entry>::iterator it = m_entries.begin(); it != m_entries.end(); ++it)
+        {
+            if (it->id == id)
+            {
+                if (keep)
+                {
+                    Entry entry = *it;
+                    entry.due  = m_clock.getElapsedTime() + delay;
+                    entry.busy = false;
+                    entry.idle = idle;
+                    m_entries.push_back(entry);
+                }
+
+                m_entries.erase(it);
+                break;
+            }
+        }
+    }
+
+    m_mutex.unlock();
+
+    // Let the next worker know that it must stop too
+    m_signal.notify();
+}
+
+} // namespace priv
+
+} // namespace sf
@@ -0,0 +1,275 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_STREAMSCHEDULER_HPP
+#define SFML_STREAMSCHEDULER_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/Mutex.hpp>
+#include <SFML/System/NonCopyable.hpp>
+#include <SFML/System/Thread.hpp>
+#include <SFML/System/ThreadSignal.hpp>
+#include <list>
+#include <vector>
+
+
+namespace sf
+{
+class SoundStream;
+
+namespace priv
+{
+class StreamScheduler;
+
+////////////////////////////////////////////////////////////
+/// \brief Background work run by the worker threads of the
+///        stream scheduler, along with the streams
+///
+////////////////////////////////////////////////////////////
+class StreamTask : NonCopyable
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    StreamTask();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Virtual destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual ~StreamTask() {}
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Do the next piece of work of the task
+    ///
+    /// The task should do a small amount of work at a time,
+    /// as it delays the streams serviced by the same worker.
+    ///
+    /// \return True if there is more work to do, false to sleep until the task is woken up
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual bool run() = 0;
+
+private:
+
+    friend class StreamScheduler;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Mutex            m_mutex;     ///< Held while a worker runs the task
+    Mutex            m_wakeMutex; ///< Mutex protecting the scheduler pointer and the wake-up flag
+    StreamScheduler* m_scheduler; ///< Scheduler running the task (NULL if it was not added)
+    bool             m_woken;     ///< Has the task been woken up since it last ran?
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Pool of worker threads that feeds all the playing
+///        sound streams
+///
+/// The scheduler is instantiated when the first stream starts
+/// playing (or the first task is added), and destroyed with
+/// the last sound stream.
+///
+////////////////////////////////////////////////////////////
+class StreamScheduler : NonCopyable
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Declare a new sound stream instance
+    ///
+    /// Called by every sound stream on construction, so that the
+    /// scheduler knows how long it must stay alive.
+    ///
+    ////////////////////////////////////////////////////////////
+    static void registerStream();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Declare the destruction of a sound stream instance
+    ///
+    /// The scheduler and its threads are destroyed with the last
+    /// sound stream.
+    ///
+    ////////////////////////////////////////////////////////////
+    static void unregisterStream();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start servicing a stream
+    ///
+    /// The stream is serviced as soon as possible, then again
+    /// every time its refill delay has elapsed, until it ends or
+    /// is removed.
+    ///
+    /// \param stream Stream to service
+    ///
+    ////////////////////////////////////////////////////////////
+    static void addStream(SoundStream& stream);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Stop servicing a stream
+    ///
+    /// When this function returns, the stream is no longer
+    /// being serviced by any worker thread and will not be
+    /// anymore, until it is added again.
+    ///
+    /// \param stream Stream to remove
+    ///
+    ////////////////////////////////////////////////////////////
+    static void removeStream(SoundStream& stream);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start running a background task
+    ///
+    /// The task runs as soon as possible, then again as long as
+    /// it has work to do; it then sleeps until it is woken up.
+    /// It must be added by a thread which is not a worker.
+    /// Adding a task which is already added does nothing.
+    ///
+    /// \param task Task to run
+    ///
+    ////////////////////////////////////////////////////////////
+    static void addTask(StreamTask& task);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Stop running a background task
+    ///
+    /// When this function returns, the task is no longer being
+    /// run by any worker thread and will not be anymore, until
+    /// it is added again. It must be called by a thread which
+    /// is not a worker.
+    ///
+    /// \param task Task to remove
+    ///
+    ////////////////////////////////////////////////////////////
+    static void removeTask(StreamTask& task);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wake a sleeping background task up
+    ///
+    /// If the task is running, it runs again once it is done.
+    /// Unlike the other functions, this one doesn't lock the
+    /// scheduler: it can be called from the worker threads and
+    /// with any lock held (typically by a stream that has work
+    /// for a task). It does nothing if the task was not added.
+    ///
+    /// \param task Task to wake up
+    ///
+    ////////////////////////////////////////////////////////////
+    static void wakeTask(StreamTask& task);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the number of worker threads
+    ///
+    /// \param count Number of worker threads (at least 1)
+    ///
+    ////////////////////////////////////////////////////////////
+    static void setThreadCount(unsigned int count);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of worker threads
+    ///
+    /// \return Number of worker threads
+    ///
+    ////////////////////////////////////////////////////////////
+    static unsigned int getThreadCount();
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Stream scheduled for servicing
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Entry
+    {
+        Uint64       id;     ///< Unique identifier, streams may be removed and added again while being serviced
+        SoundStream* stream; ///< Stream to service (NULL for a task)
+        StreamTask*  task;   ///< Task to run (NULL for a stream)
+        Time         due;    ///< Time at which the stream needs to be serviced
+        bool         busy;   ///< Is a worker servicing the stream?
+        bool         idle;   ///< Is the task sleeping until it is woken up?
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Constructor
+    ///
+    /// \param threadCount Number of worker threads to start
+    ///
+    ////////////////////////////////////////////////////////////
+    StreamScheduler(unsigned int threadCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~StreamScheduler();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start the worker threads
+    ///
+    /// \param threadCount Number of worker threads to start
+    ///
+    ////////////////////////////////////////////////////////////
+    void startThreads(unsigned int threadCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Stop the worker threads and wait for them to terminate
+    ///
+    ////////////////////////////////////////////////////////////
+    void stopThreads();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Entry point of the worker threads
+    ///
+    /// Workers service the most urgent stream or task which is
+    /// not already being serviced, and sleep until the next one
+    /// is due.
+    ///
+    ////////////////////////////////////////////////////////////
+    void run();
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Mutex                m_mutex;   ///< Mutex protecting the entries and the running flag
+    ThreadSignal         m_signal;  ///< Wakes a worker up when a stream or task is added or the workers must stop
+    std::list<Entry>     m_entries; ///< Streams and tasks to service, serviced ones are moved to the back
+    std::vector<Thread*> m_threads; ///< Worker threads
+    bool                 m_running; ///< Must the workers keep running?
+    Uint64               m_nextId;  ///< Identifier of the next entry
+    Clock                m_clock;   ///< Time base of the due times
+};
+
+} // namespace priv
+
+} // namespace sf
+
+
+#endif // SFML_STREAMSCHEDULER_HPP
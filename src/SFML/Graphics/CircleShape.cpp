@@ -26,7 +26,39 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/CircleShape.hpp>
+#include <SFML/System/Mutex.hpp>
+#include <SFML/System/Lock.hpp>
 #include <cmath>
+#include <map>
+
+
+namespace
+{
+    sf::Mutex mutex;
+
+    // Get the points of the circle of radius 1 centered on (0, 0),
+    // computed once and shared by all the circles with the same point count
+    const sf::Vector2f* getUnitCircle(std::size_t pointCount)
+    {
+        static const float pi = 3.141592654f;
+        static std::map<std::size_t, std::vector<sf::Vector2f> > circles;
+
+        sf::Lock lock(mutex);
+
+        std::vector<sf::Vector2f>& points = circles[pointCount];
+        if (points.empty() && (pointCount > 0))
+        {
+            points.resize(pointCount);
+            for (std::size_t i = 0; i < pointCount; ++i)
+            {
+                float angle = i * 2 * pi / pointCount - pi / 2;
+                points[i] = sf::Vector2f(std::cos(angle), std::sin(angle));
+            }
+        }
+
+        return points.empty() ? NULL : &points[0];
+    }
+}
 
 
 namespace sf
@@ -34,7 +66,8 @@ namespace sf
 ////////////////////////////////////////////////////////////
 CircleShape::CircleShape(float radius, std::size_t pointCount) :
 m_radius    (radius),
-m_pointCount(pointCount)
+m_pointCount(pointCount),
+m_unitPoints(getUnitCircle(pointCount))
 {
     update();
 }
@@ -43,8 +76,11 @@ m_pointCount(pointCount)
 ////////////////////////////////////////////////////////////
 void CircleShape::setRadius(float radius)
 {
-    m_radius = radius;
-    update();
+    if (radius != m_radius)
+    {
+        m_radius = radius;
+        update();
+    }
 }
 
 
@@ -58,8 +94,12 @@ float CircleShape::getRadius() const
 ////////////////////////////////////////////////////////////
 void CircleShape::setPointCount(std::size_t count)
 {
-    m_pointCount = count;
-    update();
+    if (count != m_pointCount)
+    {
+        m_pointCount = count;
+        m_unitPoints = getUnitCircle(count);
+        update();
+    }
 }
 
 ////////////////////////////////////////////////////////////
@@ -72,13 +112,9 @@ std::size_t CircleShape::getPointCount() const
 ////////////////////////////////////////////////////////////
 Vector2f CircleShape::getPoint(std::size_t index) const
 {
-    static const float pi = 3.141592654f;
-
-    float angle = index * 2 * pi / m_pointCount - pi / 2;
-    float x = std::cos(angle) * m_radius;
-    float y = std::sin(angle) * m_radius;
+    const Vector2f& point = m_unitPoints[index];
 
-    return Vector2f(m_radius + x, m_radius + y);
+    return Vector2f(m_radius + point.x * m_radius, m_radius + point.y * m_radius);
 }
 
 } // namespace sf
@@ -0,0 +1,816 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/CoreRenderer.hpp>
+#include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Window/Context.hpp>
+#include <SFML/System/Err.hpp>
+#include <SFML/System/Mutex.hpp>
+#include <SFML/System/Lock.hpp>
+#include <algorithm>
+#include <map>
+
+
+#ifndef SFML_OPENGL_ES
+
+namespace
+{
+    // Renderer of each context, NULL if the context can't use one
+    typedef std::map<sf::Uint64, sf::priv::CoreRenderer*> RendererMap;
+    RendererMap renderers;
+    sf::Mutex renderersMutex;
+
+    // Destroy the renderer of a context that is being destroyed
+    void destroyRenderer(sf::Uint64 contextId, void*)
+    {
+        sf::Lock lock(renderersMutex);
+
+        RendererMap::iterator it = renderers.find(contextId);
+        if (it != renderers.end())
+        {
+            delete it->second;
+            renderers.erase(it);
+        }
+    }
+
+    // Initial size of the regions of the vertex and index buffers, in bytes
+    const std::size_t initialVertexRegionSize = 16384 * sizeof(sf::Vertex);
+    const std::size_t initialIndexRegionSize = 16384 * sizeof(sf::Uint32);
+
+    // Time to wait for a fence before flushing again, in nanoseconds
+    const GLuint64 fenceTimeout = 1000000;
+
+    // Source code of the built-in program; the attribute
+    // locations are bound by name before linking, the same
+    // way sf::Shader does for user programs
+    const char* vertexShaderSource =
+        "#version 150\n"
+        "uniform mat4 sf_viewProjection;\n"
+        "uniform mat4 sf_model;\n"
+        "uniform mat4 sf_textureMatrix;\n"
+        "in vec2 sf_position;\n"
+        "in vec4 sf_color;\n"
+        "in vec2 sf_texCoords;\n"
+        "out vec4 color;\n"
+        "out vec2 texCoords;\n"
+        "void main()\n"
+        "{\n"
+        "    gl_Position = sf_viewProjection * sf_model * vec4(sf_position, 0.0, 1.0);\n"
+        "    color = sf_color;\n"
+        "    texCoords = (sf_textureMatrix * vec4(sf_texCoords, 0.0, 1.0)).xy;\n"
+        "}\n";
+
+    const char* fragmentShaderSource =
+        "#version 150\n"
+        "uniform sampler2D sf_texture;\n"
+        "uniform float sf_textured;\n"
+        "in vec4 color;\n"
+        "in vec2 texCoords;\n"
+        "out vec4 fragColor;\n"
+        "void main()\n"
+        "{\n"
+        "    fragColor = color * mix(vec4(1.0), texture(sf_texture, texCoords), sf_textured);\n"
+        "}\n";
+
+    // Compile a shader of the built-in program
+    GLuint compileShader(GLenum type, const char* source)
+    {
+        GLuint shader;
+        glCheck(shader = glCreateShader(type));
+        glCheck(glShaderSource(shader, 1, &source, NULL));
+        glCheck(glCompileShader(shader));
+
+        GLint success;
+        glCheck(glGetShaderiv(shader, GL_COMPILE_STATUS, &success));
+        if (success == GL_FALSE)
+        {
+            char log[1024];
+            glCheck(glGetShaderInfoLog(shader, sizeof(log), 0, log));
+            sf::err() << "Failed to compile built-in shader:" << std::endl
+                      << log << std::endl;
+            glCheck(glDeleteShader(shader));
+            return 0;
+        }
+
+        return shader;
+    }
+
+    // Offset of data in a buffer object, as expected by OpenGL
+    const GLvoid* bufferOffset(std::size_t offset)
+    {
+        return reinterpret_cast<const GLvoid*>(offset);
+    }
+
+    // Round an offset up to a multiple of an alignment
+    std::size_t align(std::size_t offset, std::size_t alignment)
+    {
+        return (offset + alignment - 1) / alignment * alignment;
+    }
+
+    // Find the OpenGL primitive type, quads are drawn as pairs of triangles
+    GLenum getMode(sf::PrimitiveType type)
+    {
+        static const GLenum modes[] = {GL_POINTS, GL_LINES, GL_LINE_STRIP, GL_TRIANGLES,
+                                       GL_TRIANGLE_STRIP, GL_TRIANGLE_FAN, GL_TRIANGLES};
+        return modes[type];
+    }
+
+    // Copy vertices or indices, converting quads to pairs of triangles
+    template <typename T>
+    void copyElements(const T* elements, std::size_t count, sf::PrimitiveType type, T* destination)
+    {
+        if (type == sf::Quads)
+        {
+            for (std::size_t i = 0; i < count / 4; ++i)
+            {
+                const T* quad = elements + i * 4;
+
+                *destination++ = quad[0];
+                *destination++ = quad[1];
+                *destination++ = quad[2];
+                *destination++ = quad[0];
+                *destination++ = quad[2];
+                *destination++ = quad[3];
+            }
+        }
+        else
+        {
+            std::copy(elements, elements + count, destination);
+        }
+    }
+
+    // Number of elements written by copyElements
+    std::size_t getElementCount(std::size_t count, sf::PrimitiveType type)
+    {
+        return (type == sf::Quads) ? count / 4 * 6 : count;
+    }
+}
+
+
+namespace sf
+{
+namespace priv
+{
+////////////////////////////////////////////////////////////
+CoreRenderer* CoreRenderer::getActive()
+{
+    Uint64 contextId = Context::getActiveContextId();
+    if (!contextId)
+        return NULL;
+
+    Lock lock(renderersMutex);
+
+    RendererMap::iterator it = renderers.find(contextId);
+    if (it != renderers.end())
+        return it->second;
+
+    CoreRenderer* renderer = NULL;
+
+    if (Context::getActiveContextSettings().attributeFlags & ContextSettings::Core)
+    {
+        ensureExtensionsInit();
+
+        if (GLEXT_core_profile)
+        {
+            renderer = new CoreRenderer;
+            if (!renderer->create())
+            {
+                delete renderer;
+                renderer = NULL;
+            }
+        }
+
+        if (!renderer)
+            err() << "Failed to create the core profile renderer, drawing will not work in this context" << std::endl;
+    }
+
+    // Failures are stored as well, so that we don't retry on every state reset
+    renderers[contextId] = renderer;
+    Context::registerContextDestroyCallback(&destroyRenderer, NULL);
+
+    return renderer;
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderer::forgetProgram(unsigned int program)
+{
+    Lock lock(renderersMutex);
+
+    for (RendererMap::iterator it = renderers.begin(); it != renderers.end(); ++it)
+    {
+        CoreRenderer* renderer = it->second;
+        if (!renderer)
+            continue;
+
+        renderer->m_programUniforms.erase(program);
+
+        // A new program with the same name must be selected again
+        if (renderer->m_currentProgram == program)
+            renderer->m_currentProgram = 0;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+CoreRenderer::~CoreRenderer()
+{
+    Ring* rings[] = {&m_vertices, &m_indices};
+    for (std::size_t i = 0; i < 2; ++i)
+    {
+        for (std::size_t j = 0; j < RegionCount; ++j)
+        {
+            if (rings[i]->fences[j])
+                glCheck(glDeleteSync(static_cast<GLsync>(rings[i]->fences[j])));
+        }
+
+        // Deleting a buffer also unmaps it
+        if (rings[i]->buffer)
+            glCheck(glDeleteBuffers(1, &rings[i]->buffer));
+    }
+
+    for (std::size_t i = 0; i < LayoutCount; ++i)
+    {
+        if (m_vertexArrays[i].object)
+            glCheck(glDeleteVertexArrays(1, &m_vertexArrays[i].object));
+    }
+
+    if (m_program)
+        glCheck(glDeleteProgram(m_program));
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderer::resetStates()
+{
+    glCheck(glBindBuffer(GL_ARRAY_BUFFER, m_vertices.buffer));
+
+    // Force the vertex array object and its buffers to be set again
+    for (std::size_t i = 0; i < LayoutCount; ++i)
+    {
+        m_vertexArrays[i].vertexBuffer = 0;
+        m_vertexArrays[i].indexBuffer = 0;
+    }
+    m_layout = LayoutCount;
+    setLayout(StandardLayout);
+
+    // Force the program and its uniforms to be set again
+    m_currentProgram = 0;
+    useProgram(0);
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderer::useProgram(unsigned int program)
+{
+    if (!program)
+        program = m_program;
+
+    if (program == m_currentProgram)
+        return;
+
+    glCheck(glUseProgram(program));
+    m_currentProgram = program;
+
+    // Look the uniforms up only the first time the program is used;
+    // user programs may not declare all of them, in which case
+    // their location is -1 and setting them does nothing
+    UniformsMap::iterator it = m_programUniforms.find(program);
+    if (it == m_programUniforms.end())
+    {
+        Uniforms uniforms;
+        glCheck(uniforms.viewProjection = glGetUniformLocation(program, "sf_viewProjection"));
+        glCheck(uniforms.model = glGetUniformLocation(program, "sf_model"));
+        glCheck(uniforms.textureMatrix = glGetUniformLocation(program, "sf_textureMatrix"));
+        glCheck(uniforms.textured = glGetUniformLocation(program, "sf_textured"));
+        glCheck(uniforms.texture = glGetUniformLocation(program, "sf_texture"));
+        it = m_programUniforms.insert(std::make_pair(program, uniforms)).first;
+    }
+    m_uniforms = it->second;
+
+    // Upload the current values to the new program
+    setMatrix(m_uniforms.viewProjection, m_viewProjection);
+    setMatrix(m_uniforms.model, m_model);
+    setTexture(m_textureMatrix, m_textured);
+
+    if (m_uniforms.texture != -1)
+        glCheck(glUniform1i(m_uniforms.texture, 0));
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderer::setViewProjection(const Transform& transform)
+{
+    m_viewProjection = transform;
+    setMatrix(m_uniforms.viewProjection, transform);
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderer::setModel(const Transform& transform)
+{
+    m_model = transform;
+    setMatrix(m_uniforms.model, transform);
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderer::setTexture(const Transform& transform, bool textured)
+{
+    m_textureMatrix = transform;
+    m_textured = textured;
+    setMatrix(m_uniforms.textureMatrix, transform);
+
+    if (m_uniforms.textured != -1)
+        glCheck(glUniform1f(m_uniforms.textured, textured ? 1.f : 0.f));
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderer::draw(const Vertex* vertices, std::size_t vertexCount, PrimitiveType type)
+{
+    drawArrays(vertices, vertexCount, type, StandardLayout);
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderer::draw(const Vertex* vertices, std::size_t vertexCount, const void* indices,
+                        std::size_t indexCount, std::size_t indexSize, PrimitiveType type)
+{
+    drawElements(vertices, vertexCount, indices, indexCount, indexSize, type, StandardLayout);
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderer::draw(const CompactVertex* vertices, std::size_t vertexCount, PrimitiveType type)
+{
+    drawArrays(vertices, vertexCount, type, CompactLayout);
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderer::draw(const CompactVertex* vertices, std::size_t vertexCount, const void* indices,
+                        std::size_t indexCount, std::size_t indexSize, PrimitiveType type)
+{
+    drawElements(vertices, vertexCount, indices, indexCount, indexSize, type, CompactLayout);
+}
+
+
+////////////////////////////////////////////////////////////
+CoreRenderer::CoreRenderer() :
+m_program        (0),
+m_currentProgram (0),
+m_uniforms       (),
+m_programUniforms(),
+m_vertexArrays   (),
+m_layout         (LayoutCount),
+m_vertices       (),
+m_indices        (),
+m_viewProjection (),
+m_model          (),
+m_textureMatrix  (),
+m_textured       (false)
+{
+    m_uniforms.viewProjection = -1;
+    m_uniforms.model = -1;
+    m_uniforms.textureMatrix = -1;
+    m_uniforms.textured = -1;
+    m_uniforms.texture = -1;
+
+    for (std::size_t i = 0; i < LayoutCount; ++i)
+    {
+        m_vertexArrays[i].object = 0;
+        m_vertexArrays[i].vertexBuffer = 0;
+        m_vertexArrays[i].indexBuffer = 0;
+    }
+
+    m_vertices.target = GL_ARRAY_BUFFER;
+    m_indices.target = GL_ELEMENT_ARRAY_BUFFER;
+
+    Ring* rings[] = {&m_vertices, &m_indices};
+    for (std::size_t i = 0; i < 2; ++i)
+    {
+        rings[i]->buffer = 0;
+        rings[i]->mapping = NULL;
+        rings[i]->regionSize = 0;
+        rings[i]->region = 0;
+        rings[i]->regionOffset = 0;
+        for (std::size_t j = 0; j < RegionCount; ++j)
+            rings[i]->fences[j] = NULL;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool CoreRenderer::create()
+{
+    // Build the built-in program
+    GLuint vertexShader = compileShader(GL_VERTEX_SHADER, vertexShaderSource);
+    GLuint fragmentShader = compileShader(GL_FRAGMENT_SHADER, fragmentShaderSource);
+    if (!vertexShader || !fragmentShader)
+    {
+        if (vertexShader)
+            glCheck(glDeleteShader(vertexShader));
+        if (fragmentShader)
+            glCheck(glDeleteShader(fragmentShader));
+        return false;
+    }
+
+    glCheck(m_program = glCreateProgram());
+    glCheck(glAttachShader(m_program, vertexShader));
+    glCheck(glAttachShader(m_program, fragmentShader));
+    glCheck(glBindAttribLocation(m_program, 0, "sf_position"));
+    glCheck(glBindAttribLocation(m_program, 1, "sf_color"));
+    glCheck(glBindAttribLocation(m_program, 2, "sf_texCoords"));
+    glCheck(glLinkProgram(m_program));
+
+    // The shaders are not needed anymore, they are deleted with the program
+    glCheck(glDeleteShader(vertexShader));
+    glCheck(glDeleteShader(fragmentShader));
+
+    GLint success;
+    glCheck(glGetProgramiv(m_program, GL_LINK_STATUS, &success));
+    if (success == GL_FALSE)
+    {
+        char log[1024];
+        glCheck(glGetProgramInfoLog(m_program, sizeof(log), 0, log));
+        err() << "Failed to link built-in shader:" << std::endl
+              << log << std::endl;
+        glCheck(glDeleteProgram(m_program));
+        m_program = 0;
+        return false;
+    }
+
+    // The attribute pointers are set by setLayout, once the buffers exist
+    for (std::size_t i = 0; i < LayoutCount; ++i)
+    {
+        glCheck(glGenVertexArrays(1, &m_vertexArrays[i].object));
+        glCheck(glBindVertexArray(m_vertexArrays[i].object));
+
+        glCheck(glEnableVertexAttribArray(0));
+        glCheck(glEnableVertexAttribArray(1));
+        glCheck(glEnableVertexAttribArray(2));
+    }
+
+    createBuffer(m_vertices, initialVertexRegionSize);
+    createBuffer(m_indices, initialIndexRegionSize);
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderer::createBuffer(Ring& ring, std::size_t regionSize)
+{
+    // The driver releases the previous buffer only once the
+    // GPU is done with it, its fences don't need to be waited for
+    for (std::size_t i = 0; i < RegionCount; ++i)
+    {
+        if (ring.fences[i])
+        {
+            glCheck(glDeleteSync(static_cast<GLsync>(ring.fences[i])));
+            ring.fences[i] = NULL;
+        }
+    }
+
+    if (ring.buffer)
+        glCheck(glDeleteBuffers(1, &ring.buffer));
+
+    // The new buffer may get the name of the deleted one, so the names
+    // cached by the vertex array objects can't tell that it changed
+    for (std::size_t i = 0; i < LayoutCount; ++i)
+    {
+        m_vertexArrays[i].vertexBuffer = 0;
+        m_vertexArrays[i].indexBuffer = 0;
+    }
+
+    ring.mapping = NULL;
+    ring.regionSize = regionSize;
+    ring.region = 0;
+    ring.regionOffset = 0;
+
+    GLsizeiptr size = static_cast<GLsizeiptr>(regionSize * RegionCount);
+
+    glCheck(glGenBuffers(1, &ring.buffer));
+    glCheck(glBindBuffer(ring.target, ring.buffer));
+
+    if (GLEXT_buffer_storage)
+    {
+        // Immutable storage can stay mapped while the GPU reads from it
+        GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        glCheck(glBufferStorage(ring.target, size, NULL, flags));
+
+        void* pointer;
+        glCheck(pointer = glMapBufferRange(ring.target, 0, size, flags));
+        ring.mapping = static_cast<char*>(pointer);
+    }
+    else
+    {
+        glCheck(glBufferData(ring.target, size, NULL, GL_STREAM_DRAW));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t CoreRenderer::reserve(Ring& ring, std::size_t size, std::size_t alignment)
+{
+    // The offset is aligned in the whole buffer, since vertex
+    // layouts of different sizes share the same regions
+    std::size_t start = ring.region * ring.regionSize;
+    std::size_t offset = align(start + ring.regionOffset, alignment);
+
+    if (offset + size > start + ring.regionSize)
+    {
+        if (size + alignment > ring.regionSize)
+        {
+            // The data doesn't fit in a region: grow the buffer
+            createBuffer(ring, std::max(size + alignment, ring.regionSize * 2));
+        }
+        else
+        {
+            // The current region is full: fence it, and move to
+            // the next one once the GPU is done reading it
+            glCheck(ring.fences[ring.region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+            ring.region = (ring.region + 1) % RegionCount;
+            waitRegion(ring, ring.region);
+        }
+
+        start = ring.region * ring.regionSize;
+        offset = align(start, alignment);
+    }
+
+    ring.regionOffset = offset + size - start;
+
+    return offset;
+}
+
+
+////////////////////////////////////////////////////////////
+void* CoreRenderer::map(Ring& ring, std::size_t offset, std::size_t size)
+{
+    // A persistently mapped buffer can be written directly
+    if (ring.mapping)
+        return ring.mapping + offset;
+
+    // The fences already protect the regions in use by
+    // the GPU, so the driver doesn't need to synchronize
+    void* pointer;
+    glCheck(pointer = glMapBufferRange(ring.target, offset, size,
+                                       GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT));
+    if (pointer)
+        return pointer;
+
+    // Mapping failed: the data is uploaded by unmap()
+    ring.staging.resize(size);
+    return &ring.staging[0];
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderer::unmap(Ring& ring, std::size_t offset, std::size_t size)
+{
+    if (ring.mapping)
+        return;
+
+    if (!ring.staging.empty())
+    {
+        glCheck(glBufferSubData(ring.target, offset, size, &ring.staging[0]));
+        ring.staging.clear();
+    }
+    else
+    {
+        glCheck(glUnmapBuffer(ring.target));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderer::waitRegion(Ring& ring, std::size_t region)
+{
+    GLsync fence = static_cast<GLsync>(ring.fences[region]);
+    if (!fence)
+        return;
+
+    GLenum result = GL_TIMEOUT_EXPIRED;
+    while (result == GL_TIMEOUT_EXPIRED)
+        glCheck(result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, fenceTimeout));
+
+    glCheck(glDeleteSync(fence));
+    ring.fences[region] = NULL;
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderer::setLayout(Layout layout)
+{
+    VertexArray& vertexArray = m_vertexArrays[layout];
+
+    if (layout != m_layout)
+    {
+        glCheck(glBindVertexArray(vertexArray.object));
+        m_layout = layout;
+    }
+
+    // The attributes read from the buffer bound when their pointers are set
+    if (vertexArray.vertexBuffer != m_vertices.buffer)
+    {
+        glCheck(glBindBuffer(GL_ARRAY_BUFFER, m_vertices.buffer));
+
+        if (layout == StandardLayout)
+        {
+            glCheck(glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), bufferOffset(0)));
+            glCheck(glVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Vertex), bufferOffset(8)));
+            glCheck(glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), bufferOffset(12)));
+        }
+        else
+        {
+            // The integer components are converted to floats as they are, not normalized
+            glCheck(glVertexAttribPointer(0, 2, GL_SHORT, GL_FALSE, sizeof(CompactVertex), bufferOffset(0)));
+            glCheck(glVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(CompactVertex), bufferOffset(4)));
+            glCheck(glVertexAttribPointer(2, 2, GL_SHORT, GL_FALSE, sizeof(CompactVertex), bufferOffset(8)));
+        }
+
+        vertexArray.vertexBuffer = m_vertices.buffer;
+    }
+
+    // The index buffer binding is part of the vertex array object
+    if (vertexArray.indexBuffer != m_indices.buffer)
+    {
+        glCheck(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_indices.buffer));
+        vertexArray.indexBuffer = m_indices.buffer;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+void CoreRenderer::drawArrays(const T* vertices, std::size_t vertexCount, PrimitiveType type, Layout layout)
+{
+    std::size_t count = getElementCount(vertexCount, type);
+    if (count == 0)
+        return;
+
+    // Write the vertices directly to the vertex buffer
+    std::size_t size = count * sizeof(T);
+    std::size_t offset = reserve(m_vertices, size, sizeof(T));
+    copyElements(vertices, vertexCount, type, static_cast<T*>(map(m_vertices, offset, size)));
+    unmap(m_vertices, offset, size);
+
+    // The attribute pointers always start at the beginning of the
+    // buffer, the position of the vertices is given as first vertex
+    setLayout(layout);
+    GLint first = static_cast<GLint>(offset / sizeof(T));
+    glCheck(glDrawArrays(getMode(type), first, static_cast<GLsizei>(count)));
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+void CoreRenderer::drawElements(const T* vertices, std::size_t vertexCount, const void* indices,
+                                std::size_t indexCount, std::size_t indexSize, PrimitiveType type, Layout layout)
+{
+    std::size_t count = getElementCount(indexCount, type);
+    if ((count == 0) || (vertexCount == 0))
+        return;
+
+    // Write the vertices as they are, quads are converted through their indices
+    std::size_t vertexSize = vertexCount * sizeof(T);
+    std::size_t vertexOffset = reserve(m_vertices, vertexSize, sizeof(T));
+    std::copy(vertices, vertices + vertexCount, static_cast<T*>(map(m_vertices, vertexOffset, vertexSize)));
+    unmap(m_vertices, vertexOffset, vertexSize);
+
+    std::size_t size = count * indexSize;
+    std::size_t offset = reserve(m_indices, size, indexSize);
+    void* destination = map(m_indices, offset, size);
+    if (indexSize == sizeof(Uint16))
+        copyElements(static_cast<const Uint16*>(indices), indexCount, type, static_cast<Uint16*>(destination));
+    else
+        copyElements(static_cast<const Uint32*>(indices), indexCount, type, static_cast<Uint32*>(destination));
+    unmap(m_indices, offset, size);
+
+    // The indices are relative to the first vertex, which is given as base vertex
+    setLayout(layout);
+    GLenum indexType = (indexSize == sizeof(Uint16)) ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+    GLint baseVertex = static_cast<GLint>(vertexOffset / sizeof(T));
+    glCheck(glDrawElementsBaseVertex(getMode(type), static_cast<GLsizei>(count), indexType, bufferOffset(offset), baseVertex));
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderer::setMatrix(int location, const Transform& transform)
+{
+    if (location != -1)
+        glCheck(glUniformMatrix4fv(location, 1, GL_FALSE, transform.getMatrix()));
+}
+
+} // namespace priv
+
+} // namespace sf
+
+#else // SFML_OPENGL_ES
+
+
+namespace sf
+{
+namespace priv
+{
+////////////////////////////////////////////////////////////
+CoreRenderer* CoreRenderer::getActive()
+{
+    return NULL;
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderer::forgetProgram(unsigned int)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+CoreRenderer::~CoreRenderer()
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderer::resetStates()
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderer::useProgram(unsigned int)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderer::setViewProjection(const Transform&)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderer::setModel(const Transform&)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderer::setTexture(const Transform&, bool)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderer::draw(const Vertex*, std::size_t, PrimitiveType)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderer::draw(const Vertex*, std::size_t, const void*, std::size_t, std::size_t, PrimitiveType)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderer::draw(const CompactVertex*, std::size_t, PrimitiveType)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderer::draw(const CompactVertex*, std::size_t, const void*, std::size_t, std::size_t, PrimitiveType)
+{
+}
+
+} // namespace priv
+
+} // namespace sf
+
+#endif // SFML_OPENGL_ES
@@ -0,0 +1,396 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+#ifndef SFML_CORERENDERER_HPP
+#define SFML_CORERENDERER_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Transform.hpp>
+#include <SFML/Graphics/PrimitiveType.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/CompactVertex.hpp>
+#include <SFML/System/NonCopyable.hpp>
+#include <vector>
+#include <map>
+
+
+namespace sf
+{
+namespace priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Renderer used by render targets in core profile contexts
+///
+/// Core profile contexts don't have the fixed function
+/// pipeline: vertices are streamed to a vertex buffer and
+/// drawn with a built-in shader, and the matrices are
+/// passed as uniforms. There is one renderer per context,
+/// since vertex array objects are not shared.
+///
+/// The vertex and index buffers are rings of three regions,
+/// filled one after the other. A fence is inserted when a
+/// region is full, and the renderer only waits for it when
+/// it comes back to the region, so the GPU is never stalled
+/// while reading the data. When ARB_buffer_storage is
+/// available the buffers stay mapped, otherwise each draw
+/// maps the range it writes without synchronization.
+///
+/// Both sf::Vertex and sf::CompactVertex are written to the
+/// same vertex buffer, each layout has its own vertex array
+/// object.
+///
+////////////////////////////////////////////////////////////
+class CoreRenderer : NonCopyable
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the renderer of the active context
+    ///
+    /// The renderer is created the first time it is requested
+    /// in a context, and destroyed right before the context.
+    ///
+    /// \return Renderer of the active context, or NULL if the active
+    ///         context is not a core profile context or if the
+    ///         renderer couldn't be created
+    ///
+    ////////////////////////////////////////////////////////////
+    static CoreRenderer* getActive();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Forget everything known about a program
+    ///
+    /// Must be called before a program is deleted, since its
+    /// name can then be reused by a new program. Programs are
+    /// shared between contexts, so all the renderers forget it.
+    ///
+    /// \param program OpenGL name of the program
+    ///
+    ////////////////////////////////////////////////////////////
+    static void forgetProgram(unsigned int program);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// The OpenGL objects of the renderer are destroyed, so its
+    /// context must be active. Renderers are destroyed along
+    /// with their context.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~CoreRenderer();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Bind the objects of the renderer and the built-in program
+    ///
+    /// This function must be called whenever the OpenGL states
+    /// may have been modified by someone else.
+    ///
+    ////////////////////////////////////////////////////////////
+    void resetStates();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Select the program used to draw
+    ///
+    /// The uniforms of the renderer are looked up the first
+    /// time a program is used, and set to their current values.
+    ///
+    /// \param program OpenGL name of the program, 0 for the built-in program
+    ///
+    ////////////////////////////////////////////////////////////
+    void useProgram(unsigned int program);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the view-projection matrix
+    ///
+    /// \param transform View-projection matrix
+    ///
+    ////////////////////////////////////////////////////////////
+    void setViewProjection(const Transform& transform);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the model matrix
+    ///
+    /// \param transform Model matrix
+    ///
+    ////////////////////////////////////////////////////////////
+    void setModel(const Transform& transform);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the texture matrix and whether a texture is bound
+    ///
+    /// \param transform Matrix converting vertex texture coordinates
+    ///                  to normalized texture coordinates
+    /// \param textured  Is there a texture bound?
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTexture(const Transform& transform, bool textured);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Stream vertices to the vertex buffer and draw them
+    ///
+    /// Quads are converted to triangles while they are written
+    /// to the buffer, since they are not available in core
+    /// profile contexts.
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param type        Type of primitives to draw
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const Vertex* vertices, std::size_t vertexCount, PrimitiveType type);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Stream indexed vertices to the buffers and draw them
+    ///
+    /// Quads are converted to triangles while the indices are
+    /// written to the buffer.
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param indices     Pointer to the indices
+    /// \param indexCount  Number of indices in the array
+    /// \param indexSize   Size of an index: sizeof(Uint16) or sizeof(Uint32)
+    /// \param type        Type of primitives to draw
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const Vertex* vertices, std::size_t vertexCount, const void* indices,
+              std::size_t indexCount, std::size_t indexSize, PrimitiveType type);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Stream compact vertices to the vertex buffer and draw them
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param type        Type of primitives to draw
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const CompactVertex* vertices, std::size_t vertexCount, PrimitiveType type);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Stream indexed compact vertices to the buffers and draw them
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param indices     Pointer to the indices
+    /// \param indexCount  Number of indices in the array
+    /// \param indexSize   Size of an index: sizeof(Uint16) or sizeof(Uint32)
+    /// \param type        Type of primitives to draw
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const CompactVertex* vertices, std::size_t vertexCount, const void* indices,
+              std::size_t indexCount, std::size_t indexSize, PrimitiveType type);
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    // Types
+    ////////////////////////////////////////////////////////////
+    enum {RegionCount = 3};
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Layouts of the vertices
+    ///
+    ////////////////////////////////////////////////////////////
+    enum Layout
+    {
+        StandardLayout, ///< sf::Vertex
+        CompactLayout,  ///< sf::CompactVertex
+
+        LayoutCount     ///< Keep last -- the total number of layouts
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Vertex array object of a layout
+    ///
+    ////////////////////////////////////////////////////////////
+    struct VertexArray
+    {
+        unsigned int object;       ///< OpenGL name of the vertex array object
+        unsigned int vertexBuffer; ///< Vertex buffer the attribute pointers were set for
+        unsigned int indexBuffer;  ///< Index buffer bound to the vertex array object
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Buffer streamed as a ring of regions
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Ring
+    {
+        unsigned int      target;              ///< Binding point of the buffer
+        unsigned int      buffer;              ///< OpenGL name of the buffer
+        char*             mapping;             ///< Persistent mapping of the buffer, NULL if not available
+        std::size_t       regionSize;          ///< Size of each region, in bytes
+        std::size_t       region;              ///< Region currently written to
+        std::size_t       regionOffset;        ///< Number of bytes already written to the current region
+        void*             fences[RegionCount]; ///< Fence of each region, signaled when the GPU is done with it
+        std::vector<char> staging;             ///< Storage for the data when the buffer can't be mapped
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    CoreRenderer();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the OpenGL objects of the renderer
+    ///
+    /// \return True if creation was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    bool create();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the buffer of a ring
+    ///
+    /// The previous buffer of the ring, if any, is destroyed,
+    /// and the vertex array objects are marked for update.
+    ///
+    /// \param ring       Ring to create the buffer of
+    /// \param regionSize Size of each region, in bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    void createBuffer(Ring& ring, std::size_t regionSize);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Reserve room in a ring
+    ///
+    /// The returned offset is a multiple of \a alignment, so
+    /// that it can be converted to an element index.
+    ///
+    /// \param ring      Ring to reserve room in
+    /// \param size      Number of bytes to reserve
+    /// \param alignment Alignment of the reserved bytes, in bytes
+    ///
+    /// \return Offset of the reserved bytes in the buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t reserve(Ring& ring, std::size_t size, std::size_t alignment);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a pointer to write reserved bytes to
+    ///
+    /// \param ring   Ring the bytes were reserved in
+    /// \param offset Offset of the bytes in the buffer
+    /// \param size   Number of bytes to write
+    ///
+    /// \return Pointer to the memory to write the bytes to
+    ///
+    ////////////////////////////////////////////////////////////
+    static void* map(Ring& ring, std::size_t offset, std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Make written bytes available to the GPU
+    ///
+    /// \param ring   Ring the bytes were written to
+    /// \param offset Offset of the bytes in the buffer
+    /// \param size   Number of written bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    static void unmap(Ring& ring, std::size_t offset, std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait until the GPU is done reading a region of a ring
+    ///
+    /// \param ring   Ring the region belongs to
+    /// \param region Index of the region
+    ///
+    ////////////////////////////////////////////////////////////
+    static void waitRegion(Ring& ring, std::size_t region);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Bind the vertex array object of a layout
+    ///
+    /// The attribute pointers and the index buffer of the vertex
+    /// array object are updated if the buffers of the rings
+    /// were recreated since it was last used.
+    ///
+    /// \param layout Layout of the vertices to draw
+    ///
+    ////////////////////////////////////////////////////////////
+    void setLayout(Layout layout);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Stream vertices of any layout and draw them
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename T>
+    void drawArrays(const T* vertices, std::size_t vertexCount, PrimitiveType type, Layout layout);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Stream indexed vertices of any layout and draw them
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename T>
+    void drawElements(const T* vertices, std::size_t vertexCount, const void* indices,
+                      std::size_t indexCount, std::size_t indexSize, PrimitiveType type, Layout layout);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Upload a matrix to a uniform of the current program
+    ///
+    /// \param location  Location of the uniform, -1 if it doesn't exist
+    /// \param transform Matrix to upload
+    ///
+    ////////////////////////////////////////////////////////////
+    static void setMatrix(int location, const Transform& transform);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Locations of the renderer's uniforms in a program
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Uniforms
+    {
+        int viewProjection; ///< Location of sf_viewProjection
+        int model;          ///< Location of sf_model
+        int textureMatrix;  ///< Location of sf_textureMatrix
+        int textured;       ///< Location of sf_textured
+        int texture;        ///< Location of sf_texture
+    };
+
+    typedef std::map<unsigned int, Uniforms> UniformsMap;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    unsigned int m_program;                   ///< Built-in program
+    unsigned int m_currentProgram;            ///< Program used to draw
+    Uniforms     m_uniforms;                  ///< Uniform locations in the current program
+    UniformsMap  m_programUniforms;           ///< Uniform locations in each program used so far
+    VertexArray  m_vertexArrays[LayoutCount]; ///< Vertex array object of each layout
+    Layout       m_layout;                    ///< Layout of the bound vertex array object
+    Ring         m_vertices;                  ///< Ring the vertices are streamed to
+    Ring         m_indices;                   ///< Ring the indices are streamed to
+    Transform    m_viewProjection;            ///< Current view-projection matrix
+    Transform    m_model;                     ///< Current model matrix
+    Transform    m_textureMatrix;             ///< Current texture matrix
+    bool         m_textured;                  ///< Is there a texture bound?
+};
+
+} // namespace priv
+
+} // namespace sf
+
+
+#endif // SFML_CORERENDERER_HPP
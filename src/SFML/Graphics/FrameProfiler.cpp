@@ -0,0 +1,437 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/FrameProfiler.hpp>
+#include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Window/Context.hpp>
+#include <SFML/System/Err.hpp>
+#include <sstream>
+
+
+namespace
+{
+    // Number of ended frames after which the oldest one is completed
+    // even if the GPU is not done with it
+    const std::size_t maxPendingFrames = 2;
+
+    // Compute the rendering work done between two snapshots of counters
+    sf::FrameProfile::Counters subtract(const sf::FrameProfile::Counters& left, const sf::FrameProfile::Counters& right)
+    {
+        sf::FrameProfile::Counters result;
+        result.drawCalls    = left.drawCalls    - right.drawCalls;
+        result.vertices     = left.vertices     - right.vertices;
+        result.textureBinds = left.textureBinds - right.textureBinds;
+        result.shaderBinds  = left.shaderBinds  - right.shaderBinds;
+        result.blendChanges = left.blendChanges - right.blendChanges;
+        return result;
+    }
+
+    // Escape a string to write it in a JSON document
+    std::string escapeJson(const std::string& string)
+    {
+        std::ostringstream stream;
+        for (std::string::const_iterator it = string.begin(); it != string.end(); ++it)
+        {
+            unsigned char character = static_cast<unsigned char>(*it);
+            if ((character == '"') || (character == '\\'))
+            {
+                stream << '\\' << *it;
+            }
+            else if (character < 0x20)
+            {
+                static const char digits[] = "0123456789abcdef";
+                stream << "\\u00" << digits[character >> 4] << digits[character & 0x0F];
+            }
+            else
+            {
+                stream << *it;
+            }
+        }
+
+        return stream.str();
+    }
+}
+
+
+namespace sf
+{
+namespace priv
+{
+////////////////////////////////////////////////////////////
+FrameProfiler::FrameProfiler() :
+m_clock      (),
+m_current    (),
+m_openScopes (),
+m_pending    (),
+m_profile    (),
+m_contextId  (0),
+m_freeQueries(),
+m_queries    (),
+m_trace      ()
+{
+}
+
+
+////////////////////////////////////////////////////////////
+FrameProfiler::~FrameProfiler()
+{
+    // Complete the ended frames, so that they appear in the trace
+    while (completeFrame(true))
+        ;
+
+    setTraceFile("");
+
+#ifndef SFML_OPENGL_ES
+
+    // Query objects can only be destroyed in their context
+    if (!m_queries.empty() && (Context::getActiveContextId() == m_contextId))
+        glCheck(glDeleteQueries(static_cast<GLsizei>(m_queries.size()), &m_queries[0]));
+
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+void FrameProfiler::beginScope(const std::string& name)
+{
+    beginFrameQuery();
+
+    FrameProfile::Scope scope;
+    scope.name = name;
+    scope.depth = static_cast<unsigned int>(m_openScopes.size());
+    scope.cpuStart = m_clock.getElapsedTime() - m_current.profile.cpuStart;
+
+    // Keep a snapshot of the counters, until the scope ends
+    scope.counters = m_current.profile.counters;
+
+    m_openScopes.push_back(m_current.profile.scopes.size());
+    m_current.profile.scopes.push_back(scope);
+
+    m_current.queries.push_back(queryTimestamp());
+    m_current.queries.push_back(0);
+}
+
+
+////////////////////////////////////////////////////////////
+void FrameProfiler::endScope()
+{
+    if (m_openScopes.empty())
+    {
+        err() << "Failed to end profile scope, no scope was started" << std::endl;
+        return;
+    }
+
+    std::size_t index = m_openScopes.back();
+    m_openScopes.pop_back();
+
+    FrameProfile::Scope& scope = m_current.profile.scopes[index];
+    scope.cpuTime = m_clock.getElapsedTime() - m_current.profile.cpuStart - scope.cpuStart;
+    scope.counters = subtract(m_current.profile.counters, scope.counters);
+
+    m_current.queries[3 + index * 2] = queryTimestamp();
+}
+
+
+////////////////////////////////////////////////////////////
+void FrameProfiler::endFrame()
+{
+    while (!m_openScopes.empty())
+        endScope();
+
+    Time now = m_clock.getElapsedTime();
+    m_current.profile.cpuTime = now - m_current.profile.cpuStart;
+
+    if (!m_current.queries.empty())
+        m_current.queries[1] = queryTimestamp();
+
+    m_pending.push_back(m_current);
+
+    // Start the next frame
+    Uint64 frame = m_current.profile.frame + 1;
+    m_current = Frame();
+    m_current.profile.frame = frame;
+    m_current.profile.cpuStart = now;
+
+    // Complete the frames which are ready, and the oldest ones
+    // if too many are pending, even if it means waiting for the GPU
+    while (completeFrame(false))
+        ;
+
+    while (m_pending.size() > maxPendingFrames)
+        completeFrame(true);
+}
+
+
+////////////////////////////////////////////////////////////
+const FrameProfile& FrameProfiler::getProfile() const
+{
+    return m_profile;
+}
+
+
+////////////////////////////////////////////////////////////
+bool FrameProfiler::setTraceFile(const std::string& filename)
+{
+    if (m_trace.is_open())
+    {
+        m_trace << "\n]\n";
+        m_trace.close();
+    }
+
+    if (filename.empty())
+        return true;
+
+    m_trace.clear();
+    m_trace.open(filename.c_str(), std::ios_base::trunc);
+    if (!m_trace)
+    {
+        err() << "Failed to open profile trace file \"" << filename << "\"" << std::endl;
+        return false;
+    }
+
+    // Name the threads of the CPU and GPU events
+    m_trace << "[\n"
+            << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"CPU\"}},\n"
+            << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":2,\"args\":{\"name\":\"GPU\"}}";
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void FrameProfiler::addDrawCall(std::size_t vertexCount)
+{
+    beginFrameQuery();
+
+    m_current.profile.counters.drawCalls++;
+    m_current.profile.counters.vertices += vertexCount;
+}
+
+
+////////////////////////////////////////////////////////////
+void FrameProfiler::addTextureBind()
+{
+    m_current.profile.counters.textureBinds++;
+}
+
+
+////////////////////////////////////////////////////////////
+void FrameProfiler::addShaderBind()
+{
+    m_current.profile.counters.shaderBinds++;
+}
+
+
+////////////////////////////////////////////////////////////
+void FrameProfiler::addBlendChange()
+{
+    m_current.profile.counters.blendChanges++;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int FrameProfiler::queryTimestamp()
+{
+#ifndef SFML_OPENGL_ES
+
+    Uint64 contextId = Context::getActiveContextId();
+    if (!contextId)
+        return 0;
+
+    ensureExtensionsInit();
+
+    if (!GLEXT_timer_query)
+        return 0;
+
+    // All the queries belong to the first context we're used in
+    if (!m_contextId)
+        m_contextId = contextId;
+    else if (contextId != m_contextId)
+        return 0;
+
+    GLuint query;
+    if (!m_freeQueries.empty())
+    {
+        query = m_freeQueries.back();
+        m_freeQueries.pop_back();
+    }
+    else
+    {
+        glCheck(glGenQueries(1, &query));
+        m_queries.push_back(query);
+    }
+
+    glCheck(glQueryCounter(query, GL_TIMESTAMP));
+
+    return query;
+
+#else
+
+    return 0;
+
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+void FrameProfiler::beginFrameQuery()
+{
+    if (m_current.queries.empty())
+    {
+        m_current.queries.push_back(queryTimestamp());
+        m_current.queries.push_back(0);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool FrameProfiler::completeFrame(bool wait)
+{
+    if (m_pending.empty())
+        return false;
+
+    Frame& frame = m_pending.front();
+    FrameProfile& profile = frame.profile;
+
+#ifndef SFML_OPENGL_ES
+
+    bool measured = !frame.queries.empty() && frame.queries[0] && frame.queries[1];
+
+    if (measured)
+    {
+        if (Context::getActiveContextId() != m_contextId)
+        {
+            // The queries can't be read from here: keep waiting, or give up
+            if (!wait)
+                return false;
+
+            measured = false;
+        }
+        else if (!wait)
+        {
+            // Timestamps complete in order, the end of the frame is the last one
+            GLint available;
+            glCheck(glGetQueryObjectiv(frame.queries[1], GL_QUERY_RESULT_AVAILABLE, &available));
+            if (!available)
+                return false;
+        }
+    }
+
+    if (measured)
+    {
+        std::vector<GLuint64> timestamps(frame.queries.size(), 0);
+        for (std::size_t i = 0; i < frame.queries.size(); ++i)
+        {
+            if (frame.queries[i])
+                glCheck(glGetQueryObjectui64v(frame.queries[i], GL_QUERY_RESULT, &timestamps[i]));
+        }
+
+        // Timestamps are in nanoseconds
+        GLuint64 start = timestamps[0];
+        profile.gpuTime = microseconds(static_cast<Int64>((timestamps[1] - start) / 1000));
+
+        for (std::size_t i = 0; i < profile.scopes.size(); ++i)
+        {
+            GLuint64 scopeStart = timestamps[2 + i * 2];
+            GLuint64 scopeEnd = timestamps[3 + i * 2];
+            if (frame.queries[2 + i * 2] && frame.queries[3 + i * 2])
+            {
+                profile.scopes[i].gpuStart = microseconds(static_cast<Int64>((scopeStart - start) / 1000));
+                profile.scopes[i].gpuTime = microseconds(static_cast<Int64>((scopeEnd - scopeStart) / 1000));
+            }
+        }
+
+        profile.gpuTimesAvailable = true;
+    }
+
+#else
+
+    // There are no timer queries to wait for
+    (void)wait;
+
+#endif
+
+    // The query objects can be reused by the next frames
+    for (std::size_t i = 0; i < frame.queries.size(); ++i)
+    {
+        if (frame.queries[i])
+            m_freeQueries.push_back(frame.queries[i]);
+    }
+
+    m_profile = profile;
+    m_pending.pop_front();
+
+    writeTrace(m_profile);
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void FrameProfiler::writeTrace(const FrameProfile& profile)
+{
+    if (!m_trace.is_open())
+        return;
+
+    std::ostringstream name;
+    name << "Frame " << profile.frame;
+
+    writeTraceEvent(name.str(), 1, profile.cpuStart, profile.cpuTime, profile.counters);
+    for (std::size_t i = 0; i < profile.scopes.size(); ++i)
+    {
+        const FrameProfile::Scope& scope = profile.scopes[i];
+        writeTraceEvent(scope.name, 1, profile.cpuStart + scope.cpuStart, scope.cpuTime, scope.counters);
+    }
+
+    // The GPU clock is not synchronized with the CPU clock,
+    // GPU events are placed relative to the start of the frame
+    if (profile.gpuTimesAvailable)
+    {
+        writeTraceEvent(name.str(), 2, profile.cpuStart, profile.gpuTime, profile.counters);
+        for (std::size_t i = 0; i < profile.scopes.size(); ++i)
+        {
+            const FrameProfile::Scope& scope = profile.scopes[i];
+            writeTraceEvent(scope.name, 2, profile.cpuStart + scope.gpuStart, scope.gpuTime, scope.counters);
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void FrameProfiler::writeTraceEvent(const std::string& name, int thread, Time start, Time duration, const FrameProfile::Counters& counters)
+{
+    m_trace << ",\n{\"name\":\"" << escapeJson(name) << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << thread
+            << ",\"ts\":" << start.asMicroseconds() << ",\"dur\":" << duration.asMicroseconds()
+            << ",\"args\":{\"drawCalls\":" << counters.drawCalls
+            << ",\"vertices\":" << counters.vertices
+            << ",\"textureBinds\":" << counters.textureBinds
+            << ",\"shaderBinds\":" << counters.shaderBinds
+            << ",\"blendChanges\":" << counters.blendChanges << "}}";
+}
+
+} // namespace priv
+
+} // namespace sf
@@ -0,0 +1,230 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+#ifndef SFML_FRAMEPROFILER_HPP
+#define SFML_FRAMEPROFILER_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/FrameProfile.hpp>
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/NonCopyable.hpp>
+#include <deque>
+#include <fstream>
+#include <string>
+#include <vector>
+
+
+namespace sf
+{
+namespace priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Collect the frame profiles of a render target
+///
+/// CPU times are measured with a clock, GPU times with
+/// timestamp queries inserted in the command stream at the
+/// beginning and end of each scope. Timestamps, unlike
+/// GL_TIME_ELAPSED queries, can be nested.
+///
+/// The queries of a frame are read when the frame after it
+/// ends if they are available, and at the latest two frames
+/// later, so that reading them rarely stalls the CPU.
+///
+/// Query objects are not shared between contexts: they are
+/// all created in the first context the profiler is used
+/// in, and GPU times are not measured in other contexts.
+/// All the functions that may issue queries must be called
+/// with the target's context active.
+///
+////////////////////////////////////////////////////////////
+class FrameProfiler : NonCopyable
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// The first frame starts immediately.
+    ///
+    ////////////////////////////////////////////////////////////
+    FrameProfiler();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// The trace file, if any, is closed. The query objects
+    /// are destroyed if their context is active.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~FrameProfiler();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start a named scope in the current frame
+    ///
+    /// \param name Name of the scope
+    ///
+    ////////////////////////////////////////////////////////////
+    void beginScope(const std::string& name);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief End the last started scope
+    ///
+    ////////////////////////////////////////////////////////////
+    void endScope();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief End the current frame and start the next one
+    ///
+    /// Scopes left open are ended. The profiles of previous
+    /// frames whose GPU times are available are completed.
+    ///
+    ////////////////////////////////////////////////////////////
+    void endFrame();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the profile of the last completed frame
+    ///
+    /// \return Profile of the last completed frame
+    ///
+    ////////////////////////////////////////////////////////////
+    const FrameProfile& getProfile() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write the completed frames to a Chrome trace file
+    ///
+    /// The previous trace file, if any, is closed.
+    ///
+    /// \param filename Path of the trace file, empty to stop writing
+    ///
+    /// \return True if the file was opened
+    ///
+    ////////////////////////////////////////////////////////////
+    bool setTraceFile(const std::string& filename);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Count a draw call
+    ///
+    /// \param vertexCount Number of vertices drawn
+    ///
+    ////////////////////////////////////////////////////////////
+    void addDrawCall(std::size_t vertexCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Count a texture change
+    ///
+    ////////////////////////////////////////////////////////////
+    void addTextureBind();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Count a shader bound to draw
+    ///
+    ////////////////////////////////////////////////////////////
+    void addShaderBind();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Count a blend mode change
+    ///
+    ////////////////////////////////////////////////////////////
+    void addBlendChange();
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Frame being recorded or waiting for its GPU times
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Frame
+    {
+        FrameProfile              profile; ///< Profile of the frame
+        std::vector<unsigned int> queries; ///< Timestamp queries: begin and end of the frame, then of each scope (0 if not issued)
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Issue a timestamp query
+    ///
+    /// \return Query object, or 0 if timestamps can't be queried
+    ///
+    ////////////////////////////////////////////////////////////
+    unsigned int queryTimestamp();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Issue the query of the beginning of the current frame
+    ///
+    /// The query is issued only once per frame, the first time
+    /// rendering work is done.
+    ///
+    ////////////////////////////////////////////////////////////
+    void beginFrameQuery();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Complete the profiles of the pending frames
+    ///
+    /// \param wait Wait for the GPU times of the oldest frame if they are not available?
+    ///
+    /// \return True if a frame was completed
+    ///
+    ////////////////////////////////////////////////////////////
+    bool completeFrame(bool wait);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write a completed frame to the trace file
+    ///
+    /// \param profile Profile of the frame
+    ///
+    ////////////////////////////////////////////////////////////
+    void writeTrace(const FrameProfile& profile);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write an event to the trace file
+    ///
+    /// \param name     Name of the event
+    /// \param thread   Thread of the event: 1 for the CPU, 2 for the GPU
+    /// \param start    Start of the event
+    /// \param duration Duration of the event
+    /// \param counters Rendering work done during the event
+    ///
+    ////////////////////////////////////////////////////////////
+    void writeTraceEvent(const std::string& name, int thread, Time start, Time duration, const FrameProfile::Counters& counters);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Clock                     m_clock;         ///< Clock measuring the CPU times
+    Frame                     m_current;       ///< Frame being recorded
+    std::vector<std::size_t>  m_openScopes;    ///< Scopes of the current frame not ended yet
+    std::deque<Frame>         m_pending;       ///< Ended frames waiting for their GPU times
+    FrameProfile              m_profile;       ///< Last completed frame
+    Uint64                    m_contextId;     ///< Context the queries belong to
+    std::vector<unsigned int> m_freeQueries;   ///< Query objects ready to be reused
+    std::vector<unsigned int> m_queries;       ///< All the query objects created
+    std::ofstream             m_trace;         ///< Chrome trace file
+};
+
+} // namespace priv
+
+} // namespace sf
+
+
+#endif // SFML_FRAMEPROFILER_HPP
@@ -109,6 +109,30 @@
     #define GLEXT_GL_FRAMEBUFFER_BINDING              GL_FRAMEBUFFER_BINDING_OES
     #define GLEXT_GL_INVALID_FRAMEBUFFER_OPERATION    GL_INVALID_FRAMEBUFFER_OPERATION_OES
 
+    // Core since 3.0 - ARB_texture_float, ARB_texture_rg
+    // Not supported, textures always use the RGBA8 format
+    #define GLEXT_texture_float                       false
+    #define GLEXT_texture_rg                          false
+    #define GLEXT_GL_RGBA16F                          GL_RGBA
+    #define GLEXT_GL_RGBA32F                          GL_RGBA
+    #define GLEXT_GL_R8                               GL_RGBA
+    #define GLEXT_GL_RG8                              GL_RGBA
+    #define GLEXT_GL_R16F                             GL_RGBA
+    #define GLEXT_GL_R32F                             GL_RGBA
+    #define GLEXT_GL_RED                              GL_RGBA
+    #define GLEXT_GL_RG                               GL_RGBA
+
+    // Core since 3.2 - core profile rendering
+    // Not supported, the fixed function pipeline is always used
+    #define GLEXT_core_profile                        false
+
+    // Core since 4.4 - ARB_buffer_storage
+    #define GLEXT_buffer_storage                      false
+
+    // Core since 3.3 - ARB_timer_query
+    // Not supported, GPU times are not measured
+    #define GLEXT_timer_query                         false
+
 #else
 
     #include <SFML/Graphics/GLLoader.hpp>
@@ -183,6 +207,7 @@
 
     // Core since 2.0 - ARB_vertex_shader
     #define GLEXT_vertex_shader                       sfogl_ext_ARB_vertex_shader
+    #define GLEXT_glBindAttribLocation                glBindAttribLocationARB
     #define GLEXT_GL_VERTEX_SHADER                    GL_VERTEX_SHADER_ARB
     #define GLEXT_GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS_ARB
 
@@ -217,6 +242,31 @@
     #define GLEXT_GL_FRAMEBUFFER_BINDING              GL_FRAMEBUFFER_BINDING_EXT
     #define GLEXT_GL_INVALID_FRAMEBUFFER_OPERATION    GL_INVALID_FRAMEBUFFER_OPERATION_EXT
 
+    // Core since 3.0 - ARB_texture_float
+    #define GLEXT_texture_float                       sfogl_ext_ARB_texture_float
+    #define GLEXT_GL_RGBA16F                          GL_RGBA16F_ARB
+    #define GLEXT_GL_RGBA32F                          GL_RGBA32F_ARB
+
+    // Core since 3.0 - ARB_texture_rg
+    #define GLEXT_texture_rg                          sfogl_ext_ARB_texture_rg
+    #define GLEXT_GL_R8                               GL_R8
+    #define GLEXT_GL_RG8                              GL_RG8
+    #define GLEXT_GL_R16F                             GL_R16F
+    #define GLEXT_GL_R32F                             GL_R32F
+    #define GLEXT_GL_RED                              GL_RED
+    #define GLEXT_GL_RG                               GL_RG
+
+    // Core since 3.2 - core profile rendering
+    // Buffer, vertex array and shader functions used by the
+    // core profile renderer, loaded under their core names
+    #define GLEXT_core_profile                        sfogl_core_3_2
+
+    // Core since 4.4 - ARB_buffer_storage
+    #define GLEXT_buffer_storage                      sfogl_ext_ARB_buffer_storage
+
+    // Core since 3.3 - ARB_timer_query
+    #define GLEXT_timer_query                         sfogl_ext_ARB_timer_query
+
 #endif
 
 namespace sf
@@ -46,6 +46,11 @@ int sfogl_ext_ARB_fragment_shader = sfogl_LOAD_FAILED;
 int sfogl_ext_ARB_texture_non_power_of_two = sfogl_LOAD_FAILED;
 int sfogl_ext_EXT_blend_equation_separate = sfogl_LOAD_FAILED;
 int sfogl_ext_EXT_framebuffer_object = sfogl_LOAD_FAILED;
+int sfogl_ext_ARB_texture_float = sfogl_LOAD_FAILED;
+int sfogl_ext_ARB_texture_rg = sfogl_LOAD_FAILED;
+int sfogl_ext_ARB_buffer_storage = sfogl_LOAD_FAILED;
+int sfogl_ext_ARB_timer_query = sfogl_LOAD_FAILED;
+int sfogl_core_3_2 = sfogl_LOAD_FAILED;
 
 void (GL_FUNCPTR *sf_ptrc_glBlendEquationEXT)(GLenum) = NULL;
 
@@ -798,6 +803,231 @@ static int Load_EXT_framebuffer_object()
     return numFailed;
 }
 
+void (GL_FUNCPTR *sf_ptrc_glBufferStorage)(GLenum, GLsizeiptr, const void*, GLbitfield) = NULL;
+
+static int Load_ARB_buffer_storage()
+{
+    int numFailed = 0;
+
+    sf_ptrc_glBufferStorage = reinterpret_cast<void (GL_FUNCPTR *)(GLenum, GLsizeiptr, const void*, GLbitfield)>(glLoaderGetProcAddress("glBufferStorage"));
+    if (!sf_ptrc_glBufferStorage)
+        numFailed++;
+
+    return numFailed;
+}
+
+void (GL_FUNCPTR *sf_ptrc_glDeleteQueries)(GLsizei, const GLuint*) = NULL;
+void (GL_FUNCPTR *sf_ptrc_glGenQueries)(GLsizei, GLuint*) = NULL;
+void (GL_FUNCPTR *sf_ptrc_glGetQueryObjectiv)(GLuint, GLenum, GLint*) = NULL;
+void (GL_FUNCPTR *sf_ptrc_glGetQueryObjectui64v)(GLuint, GLenum, GLuint64*) = NULL;
+void (GL_FUNCPTR *sf_ptrc_glQueryCounter)(GLuint, GLenum) = NULL;
+
+static int Load_ARB_timer_query()
+{
+    int numFailed = 0;
+
+    // The query object functions are core since 1.5, and required by the extension
+    sf_ptrc_glDeleteQueries = reinterpret_cast<void (GL_FUNCPTR *)(GLsizei, const GLuint*)>(glLoaderGetProcAddress("glDeleteQueries"));
+    if (!sf_ptrc_glDeleteQueries)
+        numFailed++;
+
+    sf_ptrc_glGenQueries = reinterpret_cast<void (GL_FUNCPTR *)(GLsizei, GLuint*)>(glLoaderGetProcAddress("glGenQueries"));
+    if (!sf_ptrc_glGenQueries)
+        numFailed++;
+
+    sf_ptrc_glGetQueryObjectiv = reinterpret_cast<void (GL_FUNCPTR *)(GLuint, GLenum, GLint*)>(glLoaderGetProcAddress("glGetQueryObjectiv"));
+    if (!sf_ptrc_glGetQueryObjectiv)
+        numFailed++;
+
+    sf_ptrc_glGetQueryObjectui64v = reinterpret_cast<void (GL_FUNCPTR *)(GLuint, GLenum, GLuint64*)>(glLoaderGetProcAddress("glGetQueryObjectui64v"));
+    if (!sf_ptrc_glGetQueryObjectui64v)
+        numFailed++;
+
+    sf_ptrc_glQueryCounter = reinterpret_cast<void (GL_FUNCPTR *)(GLuint, GLenum)>(glLoaderGetProcAddress("glQueryCounter"));
+    if (!sf_ptrc_glQueryCounter)
+        numFailed++;
+
+    return numFailed;
+}
+
+void (GL_FUNCPTR *sf_ptrc_glAttachShader)(GLuint, GLuint) = NULL;
+void (GL_FUNCPTR *sf_ptrc_glBindAttribLocation)(GLuint, GLuint, const GLchar*) = NULL;
+void (GL_FUNCPTR *sf_ptrc_glBindBuffer)(GLenum, GLuint) = NULL;
+void (GL_FUNCPTR *sf_ptrc_glBindVertexArray)(GLuint) = NULL;
+void (GL_FUNCPTR *sf_ptrc_glBufferData)(GLenum, GLsizeiptr, const void*, GLenum) = NULL;
+void (GL_FUNCPTR *sf_ptrc_glBufferSubData)(GLenum, GLintptr, GLsizeiptr, const void*) = NULL;
+GLenum (GL_FUNCPTR *sf_ptrc_glClientWaitSync)(GLsync, GLbitfield, GLuint64) = NULL;
+void (GL_FUNCPTR *sf_ptrc_glCompileShader)(GLuint) = NULL;
+GLuint (GL_FUNCPTR *sf_ptrc_glCreateProgram)() = NULL;
+GLuint (GL_FUNCPTR *sf_ptrc_glCreateShader)(GLenum) = NULL;
+void (GL_FUNCPTR *sf_ptrc_glDeleteBuffers)(GLsizei, const GLuint*) = NULL;
+void (GL_FUNCPTR *sf_ptrc_glDeleteProgram)(GLuint) = NULL;
+void (GL_FUNCPTR *sf_ptrc_glDeleteShader)(GLuint) = NULL;
+void (GL_FUNCPTR *sf_ptrc_glDeleteSync)(GLsync) = NULL;
+void (GL_FUNCPTR *sf_ptrc_glDeleteVertexArrays)(GLsizei, const GLuint*) = NULL;
+void (GL_FUNCPTR *sf_ptrc_glDrawElementsBaseVertex)(GLenum, GLsizei, GLenum, const void*, GLint) = NULL;
+void (GL_FUNCPTR *sf_ptrc_glEnableVertexAttribArray)(GLuint) = NULL;
+GLsync (GL_FUNCPTR *sf_ptrc_glFenceSync)(GLenum, GLbitfield) = NULL;
+void (GL_FUNCPTR *sf_ptrc_glGenBuffers)(GLsizei, GLuint*) = NULL;
+void (GL_FUNCPTR *sf_ptrc_glGenVertexArrays)(GLsizei, GLuint*) = NULL;
+void (GL_FUNCPTR *sf_ptrc_glGetProgramInfoLog)(GLuint, GLsizei, GLsizei*, GLchar*) = NULL;
+void (GL_FUNCPTR *sf_ptrc_glGetProgramiv)(GLuint, GLenum, GLint*) = NULL;
+void (GL_FUNCPTR *sf_ptrc_glGetShaderInfoLog)(GLuint, GLsizei, GLsizei*, GLchar*) = NULL;
+void (GL_FUNCPTR *sf_ptrc_glGetShaderiv)(GLuint, GLenum, GLint*) = NULL;
+GLint (GL_FUNCPTR *sf_ptrc_glGetUniformLocation)(GLuint, const GLchar*) = NULL;
+void (GL_FUNCPTR *sf_ptrc_glLinkProgram)(GLuint) = NULL;
+void* (GL_FUNCPTR *sf_ptrc_glMapBufferRange)(GLenum, GLintptr, GLsizeiptr, GLbitfield) = NULL;
+void (GL_FUNCPTR *sf_ptrc_glShaderSource)(GLuint, GLsizei, const GLchar* const*, const GLint*) = NULL;
+void (GL_FUNCPTR *sf_ptrc_glUniform1f)(GLint, GLfloat) = NULL;
+void (GL_FUNCPTR *sf_ptrc_glUniform1i)(GLint, GLint) = NULL;
+void (GL_FUNCPTR *sf_ptrc_glUniformMatrix4fv)(GLint, GLsizei, GLboolean, const GLfloat*) = NULL;
+GLboolean (GL_FUNCPTR *sf_ptrc_glUnmapBuffer)(GLenum) = NULL;
+void (GL_FUNCPTR *sf_ptrc_glUseProgram)(GLuint) = NULL;
+void (GL_FUNCPTR *sf_ptrc_glVertexAttribPointer)(GLuint, GLint, GLenum, GLboolean, GLsizei, const void*) = NULL;
+
+static int Load_Version_3_2()
+{
+    int numFailed = 0;
+
+    sf_ptrc_glAttachShader = reinterpret_cast<void (GL_FUNCPTR *)(GLuint, GLuint)>(glLoaderGetProcAddress("glAttachShader"));
+    if (!sf_ptrc_glAttachShader)
+        numFailed++;
+
+    sf_ptrc_glBindAttribLocation = reinterpret_cast<void (GL_FUNCPTR *)(GLuint, GLuint, const GLchar*)>(glLoaderGetProcAddress("glBindAttribLocation"));
+    if (!sf_ptrc_glBindAttribLocation)
+        numFailed++;
+
+    sf_ptrc_glBindBuffer = reinterpret_cast<void (GL_FUNCPTR *)(GLenum, GLuint)>(glLoaderGetProcAddress("glBindBuffer"));
+    if (!sf_ptrc_glBindBuffer)
+        numFailed++;
+
+    sf_ptrc_glBindVertexArray = reinterpret_cast<void (GL_FUNCPTR *)(GLuint)>(glLoaderGetProcAddress("glBindVertexArray"));
+    if (!sf_ptrc_glBindVertexArray)
+        numFailed++;
+
+    sf_ptrc_glBufferData = reinterpret_cast<void (GL_FUNCPTR *)(GLenum, GLsizeiptr, const void*, GLenum)>(glLoaderGetProcAddress("glBufferData"));
+    if (!sf_ptrc_glBufferData)
+        numFailed++;
+
+    sf_ptrc_glBufferSubData = reinterpret_cast<void (GL_FUNCPTR *)(GLenum, GLintptr, GLsizeiptr, const void*)>(glLoaderGetProcAddress("glBufferSubData"));
+    if (!sf_ptrc_glBufferSubData)
+        numFailed++;
+
+    sf_ptrc_glClientWaitSync = reinterpret_cast<GLenum (GL_FUNCPTR *)(GLsync, GLbitfield, GLuint64)>(glLoaderGetProcAddress("glClientWaitSync"));
+    if (!sf_ptrc_glClientWaitSync)
+        numFailed++;
+
+    sf_ptrc_glCompileShader = reinterpret_cast<void (GL_FUNCPTR *)(GLuint)>(glLoaderGetProcAddress("glCompileShader"));
+    if (!sf_ptrc_glCompileShader)
+        numFailed++;
+
+    sf_ptrc_glCreateProgram = reinterpret_cast<GLuint (GL_FUNCPTR *)()>(glLoaderGetProcAddress("glCreateProgram"));
+    if (!sf_ptrc_glCreateProgram)
+        numFailed++;
+
+    sf_ptrc_glCreateShader = reinterpret_cast<GLuint (GL_FUNCPTR *)(GLenum)>(glLoaderGetProcAddress("glCreateShader"));
+    if (!sf_ptrc_glCreateShader)
+        numFailed++;
+
+    sf_ptrc_glDeleteBuffers = reinterpret_cast<void (GL_FUNCPTR *)(GLsizei, const GLuint*)>(glLoaderGetProcAddress("glDeleteBuffers"));
+    if (!sf_ptrc_glDeleteBuffers)
+        numFailed++;
+
+    sf_ptrc_glDeleteProgram = reinterpret_cast<void (GL_FUNCPTR *)(GLuint)>(glLoaderGetProcAddress("glDeleteProgram"));
+    if (!sf_ptrc_glDeleteProgram)
+        numFailed++;
+
+    sf_ptrc_glDeleteShader = reinterpret_cast<void (GL_FUNCPTR *)(GLuint)>(glLoaderGetProcAddress("glDeleteShader"));
+    if (!sf_ptrc_glDeleteShader)
+        numFailed++;
+
+    sf_ptrc_glDeleteSync = reinterpret_cast<void (GL_FUNCPTR *)(GLsync)>(glLoaderGetProcAddress("glDeleteSync"));
+    if (!sf_ptrc_glDeleteSync)
+        numFailed++;
+
+    sf_ptrc_glDeleteVertexArrays = reinterpret_cast<void (GL_FUNCPTR *)(GLsizei, const GLuint*)>(glLoaderGetProcAddress("glDeleteVertexArrays"));
+    if (!sf_ptrc_glDeleteVertexArrays)
+        numFailed++;
+
+    sf_ptrc_glDrawElementsBaseVertex = reinterpret_cast<void (GL_FUNCPTR *)(GLenum, GLsizei, GLenum, const void*, GLint)>(glLoaderGetProcAddress("glDrawElementsBaseVertex"));
+    if (!sf_ptrc_glDrawElementsBaseVertex)
+        numFailed++;
+
+    sf_ptrc_glEnableVertexAttribArray = reinterpret_cast<void (GL_FUNCPTR *)(GLuint)>(glLoaderGetProcAddress("glEnableVertexAttribArray"));
+    if (!sf_ptrc_glEnableVertexAttribArray)
+        numFailed++;
+
+    sf_ptrc_glFenceSync = reinterpret_cast<GLsync (GL_FUNCPTR *)(GLenum, GLbitfield)>(glLoaderGetProcAddress("glFenceSync"));
+    if (!sf_ptrc_glFenceSync)
+        numFailed++;
+
+    sf_ptrc_glGenBuffers = reinterpret_cast<void (GL_FUNCPTR *)(GLsizei, GLuint*)>(glLoaderGetProcAddress("glGenBuffers"));
+    if (!sf_ptrc_glGenBuffers)
+        numFailed++;
+
+    sf_ptrc_glGenVertexArrays = reinterpret_cast<void (GL_FUNCPTR *)(GLsizei, GLuint*)>(glLoaderGetProcAddress("glGenVertexArrays"));
+    if (!sf_ptrc_glGenVertexArrays)
+        numFailed++;
+
+    sf_ptrc_glGetProgramInfoLog = reinterpret_cast<void (GL_FUNCPTR *)(GLuint, GLsizei, GLsizei*, GLchar*)>(glLoaderGetProcAddress("glGetProgramInfoLog"));
+    if (!sf_ptrc_glGetProgramInfoLog)
+        numFailed++;
+
+    sf_ptrc_glGetProgramiv = reinterpret_cast<void (GL_FUNCPTR *)(GLuint, GLenum, GLint*)>(glLoaderGetProcAddress("glGetProgramiv"));
+    if (!sf_ptrc_glGetProgramiv)
+        numFailed++;
+
+    sf_ptrc_glGetShaderInfoLog = reinterpret_cast<void (GL_FUNCPTR *)(GLuint, GLsizei, GLsizei*, GLchar*)>(glLoaderGetProcAddress("glGetShaderInfoLog"));
+    if (!sf_ptrc_glGetShaderInfoLog)
+        numFailed++;
+
+    sf_ptrc_glGetShaderiv = reinterpret_cast<void (GL_FUNCPTR *)(GLuint, GLenum, GLint*)>(glLoaderGetProcAddress("glGetShaderiv"));
+    if (!sf_ptrc_glGetShaderiv)
+        numFailed++;
+
+    sf_ptrc_glGetUniformLocation = reinterpret_cast<GLint (GL_FUNCPTR *)(GLuint, const GLchar*)>(glLoaderGetProcAddress("glGetUniformLocation"));
+    if (!sf_ptrc_glGetUniformLocation)
+        numFailed++;
+
+    sf_ptrc_glLinkProgram = reinterpret_cast<void (GL_FUNCPTR *)(GLuint)>(glLoaderGetProcAddress("glLinkProgram"));
+    if (!sf_ptrc_glLinkProgram)
+        numFailed++;
+
+    sf_ptrc_glMapBufferRange = reinterpret_cast<void* (GL_FUNCPTR *)(GLenum, GLintptr, GLsizeiptr, GLbitfield)>(glLoaderGetProcAddress("glMapBufferRange"));
+    if (!sf_ptrc_glMapBufferRange)
+        numFailed++;
+
+    sf_ptrc_glShaderSource = reinterpret_cast<void (GL_FUNCPTR *)(GLuint, GLsizei, const GLchar* const*, const GLint*)>(glLoaderGetProcAddress("glShaderSource"));
+    if (!sf_ptrc_glShaderSource)
+        numFailed++;
+
+    sf_ptrc_glUniform1f = reinterpret_cast<void (GL_FUNCPTR *)(GLint, GLfloat)>(glLoaderGetProcAddress("glUniform1f"));
+    if (!sf_ptrc_glUniform1f)
+        numFailed++;
+
+    sf_ptrc_glUniform1i = reinterpret_cast<void (GL_FUNCPTR *)(GLint, GLint)>(glLoaderGetProcAddress("glUniform1i"));
+    if (!sf_ptrc_glUniform1i)
+        numFailed++;
+
+    sf_ptrc_glUniformMatrix4fv = reinterpret_cast<void (GL_FUNCPTR *)(GLint, GLsizei, GLboolean, const GLfloat*)>(glLoaderGetProcAddress("glUniformMatrix4fv"));
+    if (!sf_ptrc_glUniformMatrix4fv)
+        numFailed++;
+
+    sf_ptrc_glUnmapBuffer = reinterpret_cast<GLboolean (GL_FUNCPTR *)(GLenum)>(glLoaderGetProcAddress("glUnmapBuffer"));
+    if (!sf_ptrc_glUnmapBuffer)
+        numFailed++;
+
+    sf_ptrc_glUseProgram = reinterpret_cast<void (GL_FUNCPTR *)(GLuint)>(glLoaderGetProcAddress("glUseProgram"));
+    if (!sf_ptrc_glUseProgram)
+        numFailed++;
+
+    sf_ptrc_glVertexAttribPointer = reinterpret_cast<void (GL_FUNCPTR *)(GLuint, GLint, GLenum, GLboolean, GLsizei, const void*)>(glLoaderGetProcAddress("glVertexAttribPointer"));
+    if (!sf_ptrc_glVertexAttribPointer)
+        numFailed++;
+
+    return numFailed;
+}
+
 typedef int (*PFN_LOADFUNCPOINTERS)();
 typedef struct sfogl_StrToExtMap_s
 {
@@ -806,7 +1036,7 @@ typedef struct sfogl_StrToExtMap_s
     PFN_LOADFUNCPOINTERS LoadExtension;
 } sfogl_StrToExtMap;
 
-static sfogl_StrToExtMap ExtensionMap[13] = {
+static sfogl_StrToExtMap ExtensionMap[17] = {
     {"GL_SGIS_texture_edge_clamp", &sfogl_ext_SGIS_texture_edge_clamp, NULL},
     {"GL_EXT_texture_edge_clamp", &sfogl_ext_EXT_texture_edge_clamp, NULL},
     {"GL_EXT_blend_minmax", &sfogl_ext_EXT_blend_minmax, Load_EXT_blend_minmax},
@@ -819,10 +1049,14 @@ static sfogl_StrToExtMap ExtensionMap[13] = {
     {"GL_ARB_fragment_shader", &sfogl_ext_ARB_fragment_shader, NULL},
     {"GL_ARB_texture_non_power_of_two", &sfogl_ext_ARB_texture_non_power_of_two, NULL},
     {"GL_EXT_blend_equation_separate", &sfogl_ext_EXT_blend_equation_separate, Load_EXT_blend_equation_separate},
-    {"GL_EXT_framebuffer_object", &sfogl_ext_EXT_framebuffer_object, Load_EXT_framebuffer_object}
+    {"GL_EXT_framebuffer_object", &sfogl_ext_EXT_framebuffer_object, Load_EXT_framebuffer_object},
+    {"GL_ARB_texture_float", &sfogl_ext_ARB_texture_float, NULL},
+    {"GL_ARB_texture_rg", &sfogl_ext_ARB_texture_rg, NULL},
+    {"GL_ARB_buffer_storage", &sfogl_ext_ARB_buffer_storage, Load_ARB_buffer_storage},
+    {"GL_ARB_timer_query", &sfogl_ext_ARB_timer_query, Load_ARB_timer_query}
 };
 
-static int g_extensionMapSize = 13;
+static int g_extensionMapSize = 17;
 
 
 static void ClearExtensionVars()
@@ -840,6 +1074,11 @@ static void ClearExtensionVars()
     sfogl_ext_ARB_texture_non_power_of_two = sfogl_LOAD_FAILED;
     sfogl_ext_EXT_blend_equation_separate = sfogl_LOAD_FAILED;
     sfogl_ext_EXT_framebuffer_object = sfogl_LOAD_FAILED;
+    sfogl_ext_ARB_texture_float = sfogl_LOAD_FAILED;
+    sfogl_ext_ARB_texture_rg = sfogl_LOAD_FAILED;
+    sfogl_ext_ARB_buffer_storage = sfogl_LOAD_FAILED;
+    sfogl_ext_ARB_timer_query = sfogl_LOAD_FAILED;
+    sfogl_core_3_2 = sfogl_LOAD_FAILED;
 }
 
 
@@ -865,4 +1104,8 @@ void sfogl_LoadFunctions()
         if (sf::Context::isExtensionAvailable(ExtensionMap[i].extensionName))
             LoadExtension(ExtensionMap[i]);
     }
+
+    // The core profile renderer requires all of these functions
+    if (Load_Version_3_2() == 0)
+        sfogl_core_3_2 = sfogl_LOAD_SUCCEEDED;
 }
@@ -183,6 +183,11 @@ extern int sfogl_ext_ARB_fragment_shader;
 extern int sfogl_ext_ARB_texture_non_power_of_two;
 extern int sfogl_ext_EXT_blend_equation_separate;
 extern int sfogl_ext_EXT_framebuffer_object;
+extern int sfogl_ext_ARB_texture_float;
+extern int sfogl_ext_ARB_texture_rg;
+extern int sfogl_ext_ARB_buffer_storage;
+extern int sfogl_ext_ARB_timer_query;
+extern int sfogl_core_3_2;
 
 #define GL_CLAMP_TO_EDGE_SGIS 0x812F
 
@@ -360,6 +365,41 @@ extern int sfogl_ext_EXT_framebuffer_object;
 #define GL_STENCIL_INDEX4_EXT 0x8D47
 #define GL_STENCIL_INDEX8_EXT 0x8D48
 
+#define GL_RGBA16F_ARB 0x881A
+#define GL_RGBA32F_ARB 0x8814
+
+#define GL_R16F 0x822D
+#define GL_R32F 0x822E
+#define GL_R8 0x8229
+#define GL_RG 0x8227
+#define GL_RG8 0x822B
+
+#define GL_ARRAY_BUFFER 0x8892
+#define GL_COMPILE_STATUS 0x8B81
+#define GL_ELEMENT_ARRAY_BUFFER 0x8893
+#define GL_FRAGMENT_SHADER 0x8B30
+#define GL_LINK_STATUS 0x8B82
+#define GL_STREAM_DRAW 0x88E0
+#define GL_VERTEX_SHADER 0x8B31
+
+#define GL_ALREADY_SIGNALED 0x911A
+#define GL_CONDITION_SATISFIED 0x911C
+#define GL_MAP_INVALIDATE_RANGE_BIT 0x0004
+#define GL_MAP_UNSYNCHRONIZED_BIT 0x0020
+#define GL_MAP_WRITE_BIT 0x0002
+#define GL_SYNC_FLUSH_COMMANDS_BIT 0x00000001
+#define GL_SYNC_GPU_COMMANDS_COMPLETE 0x9117
+#define GL_TIMEOUT_EXPIRED 0x911B
+#define GL_WAIT_FAILED 0x911D
+
+#define GL_MAP_COHERENT_BIT 0x0080
+#define GL_MAP_PERSISTENT_BIT 0x0040
+
+#define GL_QUERY_RESULT 0x8866
+#define GL_QUERY_RESULT_AVAILABLE 0x8867
+#define GL_TIMESTAMP 0x8E28
+#define GL_TIME_ELAPSED 0x88BF
+
 #define GL_2D 0x0600
 #define GL_2_BYTES 0x1407
 #define GL_3D 0x0601
@@ -1201,6 +1241,98 @@ extern void (GL_FUNCPTR *sf_ptrc_glRenderbufferStorageEXT)(GLenum, GLenum, GLsiz
 #define glRenderbufferStorageEXT sf_ptrc_glRenderbufferStorageEXT
 #endif // GL_EXT_framebuffer_object
 
+#ifndef GL_ARB_buffer_storage
+#define GL_ARB_buffer_storage 1
+extern void (GL_FUNCPTR *sf_ptrc_glBufferStorage)(GLenum, GLsizeiptr, const void*, GLbitfield);
+#define glBufferStorage sf_ptrc_glBufferStorage
+#endif // GL_ARB_buffer_storage
+
+#ifndef GL_ARB_timer_query
+#define GL_ARB_timer_query 1
+extern void (GL_FUNCPTR *sf_ptrc_glDeleteQueries)(GLsizei, const GLuint*);
+#define glDeleteQueries sf_ptrc_glDeleteQueries
+extern void (GL_FUNCPTR *sf_ptrc_glGenQueries)(GLsizei, GLuint*);
+#define glGenQueries sf_ptrc_glGenQueries
+extern void (GL_FUNCPTR *sf_ptrc_glGetQueryObjectiv)(GLuint, GLenum, GLint*);
+#define glGetQueryObjectiv sf_ptrc_glGetQueryObjectiv
+extern void (GL_FUNCPTR *sf_ptrc_glGetQueryObjectui64v)(GLuint, GLenum, GLuint64*);
+#define glGetQueryObjectui64v sf_ptrc_glGetQueryObjectui64v
+extern void (GL_FUNCPTR *sf_ptrc_glQueryCounter)(GLuint, GLenum);
+#define glQueryCounter sf_ptrc_glQueryCounter
+#endif // GL_ARB_timer_query
+
+#ifndef GL_VERSION_3_2
+#define GL_VERSION_3_2 1
+extern void (GL_FUNCPTR *sf_ptrc_glAttachShader)(GLuint, GLuint);
+#define glAttachShader sf_ptrc_glAttachShader
+extern void (GL_FUNCPTR *sf_ptrc_glBindAttribLocation)(GLuint, GLuint, const GLchar*);
+#define glBindAttribLocation sf_ptrc_glBindAttribLocation
+extern void (GL_FUNCPTR *sf_ptrc_glBindBuffer)(GLenum, GLuint);
+#define glBindBuffer sf_ptrc_glBindBuffer
+extern void (GL_FUNCPTR *sf_ptrc_glBindVertexArray)(GLuint);
+#define glBindVertexArray sf_ptrc_glBindVertexArray
+extern void (GL_FUNCPTR *sf_ptrc_glBufferData)(GLenum, GLsizeiptr, const void*, GLenum);
+#define glBufferData sf_ptrc_glBufferData
+extern void (GL_FUNCPTR *sf_ptrc_glBufferSubData)(GLenum, GLintptr, GLsizeiptr, const void*);
+#define glBufferSubData sf_ptrc_glBufferSubData
+extern GLenum (GL_FUNCPTR *sf_ptrc_glClientWaitSync)(GLsync, GLbitfield, GLuint64);
+#define glClientWaitSync sf_ptrc_glClientWaitSync
+extern void (GL_FUNCPTR *sf_ptrc_glCompileShader)(GLuint);
+#define glCompileShader sf_ptrc_glCompileShader
+extern GLuint (GL_FUNCPTR *sf_ptrc_glCreateProgram)();
+#define glCreateProgram sf_ptrc_glCreateProgram
+extern GLuint (GL_FUNCPTR *sf_ptrc_glCreateShader)(GLenum);
+#define glCreateShader sf_ptrc_glCreateShader
+extern void (GL_FUNCPTR *sf_ptrc_glDeleteBuffers)(GLsizei, const GLuint*);
+#define glDeleteBuffers sf_ptrc_glDeleteBuffers
+extern void (GL_FUNCPTR *sf_ptrc_glDeleteProgram)(GLuint);
+#define glDeleteProgram sf_ptrc_glDeleteProgram
+extern void (GL_FUNCPTR *sf_ptrc_glDeleteShader)(GLuint);
+#define glDeleteShader sf_ptrc_glDeleteShader
+extern void (GL_FUNCPTR *sf_ptrc_glDeleteSync)(GLsync);
+#define glDeleteSync sf_ptrc_glDeleteSync
+extern void (GL_FUNCPTR *sf_ptrc_glDeleteVertexArrays)(GLsizei, const GLuint*);
+#define glDeleteVertexArrays sf_ptrc_glDeleteVertexArrays
+extern void (GL_FUNCPTR *sf_ptrc_glDrawElementsBaseVertex)(GLenum, GLsizei, GLenum, const void*, GLint);
+#define glDrawElementsBaseVertex sf_ptrc_glDrawElementsBaseVertex
+extern void (GL_FUNCPTR *sf_ptrc_glEnableVertexAttribArray)(GLuint);
+#define glEnableVertexAttribArray sf_ptrc_glEnableVertexAttribArray
+extern GLsync (GL_FUNCPTR *sf_ptrc_glFenceSync)(GLenum, GLbitfield);
+#define glFenceSync sf_ptrc_glFenceSync
+extern void (GL_FUNCPTR *sf_ptrc_glGenBuffers)(GLsizei, GLuint*);
+#define glGenBuffers sf_ptrc_glGenBuffers
+extern void (GL_FUNCPTR *sf_ptrc_glGenVertexArrays)(GLsizei, GLuint*);
+#define glGenVertexArrays sf_ptrc_glGenVertexArrays
+extern void (GL_FUNCPTR *sf_ptrc_glGetProgramInfoLog)(GLuint, GLsizei, GLsizei*, GLchar*);
+#define glGetProgramInfoLog sf_ptrc_glGetProgramInfoLog
+extern void (GL_FUNCPTR *sf_ptrc_glGetProgramiv)(GLuint, GLenum, GLint*);
+#define glGetProgramiv sf_ptrc_glGetProgramiv
+extern void (GL_FUNCPTR *sf_ptrc_glGetShaderInfoLog)(GLuint, GLsizei, GLsizei*, GLchar*);
+#define glGetShaderInfoLog sf_ptrc_glGetShaderInfoLog
+extern void (GL_FUNCPTR *sf_ptrc_glGetShaderiv)(GLuint, GLenum, GLint*);
+#define glGetShaderiv sf_ptrc_glGetShaderiv
+extern GLint (GL_FUNCPTR *sf_ptrc_glGetUniformLocation)(GLuint, const GLchar*);
+#define glGetUniformLocation sf_ptrc_glGetUniformLocation
+extern void (GL_FUNCPTR *sf_ptrc_glLinkProgram)(GLuint);
+#define glLinkProgram sf_ptrc_glLinkProgram
+extern void* (GL_FUNCPTR *sf_ptrc_glMapBufferRange)(GLenum, GLintptr, GLsizeiptr, GLbitfield);
+#define glMapBufferRange sf_ptrc_glMapBufferRange
+extern void (GL_FUNCPTR *sf_ptrc_glShaderSource)(GLuint, GLsizei, const GLchar* const*, const GLint*);
+#define glShaderSource sf_ptrc_glShaderSource
+extern void (GL_FUNCPTR *sf_ptrc_glUniform1f)(GLint, GLfloat);
+#define glUniform1f sf_ptrc_glUniform1f
+extern void (GL_FUNCPTR *sf_ptrc_glUniform1i)(GLint, GLint);
+#define glUniform1i sf_ptrc_glUniform1i
+extern void (GL_FUNCPTR *sf_ptrc_glUniformMatrix4fv)(GLint, GLsizei, GLboolean, const GLfloat*);
+#define glUniformMatrix4fv sf_ptrc_glUniformMatrix4fv
+extern GLboolean (GL_FUNCPTR *sf_ptrc_glUnmapBuffer)(GLenum);
+#define glUnmapBuffer sf_ptrc_glUnmapBuffer
+extern void (GL_FUNCPTR *sf_ptrc_glUseProgram)(GLuint);
+#define glUseProgram sf_ptrc_glUseProgram
+extern void (GL_FUNCPTR *sf_ptrc_glVertexAttribPointer)(GLuint, GLint, GLenum, GLboolean, GLsizei, const void*);
+#define glVertexAttribPointer sf_ptrc_glVertexAttribPointer
+#endif // GL_VERSION_3_2
+
 GLAPI void APIENTRY glAccum(GLenum, GLfloat);
 GLAPI void APIENTRY glAlphaFunc(GLenum, GLfloat);
 GLAPI void APIENTRY glBegin(GLenum);
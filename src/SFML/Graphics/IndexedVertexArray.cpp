@@ -0,0 +1,189 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/IndexedVertexArray.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+IndexedVertexArray::IndexedVertexArray() :
+m_vertices     (),
+m_indices      (),
+m_primitiveType(Points)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+IndexedVertexArray::IndexedVertexArray(PrimitiveType type, std::size_t vertexCount) :
+m_vertices     (vertexCount),
+m_indices      (),
+m_primitiveType(type)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t IndexedVertexArray::getVertexCount() const
+{
+    return m_vertices.size();
+}
+
+
+////////////////////////////////////////////////////////////
+Vertex& IndexedVertexArray::operator [](std::size_t index)
+{
+    return m_vertices[index];
+}
+
+
+////////////////////////////////////////////////////////////
+const Vertex& IndexedVertexArray::operator [](std::size_t index) const
+{
+    return m_vertices[index];
+}
+
+
+////////////////////////////////////////////////////////////
+void IndexedVertexArray::resize(std::size_t vertexCount)
+{
+    m_vertices.resize(vertexCount);
+}
+
+
+////////////////////////////////////////////////////////////
+Uint32 IndexedVertexArray::append(const Vertex& vertex)
+{
+    m_vertices.push_back(vertex);
+
+    return static_cast<Uint32>(m_vertices.size() - 1);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t IndexedVertexArray::getIndexCount() const
+{
+    return m_indices.size();
+}
+
+
+////////////////////////////////////////////////////////////
+Uint32& IndexedVertexArray::getIndex(std::size_t position)
+{
+    return m_indices[position];
+}
+
+
+////////////////////////////////////////////////////////////
+Uint32 IndexedVertexArray::getIndex(std::size_t position) const
+{
+    return m_indices[position];
+}
+
+
+////////////////////////////////////////////////////////////
+void IndexedVertexArray::resizeIndices(std::size_t indexCount)
+{
+    m_indices.resize(indexCount);
+}
+
+
+////////////////////////////////////////////////////////////
+void IndexedVertexArray::appendIndex(Uint32 index)
+{
+    m_indices.push_back(index);
+}
+
+
+////////////////////////////////////////////////////////////
+void IndexedVertexArray::clear()
+{
+    m_vertices.clear();
+    m_indices.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+void IndexedVertexArray::setPrimitiveType(PrimitiveType type)
+{
+    m_primitiveType = type;
+}
+
+
+////////////////////////////////////////////////////////////
+PrimitiveType IndexedVertexArray::getPrimitiveType() const
+{
+    return m_primitiveType;
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect IndexedVertexArray::getBounds() const
+{
+    if (!m_vertices.empty())
+    {
+        float left   = m_vertices[0].position.x;
+        float top    = m_vertices[0].position.y;
+        float right  = m_vertices[0].position.x;
+        float bottom = m_vertices[0].position.y;
+
+        for (std::size_t i = 1; i < m_vertices.size(); ++i)
+        {
+            Vector2f position = m_vertices[i].position;
+
+            // Update left and right
+            if (position.x < left)
+                left = position.x;
+            else if (position.x > right)
+                right = position.x;
+
+            // Update top and bottom
+            if (position.y < top)
+                top = position.y;
+            else if (position.y > bottom)
+                bottom = position.y;
+        }
+
+        return FloatRect(left, top, right - left, bottom - top);
+    }
+    else
+    {
+        // Array is empty
+        return FloatRect();
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void IndexedVertexArray::draw(RenderTarget& target, RenderStates states) const
+{
+    if (!m_vertices.empty() && !m_indices.empty())
+        target.draw(&m_vertices[0], m_vertices.size(), &m_indices[0], m_indices.size(), m_primitiveType, states);
+}
+
+} // namespace sf
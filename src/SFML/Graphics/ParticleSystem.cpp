@@ -0,0 +1,525 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/ParticleSystem.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/System/Thread.hpp>
+#include <SFML/System/ThreadSignal.hpp>
+#include <algorithm>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+    #include <xmmintrin.h>
+    #define SFML_PARTICLES_SSE
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+    #include <arm_neon.h>
+    #define SFML_PARTICLES_NEON
+#endif
+
+
+namespace
+{
+    // Particles are only split among threads if each one gets at least this many of them
+    const std::size_t minParticlesPerThread = 8192;
+
+    // Layout of the vertices of a particle
+    struct Geometry
+    {
+        std::size_t  verticesPerParticle;
+        sf::Vector2f halfSize;
+        sf::Vector2f textureSize;
+    };
+
+    // Range of particles processed by a single thread
+    struct UpdateRange
+    {
+        float*           positionsX;
+        float*           positionsY;
+        float*           velocitiesX;
+        float*           velocitiesY;
+        float*           lifetimes;
+        const sf::Color* colors;
+        sf::Vertex*      vertices;
+        Geometry         geometry;
+        std::size_t      begin;
+        std::size_t      end;
+        float            elapsed;
+        sf::Vector2f     acceleration;
+    };
+
+    // Get the number of vertices used by each particle
+    std::size_t getVerticesPerParticle(const sf::Vector2f& particleSize)
+    {
+        // Points use a single vertex, quads are made of two triangles
+        return (particleSize.x == 0.f) && (particleSize.y == 0.f) ? 1 : 6;
+    }
+
+    // Compute the layout of the vertices of a particle
+    Geometry makeGeometry(const sf::Vector2f& particleSize, const sf::Texture* texture)
+    {
+        Geometry geometry;
+        geometry.verticesPerParticle = getVerticesPerParticle(particleSize);
+        geometry.halfSize = particleSize / 2.f;
+        geometry.textureSize = texture ? sf::Vector2f(texture->getSize()) : sf::Vector2f();
+        return geometry;
+    }
+
+    // Write the vertices of a single particle
+    void writeParticle(sf::Vertex* vertices, float x, float y, const sf::Color& color, const Geometry& geometry)
+    {
+        if (geometry.verticesPerParticle == 1)
+        {
+            vertices[0].position.x = x;
+            vertices[0].position.y = y;
+            vertices[0].color = color;
+        }
+        else
+        {
+            float left   = x - geometry.halfSize.x;
+            float top    = y - geometry.halfSize.y;
+            float right  = x + geometry.halfSize.x;
+            float bottom = y + geometry.halfSize.y;
+            float u      = geometry.textureSize.x;
+            float v      = geometry.textureSize.y;
+
+            vertices[0] = sf::Vertex(sf::Vector2f(left,  top),    color, sf::Vector2f(0, 0));
+            vertices[1] = sf::Vertex(sf::Vector2f(right, top),    color, sf::Vector2f(u, 0));
+            vertices[2] = sf::Vertex(sf::Vector2f(left,  bottom), color, sf::Vector2f(0, v));
+            vertices[3] = sf::Vertex(sf::Vector2f(left,  bottom), color, sf::Vector2f(0, v));
+            vertices[4] = sf::Vertex(sf::Vector2f(right, top),    color, sf::Vector2f(u, 0));
+            vertices[5] = sf::Vertex(sf::Vector2f(right, bottom), color, sf::Vector2f(u, v));
+        }
+    }
+
+    // Write the vertices of a range of particles
+    void buildGeometry(const UpdateRange& range)
+    {
+        std::size_t stride = range.geometry.verticesPerParticle;
+        for (std::size_t i = range.begin; i < range.end; ++i)
+            writeParticle(range.vertices + i * stride, range.positionsX[i], range.positionsY[i], range.colors[i], range.geometry);
+    }
+
+    // Move and age a range of particles
+    void integrate(const UpdateRange& range)
+    {
+        float dt = range.elapsed;
+        float dvx = range.acceleration.x * dt;
+        float dvy = range.acceleration.y * dt;
+        std::size_t i = range.begin;
+
+    #if defined(SFML_PARTICLES_SSE)
+
+        // Process 4 particles at a time
+        __m128 dt4  = _mm_set1_ps(dt);
+        __m128 dvx4 = _mm_set1_ps(dvx);
+        __m128 dvy4 = _mm_set1_ps(dvy);
+        for (; i + 4 <= range.end; i += 4)
+        {
+            __m128 vx = _mm_add_ps(_mm_loadu_ps(range.velocitiesX + i), dvx4);
+            __m128 vy = _mm_add_ps(_mm_loadu_ps(range.velocitiesY + i), dvy4);
+            _mm_storeu_ps(range.velocitiesX + i, vx);
+            _mm_storeu_ps(range.velocitiesY + i, vy);
+            _mm_storeu_ps(range.positionsX + i, _mm_add_ps(_mm_loadu_ps(range.positionsX + i), _mm_mul_ps(vx, dt4)));
+            _mm_storeu_ps(range.positionsY + i, _mm_add_ps(_mm_loadu_ps(range.positionsY + i), _mm_mul_ps(vy, dt4)));
+            _mm_storeu_ps(range.lifetimes + i, _mm_sub_ps(_mm_loadu_ps(range.lifetimes + i), dt4));
+        }
+
+    #elif defined(SFML_PARTICLES_NEON)
+
+        // Process 4 particles at a time
+        float32x4_t dt4  = vdupq_n_f32(dt);
+        float32x4_t dvx4 = vdupq_n_f32(dvx);
+        float32x4_t dvy4 = vdupq_n_f32(dvy);
+        for (; i + 4 <= range.end; i += 4)
+        {
+            float32x4_t vx = vaddq_f32(vld1q_f32(range.velocitiesX + i), dvx4);
+            float32x4_t vy = vaddq_f32(vld1q_f32(range.velocitiesY + i), dvy4);
+            vst1q_f32(range.velocitiesX + i, vx);
+            vst1q_f32(range.velocitiesY + i, vy);
+            vst1q_f32(range.positionsX + i, vmlaq_f32(vld1q_f32(range.positionsX + i), vx, dt4));
+            vst1q_f32(range.positionsY + i, vmlaq_f32(vld1q_f32(range.positionsY + i), vy, dt4));
+            vst1q_f32(range.lifetimes + i, vsubq_f32(vld1q_f32(range.lifetimes + i), dt4));
+        }
+
+    #endif
+
+        // Process the remaining particles one by one
+        for (; i < range.end; ++i)
+        {
+            range.velocitiesX[i] += dvx;
+            range.velocitiesY[i] += dvy;
+            range.positionsX[i] += range.velocitiesX[i] * dt;
+            range.positionsY[i] += range.velocitiesY[i] * dt;
+            range.lifetimes[i] -= dt;
+        }
+    }
+
+    // Entry point of the update threads
+    void updateRange(UpdateRange range)
+    {
+        integrate(range);
+        buildGeometry(range);
+    }
+}
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct ParticleSystem::Worker
+{
+    Worker() :
+    thread(&Worker::run, this),
+    range (),
+    quit  (false)
+    {
+        thread.launch();
+    }
+
+    ~Worker()
+    {
+        // The signal orders the write of quit before the wake-up
+        quit = true;
+        start.notify();
+        thread.wait();
+    }
+
+    void run()
+    {
+        for (;;)
+        {
+            start.wait();
+            if (quit)
+                return;
+
+            updateRange(range);
+            done.notify();
+        }
+    }
+
+    Thread       thread; ///< Thread running the worker
+    ThreadSignal start;  ///< Notified when the range is ready to be processed
+    ThreadSignal done;   ///< Notified when the range has been processed
+    UpdateRange  range;  ///< Range of particles to process
+    bool         quit;   ///< Must the thread terminate?
+};
+
+
+////////////////////////////////////////////////////////////
+ParticleSystem::ParticleSystem(std::size_t capacity) :
+m_capacity    (capacity),
+m_count       (0),
+m_positionsX  (capacity),
+m_positionsY  (capacity),
+m_velocitiesX (capacity),
+m_velocitiesY (capacity),
+m_lifetimes   (capacity),
+m_colors      (capacity),
+m_vertices    (capacity),
+m_acceleration(0, 0),
+m_particleSize(0, 0),
+m_texture     (NULL),
+m_threadCount (1),
+m_workers     ()
+{
+}
+
+
+////////////////////////////////////////////////////////////
+ParticleSystem::ParticleSystem(const ParticleSystem& copy) :
+Drawable      (copy),
+Transformable (copy),
+m_capacity    (copy.m_capacity),
+m_count       (copy.m_count),
+m_positionsX  (copy.m_positionsX),
+m_positionsY  (copy.m_positionsY),
+m_velocitiesX (copy.m_velocitiesX),
+m_velocitiesY (copy.m_velocitiesY),
+m_lifetimes   (copy.m_lifetimes),
+m_colors      (copy.m_colors),
+m_vertices    (copy.m_vertices),
+m_acceleration(copy.m_acceleration),
+m_particleSize(copy.m_particleSize),
+m_texture     (copy.m_texture),
+m_threadCount (copy.m_threadCount),
+m_workers     () // don't share the worker threads
+{
+}
+
+
+////////////////////////////////////////////////////////////
+ParticleSystem::~ParticleSystem()
+{
+    destroyWorkers();
+}
+
+
+////////////////////////////////////////////////////////////
+ParticleSystem& ParticleSystem::operator =(const ParticleSystem& right)
+{
+    if (this != &right)
+    {
+        Transformable::operator =(right);
+
+        m_capacity     = right.m_capacity;
+        m_count        = right.m_count;
+        m_positionsX   = right.m_positionsX;
+        m_positionsY   = right.m_positionsY;
+        m_velocitiesX  = right.m_velocitiesX;
+        m_velocitiesY  = right.m_velocitiesY;
+        m_lifetimes    = right.m_lifetimes;
+        m_colors       = right.m_colors;
+        m_vertices     = right.m_vertices;
+        m_acceleration = right.m_acceleration;
+        m_particleSize = right.m_particleSize;
+        m_texture      = right.m_texture;
+        m_threadCount  = right.m_threadCount;
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+bool ParticleSystem::emit(const Vector2f& position, const Vector2f& velocity, Time lifetime, const Color& color)
+{
+    if (m_count >= m_capacity)
+        return false;
+
+    std::size_t index = m_count++;
+    m_positionsX[index] = position.x;
+    m_positionsY[index] = position.y;
+    m_velocitiesX[index] = velocity.x;
+    m_velocitiesY[index] = velocity.y;
+    m_lifetimes[index] = lifetime.asSeconds();
+    m_colors[index] = color;
+
+    // Make the particle drawable right away
+    Geometry geometry = makeGeometry(m_particleSize, m_texture);
+    writeParticle(&m_vertices[index * geometry.verticesPerParticle], position.x, position.y, color, geometry);
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::update(Time elapsed)
+{
+    if (m_count == 0)
+        return;
+
+    UpdateRange range;
+    range.positionsX = &m_positionsX[0];
+    range.positionsY = &m_positionsY[0];
+    range.velocitiesX = &m_velocitiesX[0];
+    range.velocitiesY = &m_velocitiesY[0];
+    range.lifetimes = &m_lifetimes[0];
+    range.colors = &m_colors[0];
+    range.vertices = &m_vertices[0];
+    range.geometry = makeGeometry(m_particleSize, m_texture);
+    range.elapsed = elapsed.asSeconds();
+    range.acceleration = m_acceleration;
+
+    // Split the particles into ranges, one per thread
+    std::size_t threadCount = std::min<std::size_t>(m_threadCount, m_count / minParticlesPerThread);
+    threadCount = std::max<std::size_t>(threadCount, 1);
+    std::size_t step = (m_count + threadCount - 1) / threadCount;
+
+    // Create the missing workers, the first time they are needed
+    while (m_workers.size() < threadCount - 1)
+        m_workers.push_back(new Worker);
+
+    // Wake a worker up for each range but the first one
+    for (std::size_t i = 1; i < threadCount; ++i)
+    {
+        Worker& worker = *m_workers[i - 1];
+        worker.range = range;
+        worker.range.begin = i * step;
+        worker.range.end = std::min(worker.range.begin + step, m_count);
+        worker.start.notify();
+    }
+
+    // The first range is processed by the calling thread
+    range.begin = 0;
+    range.end = std::min(step, m_count);
+    updateRange(range);
+
+    for (std::size_t i = 1; i < threadCount; ++i)
+        m_workers[i - 1]->done.wait();
+
+    removeDeadParticles();
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::clear()
+{
+    m_count = 0;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t ParticleSystem::getParticleCount() const
+{
+    return m_count;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t ParticleSystem::getCapacity() const
+{
+    return m_capacity;
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::setAcceleration(const Vector2f& acceleration)
+{
+    m_acceleration = acceleration;
+}
+
+
+////////////////////////////////////////////////////////////
+const Vector2f& ParticleSystem::getAcceleration() const
+{
+    return m_acceleration;
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::setParticleSize(const Vector2f& size)
+{
+    m_particleSize = size;
+    m_vertices.resize(m_capacity * getVerticesPerParticle(size));
+
+    updateVertices();
+}
+
+
+////////////////////////////////////////////////////////////
+const Vector2f& ParticleSystem::getParticleSize() const
+{
+    return m_particleSize;
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::setTexture(const Texture& texture)
+{
+    m_texture = &texture;
+
+    updateVertices();
+}
+
+
+////////////////////////////////////////////////////////////
+const Texture* ParticleSystem::getTexture() const
+{
+    return m_texture;
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::setThreadCount(unsigned int count)
+{
+    m_threadCount = std::max(count, 1u);
+
+    // Release the workers that are not needed anymore
+    while (m_workers.size() > m_threadCount - 1)
+    {
+        delete m_workers.back();
+        m_workers.pop_back();
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::destroyWorkers()
+{
+    for (std::vector<Worker*>::iterator it = m_workers.begin(); it != m_workers.end(); ++it)
+        delete *it;
+    m_workers.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::draw(RenderTarget& target, RenderStates states) const
+{
+    if (m_count == 0)
+        return;
+
+    std::size_t verticesPerParticle = getVerticesPerParticle(m_particleSize);
+
+    states.transform *= getTransform();
+    if (verticesPerParticle > 1)
+        states.texture = m_texture;
+
+    target.draw(&m_vertices[0], m_count * verticesPerParticle, verticesPerParticle > 1 ? Triangles : Points, states);
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::updateVertices()
+{
+    Geometry geometry = makeGeometry(m_particleSize, m_texture);
+    for (std::size_t i = 0; i < m_count; ++i)
+        writeParticle(&m_vertices[i * geometry.verticesPerParticle], m_positionsX[i], m_positionsY[i], m_colors[i], geometry);
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::removeDeadParticles()
+{
+    std::size_t verticesPerParticle = getVerticesPerParticle(m_particleSize);
+
+    std::size_t i = 0;
+    while (i < m_count)
+    {
+        if (m_lifetimes[i] > 0.f)
+        {
+            ++i;
+            continue;
+        }
+
+        // Replace the dead particle with the last one
+        std::size_t last = --m_count;
+        if (i != last)
+        {
+            m_positionsX[i] = m_positionsX[last];
+            m_positionsY[i] = m_positionsY[last];
+            m_velocitiesX[i] = m_velocitiesX[last];
+            m_velocitiesY[i] = m_velocitiesY[last];
+            m_lifetimes[i] = m_lifetimes[last];
+            m_colors[i] = m_colors[last];
+            std::copy(m_vertices.begin() + last * verticesPerParticle,
+                      m_vertices.begin() + (last + 1) * verticesPerParticle,
+                      m_vertices.begin() + i * verticesPerParticle);
+        }
+    }
+}
+
+} // namespace sf
@@ -31,12 +31,32 @@
 #include <SFML/Graphics/Texture.hpp>
 #include <SFML/Graphics/VertexArray.hpp>
 #include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Graphics/CoreRenderer.hpp>
+#include <SFML/Graphics/FrameProfiler.hpp>
+#include <SFML/Window/Context.hpp>
 #include <SFML/System/Err.hpp>
+#include <SFML/System/Mutex.hpp>
+#include <SFML/System/Lock.hpp>
 #include <cassert>
 #include <iostream>
+#include <map>
+#include <vector>
 
 namespace
 {
+    // Identifier of the render target active in each context
+    typedef std::map<sf::Uint64, sf::Uint64> ActiveTargetMap;
+    ActiveTargetMap activeTargets;
+    sf::Mutex activeTargetsMutex;
+
+    // Generate a unique identifier for a new render target
+    sf::Uint64 getUniqueTargetId()
+    {
+        static sf::Uint64 nextId = 1;
+        sf::Lock lock(activeTargetsMutex);
+        return nextId++;
+    }
+
     // Convert an sf::BlendMode::Factor constant to the corresponding OpenGL constant.
     sf::Uint32 factorToGlConstant(sf::BlendMode::Factor blendFactor)
     {
@@ -73,6 +93,26 @@ namespace
         assert(false);
         return GLEXT_GL_FUNC_ADD;
     }
+
+
+    // Setup the pointers to the components of standard vertices
+    void setVertexPointers(const sf::Vertex* vertices)
+    {
+        const char* data = reinterpret_cast<const char*>(vertices);
+        glCheck(glVertexPointer(2, GL_FLOAT, sizeof(sf::Vertex), data + 0));
+        glCheck(glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(sf::Vertex), data + 8));
+        glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(sf::Vertex), data + 12));
+    }
+
+
+    // Setup the pointers to the components of compact vertices
+    void setVertexPointers(const sf::CompactVertex* vertices)
+    {
+        const char* data = reinterpret_cast<const char*>(vertices);
+        glCheck(glVertexPointer(2, GL_SHORT, sizeof(sf::CompactVertex), data + 0));
+        glCheck(glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(sf::CompactVertex), data + 4));
+        glCheck(glTexCoordPointer(2, GL_SHORT, sizeof(sf::CompactVertex), data + 8));
+    }
 }
 
 
@@ -82,25 +122,33 @@ namespace sf
 RenderTarget::RenderTarget() :
 m_defaultView(),
 m_view       (),
-m_cache      ()
+m_cache      (),
+m_id         (getUniqueTargetId()),
+m_profiler   (NULL)
 {
     m_cache.glStatesSet = false;
+    m_cache.contextId = 0;
+    m_cache.coreRenderer = NULL;
 }
 
 
 ////////////////////////////////////////////////////////////
 RenderTarget::~RenderTarget()
 {
+    delete m_profiler;
 }
 
 
 ////////////////////////////////////////////////////////////
 void RenderTarget::clear(const Color& color)
 {
-    if (activate(true))
+    if (ensureActive())
     {
         // Unbind texture to fix RenderTexture preventing clear
-        applyTexture(NULL);
+        if (m_cache.glStatesSet)
+            applyTexture(NULL);
+        else
+            glCheck(glBindTexture(GL_TEXTURE_2D, 0));
 
         glCheck(glClearColor(color.r / 255.f, color.g / 255.f, color.b / 255.f, color.a / 255.f));
         glCheck(glClear(GL_COLOR_BUFFER_BIT));
@@ -213,17 +261,14 @@ void RenderTarget::draw(const Vertex* vertices, std::size_t vertexCount,
         #define GL_QUADS 0
     #endif
 
-    if (activate(true))
+    if (ensureActive())
     {
-        // First set the persistent OpenGL states if it's the very first call
-        if (!m_cache.glStatesSet)
-            resetGLStates();
-
         // Check if the vertex count is low enough so that we can pre-transform them
         bool useVertexCache = (vertexCount <= StatesCache::VertexCacheSize);
         if (useVertexCache)
         {
-            // Pre-transform the vertices and store them into the vertex cache
+            // Pre-transform the vertices and store them into the vertex cache; there are
+            // too few of them for Transform::transformPoints to pay off
             for (std::size_t i = 0; i < vertexCount; ++i)
             {
                 Vertex& vertex = m_cache.vertexCache[i];
@@ -231,79 +276,103 @@ void RenderTarget::draw(const Vertex* vertices, std::size_t vertexCount,
                 vertex.color = vertices[i].color;
                 vertex.texCoords = vertices[i].texCoords;
             }
+        }
+
+        setupDraw(useVertexCache, states);
 
-            // Since vertices are transformed, we must use an identity transform to render them
-            if (!m_cache.useVertexCache)
-                applyTransform(Transform::Identity);
+        if (m_profiler)
+            m_profiler->addDrawCall(vertexCount);
+
+        if (m_cache.coreRenderer)
+        {
+            // The core profile renderer streams the vertices to its vertex buffer on each draw
+            m_cache.coreRenderer->draw(useVertexCache ? m_cache.vertexCache : vertices, vertexCount, type);
         }
         else
         {
-            applyTransform(states.transform);
+            // If we pre-transform the vertices, we must use our internal vertex cache
+            if (useVertexCache)
+            {
+                // ... and if we already used it previously, we don't need to set the pointers again
+                if (!m_cache.useVertexCache)
+                    vertices = m_cache.vertexCache;
+                else
+                    vertices = NULL;
+            }
+
+            // Setup the pointers to the vertices' components
+            if (vertices)
+                setVertexPointers(vertices);
+
+            // Find the OpenGL primitive type
+            static const GLenum modes[] = {GL_POINTS, GL_LINES, GL_LINE_STRIP, GL_TRIANGLES,
+                                           GL_TRIANGLE_STRIP, GL_TRIANGLE_FAN, GL_QUADS};
+            GLenum mode = modes[type];
+
+            // Draw the primitives
+            glCheck(glDrawArrays(mode, 0, vertexCount));
         }
 
-        // Apply the view
-        if (m_cache.viewChanged)
-            applyCurrentView();
+        cleanupDraw(states);
+
+        // Update the cache
+        m_cache.useVertexCache = useVertexCache;
+    }
+}
 
-        // Apply the blend mode
-        if (states.blendMode != m_cache.lastBlendMode)
-            applyBlendMode(states.blendMode);
 
-        // Apply the texture
-        Uint64 textureId = states.texture ? states.texture->m_cacheId : 0;
-        if (textureId != m_cache.lastTextureId)
-            applyTexture(states.texture);
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const Vertex* vertices, std::size_t vertexCount,
+                        const Uint16* indices, std::size_t indexCount,
+                        PrimitiveType type, const RenderStates& states)
+{
+    if (indices)
+        drawUncached(vertices, vertexCount, indices, indexCount, sizeof(Uint16), type, states);
+}
 
-        // Apply the shader
-        if (states.shader)
-            applyShader(states.shader);
 
-        // If we pre-transform the vertices, we must use our internal vertex cache
-        if (useVertexCache)
-        {
-            // ... and if we already used it previously, we don't need to set the pointers again
-            if (!m_cache.useVertexCache)
-                vertices = m_cache.vertexCache;
-            else
-                vertices = NULL;
-        }
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const Vertex* vertices, std::size_t vertexCount,
+                        const Uint32* indices, std::size_t indexCount,
+                        PrimitiveType type, const RenderStates& states)
+{
+    if (indices)
+        drawUncached(vertices, vertexCount, indices, indexCount, sizeof(Uint32), type, states);
+}
 
-        // Setup the pointers to the vertices' components
-        if (vertices)
-        {
-            const char* data = reinterpret_cast<const char*>(vertices);
-            glCheck(glVertexPointer(2, GL_FLOAT, sizeof(Vertex), data + 0));
-            glCheck(glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex), data + 8));
-            glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), data + 12));
-        }
 
-        // Find the OpenGL primitive type
-        static const GLenum modes[] = {GL_POINTS, GL_LINES, GL_LINE_STRIP, GL_TRIANGLES,
-                                       GL_TRIANGLE_STRIP, GL_TRIANGLE_FAN, GL_QUADS};
-        GLenum mode = modes[type];
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const CompactVertex* vertices, std::size_t vertexCount,
+                        PrimitiveType type, const RenderStates& states)
+{
+    drawUncached(vertices, vertexCount, NULL, 0, 0, type, states);
+}
 
-        // Draw the primitives
-        glCheck(glDrawArrays(mode, 0, vertexCount));
 
-        // Unbind the shader, if any
-        if (states.shader)
-            applyShader(NULL);
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const CompactVertex* vertices, std::size_t vertexCount,
+                        const Uint16* indices, std::size_t indexCount,
+                        PrimitiveType type, const RenderStates& states)
+{
+    if (indices)
+        drawUncached(vertices, vertexCount, indices, indexCount, sizeof(Uint16), type, states);
+}
 
-        // If the texture we used to draw belonged to a RenderTexture, then forcibly unbind that texture.
-        // This prevents a bug where some drivers do not clear RenderTextures properly.
-        if (states.texture && states.texture->m_fboAttachment)
-            applyTexture(NULL);
 
-        // Update the cache
-        m_cache.useVertexCache = useVertexCache;
-    }
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const CompactVertex* vertices, std::size_t vertexCount,
+                        const Uint32* indices, std::size_t indexCount,
+                        PrimitiveType type, const RenderStates& states)
+{
+    if (indices)
+        drawUncached(vertices, vertexCount, indices, indexCount, sizeof(Uint32), type, states);
 }
 
 
 ////////////////////////////////////////////////////////////
 void RenderTarget::pushGLStates()
 {
-    if (activate(true))
+    if (ensureActive())
     {
         #ifdef SFML_DEBUG
             // make sure that the user didn't leave an unchecked OpenGL error
@@ -316,16 +385,20 @@ void RenderTarget::pushGLStates()
             }
         #endif
 
-        #ifndef SFML_OPENGL_ES
-            glCheck(glPushClientAttrib(GL_CLIENT_ALL_ATTRIB_BITS));
-            glCheck(glPushAttrib(GL_ALL_ATTRIB_BITS));
-        #endif
-        glCheck(glMatrixMode(GL_MODELVIEW));
-        glCheck(glPushMatrix());
-        glCheck(glMatrixMode(GL_PROJECTION));
-        glCheck(glPushMatrix());
-        glCheck(glMatrixMode(GL_TEXTURE));
-        glCheck(glPushMatrix());
+        // Core profile contexts have no attribute and matrix stacks
+        if (!priv::CoreRenderer::getActive())
+        {
+            #ifndef SFML_OPENGL_ES
+                glCheck(glPushClientAttrib(GL_CLIENT_ALL_ATTRIB_BITS));
+                glCheck(glPushAttrib(GL_ALL_ATTRIB_BITS));
+            #endif
+            glCheck(glMatrixMode(GL_MODELVIEW));
+            glCheck(glPushMatrix());
+            glCheck(glMatrixMode(GL_PROJECTION));
+            glCheck(glPushMatrix());
+            glCheck(glMatrixMode(GL_TEXTURE));
+            glCheck(glPushMatrix());
+        }
     }
 
     resetGLStates();
@@ -335,7 +408,7 @@ void RenderTarget::pushGLStates()
 ////////////////////////////////////////////////////////////
 void RenderTarget::popGLStates()
 {
-    if (activate(true))
+    if (ensureActive() && !priv::CoreRenderer::getActive())
     {
         glCheck(glMatrixMode(GL_PROJECTION));
         glCheck(glPopMatrix());
@@ -354,39 +427,50 @@ void RenderTarget::popGLStates()
 ////////////////////////////////////////////////////////////
 void RenderTarget::resetGLStates()
 {
-    // Check here to make sure a context change does not happen after activate(true)
+    // Check here to make sure a context change does not happen after ensureActive()
     bool shaderAvailable = Shader::isAvailable();
 
-    if (activate(true))
+    if (ensureActive())
     {
         // Make sure that extensions are initialized
         priv::ensureExtensionsInit();
 
+        // Core profile contexts don't have the fixed function pipeline
+        m_cache.coreRenderer = priv::CoreRenderer::getActive();
+
         // Make sure that the texture unit which is active is the number 0
         if (GLEXT_multitexture)
         {
-            glCheck(GLEXT_glClientActiveTexture(GLEXT_GL_TEXTURE0));
+            if (!m_cache.coreRenderer)
+                glCheck(GLEXT_glClientActiveTexture(GLEXT_GL_TEXTURE0));
             glCheck(GLEXT_glActiveTexture(GLEXT_GL_TEXTURE0));
         }
 
         // Define the default OpenGL states
         glCheck(glDisable(GL_CULL_FACE));
-        glCheck(glDisable(GL_LIGHTING));
         glCheck(glDisable(GL_DEPTH_TEST));
-        glCheck(glDisable(GL_ALPHA_TEST));
-        glCheck(glEnable(GL_TEXTURE_2D));
         glCheck(glEnable(GL_BLEND));
-        glCheck(glMatrixMode(GL_MODELVIEW));
-        glCheck(glEnableClientState(GL_VERTEX_ARRAY));
-        glCheck(glEnableClientState(GL_COLOR_ARRAY));
-        glCheck(glEnableClientState(GL_TEXTURE_COORD_ARRAY));
+        if (m_cache.coreRenderer)
+        {
+            m_cache.coreRenderer->resetStates();
+        }
+        else
+        {
+            glCheck(glDisable(GL_LIGHTING));
+            glCheck(glDisable(GL_ALPHA_TEST));
+            glCheck(glEnable(GL_TEXTURE_2D));
+            glCheck(glMatrixMode(GL_MODELVIEW));
+            glCheck(glEnableClientState(GL_VERTEX_ARRAY));
+            glCheck(glEnableClientState(GL_COLOR_ARRAY));
+            glCheck(glEnableClientState(GL_TEXTURE_COORD_ARRAY));
+        }
         m_cache.glStatesSet = true;
 
         // Apply the default SFML states
         applyBlendMode(BlendAlpha);
         applyTransform(Transform::Identity);
         applyTexture(NULL);
-        if (shaderAvailable)
+        if (shaderAvailable || m_cache.coreRenderer)
             applyShader(NULL);
 
         m_cache.useVertexCache = false;
@@ -397,6 +481,87 @@ void RenderTarget::resetGLStates()
 }
 
 
+////////////////////////////////////////////////////////////
+void RenderTarget::setProfilingEnabled(bool enabled)
+{
+    if (enabled && !m_profiler)
+    {
+        m_profiler = new priv::FrameProfiler;
+    }
+    else if (!enabled && m_profiler)
+    {
+        // The query objects of the profiler belong to our context
+        ensureActive();
+
+        delete m_profiler;
+        m_profiler = NULL;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTarget::isProfilingEnabled() const
+{
+    return m_profiler != NULL;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::beginProfileScope(const std::string& name)
+{
+    if (m_profiler)
+    {
+        // The CPU time is measured even if the GPU time can't be
+        ensureActive();
+        m_profiler->beginScope(name);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::endProfileScope()
+{
+    if (m_profiler)
+    {
+        ensureActive();
+        m_profiler->endScope();
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::endProfileFrame()
+{
+    if (m_profiler)
+    {
+        ensureActive();
+        m_profiler->endFrame();
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+const FrameProfile& RenderTarget::getFrameProfile() const
+{
+    static const FrameProfile empty;
+
+    return m_profiler ? m_profiler->getProfile() : empty;
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTarget::setProfileTraceFile(const std::string& filename)
+{
+    if (!m_profiler)
+    {
+        err() << "Failed to set profile trace file, profiling is not enabled" << std::endl;
+        return false;
+    }
+
+    return m_profiler->setTraceFile(filename);
+}
+
+
 ////////////////////////////////////////////////////////////
 void RenderTarget::initialize()
 {
@@ -409,6 +574,202 @@ void RenderTarget::initialize()
 }
 
 
+////////////////////////////////////////////////////////////
+void RenderTarget::markActive(bool active)
+{
+    Uint64 contextId = Context::getActiveContextId();
+
+    Lock lock(activeTargetsMutex);
+
+    if (active)
+    {
+        // Another target was drawn in this context since our last
+        // draw, or our states were set in another context: the
+        // cached states no longer reflect the GL states
+        Uint64& target = activeTargets[contextId];
+        if ((target != m_id) || (m_cache.contextId != contextId))
+        {
+            target = m_id;
+            m_cache.contextId = contextId;
+            m_cache.glStatesSet = false;
+        }
+    }
+    else
+    {
+        ActiveTargetMap::iterator it = activeTargets.find(contextId);
+        if ((it != activeTargets.end()) && (it->second == m_id))
+            activeTargets.erase(it);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTarget::isActive() const
+{
+    Uint64 contextId = Context::getActiveContextId();
+    if (!contextId)
+        return false;
+
+    Lock lock(activeTargetsMutex);
+
+    ActiveTargetMap::const_iterator it = activeTargets.find(contextId);
+    return (it != activeTargets.end()) && (it->second == m_id);
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTarget::ensureActive()
+{
+    // Activating a target may be expensive (context switch,
+    // frame buffer binding), so skip it when possible
+    return isActive() || activate(true);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::setupDraw(bool useVertexCache, const RenderStates& states)
+{
+    // First set the persistent OpenGL states if it's the very first call
+    if (!m_cache.glStatesSet)
+        resetGLStates();
+
+    // Pre-transformed vertices must be rendered with an identity transform
+    if (useVertexCache)
+    {
+        if (!m_cache.useVertexCache)
+            applyTransform(Transform::Identity);
+    }
+    else
+    {
+        applyTransform(states.transform);
+    }
+
+    // Apply the view
+    if (m_cache.viewChanged)
+        applyCurrentView();
+
+    // Apply the blend mode
+    if (states.blendMode != m_cache.lastBlendMode)
+        applyBlendMode(states.blendMode);
+
+    // Apply the texture
+    Uint64 textureId = states.texture ? states.texture->m_cacheId : 0;
+    if (textureId != m_cache.lastTextureId)
+        applyTexture(states.texture);
+
+    // Apply the shader
+    if (states.shader)
+        applyShader(states.shader);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::cleanupDraw(const RenderStates& states)
+{
+    // Unbind the shader, if any
+    if (states.shader)
+        applyShader(NULL);
+
+    // If the texture we used to draw belonged to a RenderTexture, then forcibly unbind that texture.
+    // This prevents a bug where some drivers do not clear RenderTextures properly.
+    if (states.texture && states.texture->m_fboAttachment)
+        applyTexture(NULL);
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+void RenderTarget::drawUncached(const T* vertices, std::size_t vertexCount,
+                                const void* indices, std::size_t indexCount, std::size_t indexSize,
+                                PrimitiveType type, const RenderStates& states)
+{
+    // Nothing to draw?
+    if (!vertices || (vertexCount == 0) || (indexSize && (indexCount == 0)))
+        return;
+
+    // GL_QUADS is unavailable on OpenGL ES, and OpenGL ES 1 only supports 16-bit indices
+    #ifdef SFML_OPENGL_ES
+        if (type == Quads)
+        {
+            err() << "sf::Quads primitive type is not supported on OpenGL ES platforms, drawing skipped" << std::endl;
+            return;
+        }
+        #define GL_QUADS 0
+
+        if (indexSize == sizeof(Uint32))
+        {
+            const Uint32* longIndices = static_cast<const Uint32*>(indices);
+
+            if (vertexCount <= 65536)
+            {
+                // The indices fit in 16 bits, convert them in a buffer that is reused by the next draws
+                m_cache.shortIndices.assign(longIndices, longIndices + indexCount);
+                indices = &m_cache.shortIndices[0];
+                indexSize = sizeof(Uint16);
+            }
+            else
+            {
+                // Too many vertices to address with 16-bit indices: expand the
+                // indexed vertices and draw them as a plain array instead
+                m_cache.flatVertices.resize(indexCount * sizeof(T));
+                T* flatVertices = reinterpret_cast<T*>(&m_cache.flatVertices[0]);
+                for (std::size_t i = 0; i < indexCount; ++i)
+                    flatVertices[i] = vertices[longIndices[i]];
+
+                vertices = flatVertices;
+                vertexCount = indexCount;
+                indices = NULL;
+                indexCount = 0;
+                indexSize = 0;
+            }
+        }
+    #endif
+
+    if (ensureActive())
+    {
+        // Only small arrays of standard vertices are pre-transformed
+        setupDraw(false, states);
+
+        if (m_profiler)
+            m_profiler->addDrawCall(vertexCount);
+
+        if (m_cache.coreRenderer)
+        {
+            if (indexSize)
+                m_cache.coreRenderer->draw(vertices, vertexCount, indices, indexCount, indexSize, type);
+            else
+                m_cache.coreRenderer->draw(vertices, vertexCount, type);
+        }
+        else
+        {
+            // Setup the pointers to the vertices' components
+            setVertexPointers(vertices);
+
+            // Find the OpenGL primitive type
+            static const GLenum modes[] = {GL_POINTS, GL_LINES, GL_LINE_STRIP, GL_TRIANGLES,
+                                           GL_TRIANGLE_STRIP, GL_TRIANGLE_FAN, GL_QUADS};
+            GLenum mode = modes[type];
+
+            // Draw the primitives
+            if (indexSize)
+            {
+                GLenum indexType = (indexSize == sizeof(Uint16)) ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+                glCheck(glDrawElements(mode, static_cast<GLsizei>(indexCount), indexType, indices));
+            }
+            else
+            {
+                glCheck(glDrawArrays(mode, 0, static_cast<GLsizei>(vertexCount)));
+            }
+        }
+
+        cleanupDraw(states);
+
+        // The vertex pointers no longer point to the vertex cache
+        m_cache.useVertexCache = false;
+    }
+}
+
+
 ////////////////////////////////////////////////////////////
 void RenderTarget::applyCurrentView()
 {
@@ -417,12 +778,20 @@ void RenderTarget::applyCurrentView()
     int top = getSize().y - (viewport.top + viewport.height);
     glCheck(glViewport(viewport.left, top, viewport.width, viewport.height));
 
-    // Set the projection matrix
-    glCheck(glMatrixMode(GL_PROJECTION));
-    glCheck(glLoadMatrixf(m_view.getTransform().getMatrix()));
+    if (m_cache.coreRenderer)
+    {
+        // Set the view-projection uniform
+        m_cache.coreRenderer->setViewProjection(m_view.getTransform());
+    }
+    else
+    {
+        // Set the projection matrix
+        glCheck(glMatrixMode(GL_PROJECTION));
+        glCheck(glLoadMatrixf(m_view.getTransform().getMatrix()));
 
-    // Go back to model-view mode
-    glCheck(glMatrixMode(GL_MODELVIEW));
+        // Go back to model-view mode
+        glCheck(glMatrixMode(GL_MODELVIEW));
+    }
 
     m_cache.viewChanged = false;
 }
@@ -473,31 +842,93 @@ void RenderTarget::applyBlendMode(const BlendMode& mode)
     }
 
     m_cache.lastBlendMode = mode;
+
+    if (m_profiler)
+        m_profiler->addBlendChange();
 }
 
 
 ////////////////////////////////////////////////////////////
 void RenderTarget::applyTransform(const Transform& transform)
 {
-    // No need to call glMatrixMode(GL_MODELVIEW), it is always the
-    // current mode (for optimization purpose, since it's the most used)
-    glCheck(glLoadMatrixf(transform.getMatrix()));
+    if (m_cache.coreRenderer)
+    {
+        m_cache.coreRenderer->setModel(transform);
+    }
+    else
+    {
+        // No need to call glMatrixMode(GL_MODELVIEW), it is always the
+        // current mode (for optimization purpose, since it's the most used)
+        glCheck(glLoadMatrixf(transform.getMatrix()));
+    }
 }
 
 
 ////////////////////////////////////////////////////////////
 void RenderTarget::applyTexture(const Texture* texture)
 {
-    Texture::bind(texture, Texture::Pixels);
+    if (m_cache.coreRenderer)
+    {
+        // Texture::bind sets the texture matrix of the fixed function
+        // pipeline, the core profile renderer takes it as a uniform
+        if (texture && texture->m_texture)
+        {
+            glCheck(glBindTexture(GL_TEXTURE_2D, texture->m_texture));
+            texture->m_used = true;
+
+            // Convert the range [0 .. size] to [0 .. 1], inverting the Y axis if pixels are flipped
+            float x = 1.f / texture->m_actualSize.x;
+            float y = 1.f / texture->m_actualSize.y;
+            if (texture->m_pixelsFlipped)
+                m_cache.coreRenderer->setTexture(Transform(x, 0.f, 0.f,
+                                                           0.f, -y, texture->m_size.y * y,
+                                                           0.f, 0.f, 1.f), true);
+            else
+                m_cache.coreRenderer->setTexture(Transform(x, 0.f, 0.f,
+                                                           0.f, y, 0.f,
+                                                           0.f, 0.f, 1.f), true);
+        }
+        else
+        {
+            glCheck(glBindTexture(GL_TEXTURE_2D, 0));
+            m_cache.coreRenderer->setTexture(Transform::Identity, false);
+        }
+    }
+    else
+    {
+        Texture::bind(texture, Texture::Pixels);
+    }
 
     m_cache.lastTextureId = texture ? texture->m_cacheId : 0;
+
+    if (m_profiler)
+        m_profiler->addTextureBind();
 }
 
 
 ////////////////////////////////////////////////////////////
 void RenderTarget::applyShader(const Shader* shader)
 {
-    Shader::bind(shader);
+    if (m_cache.coreRenderer)
+    {
+        // Without a shader, the built-in program must be used
+        if (shader && shader->getNativeHandle())
+        {
+            Shader::bind(shader);
+            m_cache.coreRenderer->useProgram(shader->getNativeHandle());
+        }
+        else
+        {
+            m_cache.coreRenderer->useProgram(0);
+        }
+    }
+    else
+    {
+        Shader::bind(shader);
+    }
+
+    if (shader && m_profiler)
+        m_profiler->addShaderBind();
 }
 
 } // namespace sf
@@ -50,9 +50,16 @@ RenderTexture::~RenderTexture()
 
 ////////////////////////////////////////////////////////////
 bool RenderTexture::create(unsigned int width, unsigned int height, bool depthBuffer)
+{
+    return create(width, height, Texture::RGBA8, depthBuffer);
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTexture::create(unsigned int width, unsigned int height, Texture::Format format, bool depthBuffer)
 {
     // Create the texture
-    if (!m_texture.create(width, height))
+    if (!m_texture.create(width, height, format))
     {
         err() << "Impossible to create render texture (failed to create the target texture)" << std::endl;
         return false;
@@ -61,25 +68,36 @@ bool RenderTexture::create(unsigned int width, unsigned int height, bool depthBu
     // We disable smoothing by default for render textures
     setSmooth(false);
 
-    // Create the implementation
-    delete m_impl;
-    if (priv::RenderTextureImplFBO::isAvailable())
+    // Create the implementation; it is kept when the render texture
+    // is created again, so that its OpenGL objects are recycled
+    bool useFBO = priv::RenderTextureImplFBO::isAvailable();
+    if (!m_impl)
     {
-        // Use frame-buffer object (FBO)
-        m_impl = new priv::RenderTextureImplFBO;
+        if (useFBO)
+        {
+            // Use frame-buffer object (FBO)
+            m_impl = new priv::RenderTextureImplFBO;
+        }
+        else
+        {
+            // Use default implementation
+            m_impl = new priv::RenderTextureImplDefault;
+        }
+    }
 
-        // Mark the texture as being a framebuffer object attachment
+    // Mark the texture as being a framebuffer object attachment
+    if (useFBO)
         m_texture.m_fboAttachment = true;
-    }
-    else
-    {
-        // Use default implementation
-        m_impl = new priv::RenderTextureImplDefault;
-    }
 
-    // Initialize the render texture
-    if (!m_impl->create(width, height, m_texture.m_texture, depthBuffer))
+    // Initialize the render texture; this changes the frame
+    // buffer or the context that is bound on this thread
+    bool created = m_impl->create(width, height, m_texture.m_texture, depthBuffer);
+    markActive(true);
+    if (!created)
+    {
+        markActive(false);
         return false;
+    }
 
     // We can now initialize the render target part
     RenderTarget::initialize();
@@ -119,7 +137,16 @@ bool RenderTexture::isRepeated() const
 ////////////////////////////////////////////////////////////
 bool RenderTexture::setActive(bool active)
 {
-    return m_impl && m_impl->activate(active);
+    // Deactivating the render texture while another target is active
+    // in the current context would unbind the other target
+    if (!active && !isActive())
+        return true;
+
+    bool result = m_impl && m_impl->activate(active);
+    if (result)
+        markActive(active);
+
+    return result;
 }
 
 
@@ -131,6 +158,11 @@ void RenderTexture::display()
     {
         m_impl->updateTexture(m_texture.m_texture);
         m_texture.m_pixelsFlipped = true;
+
+        // Restore the default frame buffer of the context we rendered
+        // from, so that it can be used directly by its window
+        if (m_texture.m_fboAttachment)
+            setActive(false);
     }
 }
 
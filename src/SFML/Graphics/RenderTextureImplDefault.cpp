@@ -61,7 +61,8 @@ bool RenderTextureImplDefault::create(unsigned int width, unsigned int height, u
     m_width = width;
     m_height = height;
 
-    // Create the in-memory OpenGL context
+    // Create the in-memory OpenGL context (its size can't change, so a previous one is discarded)
+    delete m_context;
     m_context = new Context(ContextSettings(depthBuffer ? 32 : 0), width, height);
 
     return true;
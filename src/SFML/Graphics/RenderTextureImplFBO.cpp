@@ -28,7 +28,40 @@
 #include <SFML/Graphics/RenderTextureImplFBO.hpp>
 #include <SFML/Graphics/Texture.hpp>
 #include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/System/Mutex.hpp>
+#include <SFML/System/Lock.hpp>
 #include <SFML/System/Err.hpp>
+#include <set>
+
+
+namespace
+{
+    // Frame buffers of destroyed render textures, which could not be deleted
+    // because their context was not active; they are deleted the next time
+    // a render texture is activated in their context
+    typedef std::multimap<sf::Uint64, unsigned int> StaleFrameBufferMap;
+    StaleFrameBufferMap staleFrameBuffers;
+
+    // Live render textures, whose frame buffers must be forgotten when their context dies
+    std::set<sf::priv::RenderTextureImplFBO*> frameBufferTextures;
+
+    // Protects the above, as well as the frame buffers of every render texture
+    sf::Mutex frameBuffersMutex;
+
+    // Delete the stale frame buffers that belong to the given context, which must be active
+    void deleteStaleFrameBuffers(sf::Uint64 contextId)
+    {
+        sf::Lock lock(frameBuffersMutex);
+
+        std::pair<StaleFrameBufferMap::iterator, StaleFrameBufferMap::iterator> range = staleFrameBuffers.equal_range(contextId);
+        for (StaleFrameBufferMap::iterator it = range.first; it != range.second; ++it)
+        {
+            GLuint frameBuffer = static_cast<GLuint>(it->second);
+            glCheck(GLEXT_glDeleteFramebuffers(1, &frameBuffer));
+        }
+        staleFrameBuffers.erase(range.first, range.second);
+    }
+}
 
 
 namespace sf
@@ -37,10 +70,15 @@ namespace priv
 {
 ////////////////////////////////////////////////////////////
 RenderTextureImplFBO::RenderTextureImplFBO() :
-m_frameBuffer(0),
-m_depthBuffer(0)
+m_frameBuffers(),
+m_depthBuffer (0),
+m_textureId   (0)
 {
+    Lock lock(frameBuffersMutex);
+    frameBufferTextures.insert(this);
 
+    // Frame buffers die with their context, our bookkeeping must too
+    Context::registerContextDestroyCallback(&RenderTextureImplFBO::cleanupContext, NULL);
 }
 
 
@@ -56,15 +94,11 @@ RenderTextureImplFBO::~RenderTextureImplFBO()
         glCheck(GLEXT_glDeleteRenderbuffers(1, &depthBuffer));
     }
 
-    // Destroy the frame buffer
-    if (m_frameBuffer)
-    {
-        GLuint frameBuffer = static_cast<GLuint>(m_frameBuffer);
-        glCheck(GLEXT_glDeleteFramebuffers(1, &frameBuffer));
-    }
+    // Destroy the frame buffers
+    destroyFrameBuffers();
 
-    // Delete the context
-    delete m_context;
+    Lock lock(frameBuffersMutex);
+    frameBufferTextures.erase(this);
 }
 
 
@@ -80,41 +114,115 @@ bool RenderTextureImplFBO::isAvailable()
 }
 
 
+////////////////////////////////////////////////////////////
+void RenderTextureImplFBO::unbind()
+{
+    if (isAvailable())
+        glCheck(GLEXT_glBindFramebuffer(GLEXT_GL_FRAMEBUFFER, 0));
+}
+
+
 ////////////////////////////////////////////////////////////
 bool RenderTextureImplFBO::create(unsigned int width, unsigned int height, unsigned int textureId, bool depthBuffer)
 {
-    // Create the context
-    m_context = new Context;
+    ensureGlContext();
 
-    // Create the framebuffer object
-    GLuint frameBuffer = 0;
-    glCheck(GLEXT_glGenFramebuffers(1, &frameBuffer));
-    m_frameBuffer = static_cast<unsigned int>(frameBuffer);
-    if (!m_frameBuffer)
-    {
-        err() << "Impossible to create render texture (failed to create the frame buffer object)" << std::endl;
-        return false;
-    }
-    glCheck(GLEXT_glBindFramebuffer(GLEXT_GL_FRAMEBUFFER, m_frameBuffer));
+    m_textureId = textureId;
+
+    // The frame buffers of a previous call may be attached to obsolete buffers
+    destroyFrameBuffers();
 
-    // Create the depth buffer if requested
+    // Create the depth buffer if requested (an existing one only needs a new storage)
     if (depthBuffer)
     {
-        GLuint depth = 0;
-        glCheck(GLEXT_glGenRenderbuffers(1, &depth));
-        m_depthBuffer = static_cast<unsigned int>(depth);
         if (!m_depthBuffer)
         {
-            err() << "Impossible to create render texture (failed to create the attached depth buffer)" << std::endl;
-            return false;
+            GLuint depth = 0;
+            glCheck(GLEXT_glGenRenderbuffers(1, &depth));
+            m_depthBuffer = static_cast<unsigned int>(depth);
+            if (!m_depthBuffer)
+            {
+                err() << "Impossible to create render texture (failed to create the attached depth buffer)" << std::endl;
+                return false;
+            }
         }
         glCheck(GLEXT_glBindRenderbuffer(GLEXT_GL_RENDERBUFFER, m_depthBuffer));
         glCheck(GLEXT_glRenderbufferStorage(GLEXT_GL_RENDERBUFFER, GLEXT_GL_DEPTH_COMPONENT, width, height));
-        glCheck(GLEXT_glFramebufferRenderbuffer(GLEXT_GL_FRAMEBUFFER, GLEXT_GL_DEPTH_ATTACHMENT, GLEXT_GL_RENDERBUFFER, m_depthBuffer));
     }
+    else if (m_depthBuffer)
+    {
+        // The depth buffer of a previous call is no longer needed
+        GLuint depth = static_cast<GLuint>(m_depthBuffer);
+        glCheck(GLEXT_glDeleteRenderbuffers(1, &depth));
+        m_depthBuffer = 0;
+    }
+
+    // Create the frame buffer of the current context, to make sure that everything works
+    return createFrameBuffer();
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTextureImplFBO::activate(bool active)
+{
+    // Deactivating only restores the default frame buffer, the context is left untouched
+    if (!active)
+    {
+        glCheck(GLEXT_glBindFramebuffer(GLEXT_GL_FRAMEBUFFER, 0));
+        return true;
+    }
+
+    // Render to the texture from the active context, there's no need to switch to another one
+    Uint64 contextId = Context::getActiveContextId();
+    if (!contextId)
+    {
+        ensureGlContext();
+        contextId = Context::getActiveContextId();
+    }
+
+    deleteStaleFrameBuffers(contextId);
+
+    Lock lock(frameBuffersMutex);
+
+    // Bind the frame buffer of this context, or create it if it's the first time we render from it
+    std::map<Uint64, unsigned int>::const_iterator it = m_frameBuffers.find(contextId);
+    if (it != m_frameBuffers.end())
+    {
+        glCheck(GLEXT_glBindFramebuffer(GLEXT_GL_FRAMEBUFFER, it->second));
+        return true;
+    }
+
+    return createFrameBuffer();
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTextureImplFBO::updateTexture(unsigned int)
+{
+    // Make the rendering visible to the other contexts that may use the texture
+    glCheck(glFlush());
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTextureImplFBO::createFrameBuffer()
+{
+    // Create the framebuffer object
+    GLuint frameBuffer = 0;
+    glCheck(GLEXT_glGenFramebuffers(1, &frameBuffer));
+    if (!frameBuffer)
+    {
+        err() << "Impossible to create render texture (failed to create the frame buffer object)" << std::endl;
+        return false;
+    }
+    glCheck(GLEXT_glBindFramebuffer(GLEXT_GL_FRAMEBUFFER, frameBuffer));
+
+    // Attach the depth buffer, which is shared between contexts
+    if (m_depthBuffer)
+        glCheck(GLEXT_glFramebufferRenderbuffer(GLEXT_GL_FRAMEBUFFER, GLEXT_GL_DEPTH_ATTACHMENT, GLEXT_GL_RENDERBUFFER, m_depthBuffer));
 
     // Link the texture to the frame buffer
-    glCheck(GLEXT_glFramebufferTexture2D(GLEXT_GL_FRAMEBUFFER, GLEXT_GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, textureId, 0));
+    glCheck(GLEXT_glFramebufferTexture2D(GLEXT_GL_FRAMEBUFFER, GLEXT_GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, m_textureId, 0));
 
     // A final check, just to be sure...
     GLenum status;
@@ -122,25 +230,62 @@ bool RenderTextureImplFBO::create(unsigned int width, unsigned int height, unsig
     if (status != GLEXT_GL_FRAMEBUFFER_COMPLETE)
     {
         glCheck(GLEXT_glBindFramebuffer(GLEXT_GL_FRAMEBUFFER, 0));
+        glCheck(GLEXT_glDeleteFramebuffers(1, &frameBuffer));
         err() << "Impossible to create render texture (failed to link the target texture to the frame buffer)" << std::endl;
         return false;
     }
 
+    Lock lock(frameBuffersMutex);
+    m_frameBuffers[Context::getActiveContextId()] = static_cast<unsigned int>(frameBuffer);
+
     return true;
 }
 
 
 ////////////////////////////////////////////////////////////
-bool RenderTextureImplFBO::activate(bool active)
+void RenderTextureImplFBO::destroyFrameBuffers()
 {
-    return m_context->setActive(active);
+    Uint64 contextId = Context::getActiveContextId();
+
+    Lock lock(frameBuffersMutex);
+
+    for (std::map<Uint64, unsigned int>::iterator it = m_frameBuffers.begin(); it != m_frameBuffers.end(); ++it)
+    {
+        if (it->first == contextId)
+        {
+            GLuint frameBuffer = static_cast<GLuint>(it->second);
+            glCheck(GLEXT_glDeleteFramebuffers(1, &frameBuffer));
+        }
+        else
+        {
+            // Frame buffers can only be deleted in their own context
+            staleFrameBuffers.insert(std::make_pair(it->first, it->second));
+        }
+    }
+
+    m_frameBuffers.clear();
 }
 
 
 ////////////////////////////////////////////////////////////
-void RenderTextureImplFBO::updateTexture(unsigned int)
+void RenderTextureImplFBO::cleanupContext(Uint64 contextId, void*)
 {
-    glCheck(glFlush());
+    // The dying context is active, delete what it still owns so that
+    // the bookkeeping of a context never outlives it
+    deleteStaleFrameBuffers(contextId);
+
+    Lock lock(frameBuffersMutex);
+
+    for (std::set<RenderTextureImplFBO*>::iterator it = frameBufferTextures.begin(); it != frameBufferTextures.end(); ++it)
+    {
+        std::map<Uint64, unsigned int>::iterator frameBuffer = (*it)->m_frameBuffers.find(contextId);
+        if (frameBuffer != (*it)->m_frameBuffers.end())
+        {
+            GLuint name = static_cast<GLuint>(frameBuffer->second);
+            glCheck(GLEXT_glDeleteFramebuffers(1, &name));
+            (*it)->m_frameBuffers.erase(frameBuffer);
+        }
+    }
 }
 
 } // namespace priv
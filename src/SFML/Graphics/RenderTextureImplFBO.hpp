@@ -31,6 +31,7 @@
 #include <SFML/Graphics/RenderTextureImpl.hpp>
 #include <SFML/Window/Context.hpp>
 #include <SFML/Window/GlResource.hpp>
+#include <map>
 
 
 namespace sf
@@ -66,8 +67,40 @@ public:
     ////////////////////////////////////////////////////////////
     static bool isAvailable();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Bind the default frame buffer in the current context
+    ///
+    /// This function does nothing if FBOs are not supported.
+    ///
+    ////////////////////////////////////////////////////////////
+    static void unbind();
+
 private:
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Create and bind a frame buffer object for the current context
+    ///
+    /// FBOs can't be shared between contexts, so one is
+    /// created for each context that renders to the texture.
+    ///
+    /// \return True if creation has been successful
+    ///
+    ////////////////////////////////////////////////////////////
+    bool createFrameBuffer();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destroy the frame buffer objects of all the contexts
+    ///
+    ////////////////////////////////////////////////////////////
+    void destroyFrameBuffers();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Forget the frame buffer objects of a destroyed context
+    ///
+    /// \param contextId Identifier of the context being destroyed
+    ///
+    ////////////////////////////////////////////////////////////
+    static void cleanupContext(Uint64 contextId, void*);
     ////////////////////////////////////////////////////////////
     /// \brief Create the render texture implementation
     ///
@@ -102,9 +135,9 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    Context*     m_context;     ///< Needs a separate OpenGL context for not messing up the other ones
-    unsigned int m_frameBuffer; ///< OpenGL frame buffer object
-    unsigned int m_depthBuffer; ///< Optional depth buffer attached to the frame buffer
+    std::map<Uint64, unsigned int> m_frameBuffers; ///< OpenGL frame buffer object of each context, indexed by context identifier
+    unsigned int                   m_depthBuffer;  ///< Optional depth buffer attached to the frame buffers
+    unsigned int                   m_textureId;    ///< OpenGL identifier of the target texture
 };
 
 } // namespace priv
@@ -0,0 +1,209 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/RenderTexturePool.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/System/Err.hpp>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+RenderTexturePool::RenderTexturePool() :
+m_entries      (),
+m_frame        (0),
+m_maxIdleFrames(60)
+{
+
+}
+
+
+////////////////////////////////////////////////////////////
+RenderTexturePool::~RenderTexturePool()
+{
+    for (std::vector<Entry>::iterator it = m_entries.begin(); it != m_entries.end(); ++it)
+        delete it->renderTexture;
+}
+
+
+////////////////////////////////////////////////////////////
+RenderTexture* RenderTexturePool::acquire(unsigned int width, unsigned int height, bool depthBuffer)
+{
+    return acquire(width, height, Texture::RGBA8, depthBuffer);
+}
+
+
+////////////////////////////////////////////////////////////
+RenderTexture* RenderTexturePool::acquire(unsigned int width, unsigned int height, Texture::Format format, bool depthBuffer)
+{
+    // First look for a released render-texture with the same attributes, and
+    // remember the least recently used one that could be created again instead
+    Entry* recyclable = NULL;
+    for (std::vector<Entry>::iterator it = m_entries.begin(); it != m_entries.end(); ++it)
+    {
+        if (it->inUse)
+            continue;
+
+        const Texture& texture = it->renderTexture->getTexture();
+        if ((texture.getSize().x == width) && (texture.getSize().y == height) &&
+            (texture.getFormat() == format) && (it->depthBuffer == depthBuffer))
+            return use(*it);
+
+        // Render-textures used during the current frame are not recycled,
+        // they are likely to be acquired again with their current size
+        if ((it->lastFrame != m_frame) && (!recyclable || (it->lastFrame < recyclable->lastFrame)))
+            recyclable = &*it;
+    }
+
+    // Create an idle render-texture again with the new attributes, this reuses its OpenGL objects
+    if (recyclable)
+    {
+        if (recyclable->renderTexture->create(width, height, format, depthBuffer))
+        {
+            recyclable->depthBuffer = depthBuffer;
+            return use(*recyclable);
+        }
+
+        // It's now in an invalid state, get rid of it
+        delete recyclable->renderTexture;
+        m_entries.erase(m_entries.begin() + (recyclable - &m_entries[0]));
+    }
+
+    // Nothing to reuse: create a new render-texture
+    RenderTexture* renderTexture = new RenderTexture;
+    if (!renderTexture->create(width, height, format, depthBuffer))
+    {
+        err() << "Failed to acquire render texture from pool" << std::endl;
+        delete renderTexture;
+        return NULL;
+    }
+
+    Entry entry;
+    entry.renderTexture = renderTexture;
+    entry.depthBuffer   = depthBuffer;
+    entry.inUse         = false;
+    entry.lastFrame     = m_frame;
+    m_entries.push_back(entry);
+
+    return use(m_entries.back());
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTexturePool::release(RenderTexture* renderTexture)
+{
+    for (std::vector<Entry>::iterator it = m_entries.begin(); it != m_entries.end(); ++it)
+    {
+        if (it->renderTexture == renderTexture)
+        {
+            it->inUse = false;
+            return;
+        }
+    }
+
+    err() << "Failed to release render texture (it doesn't belong to the pool)" << std::endl;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTexturePool::endFrame()
+{
+    ++m_frame;
+
+    // Destroy the render-textures that stayed unused for too long
+    std::vector<Entry>::iterator it = m_entries.begin();
+    while (it != m_entries.end())
+    {
+        if (!it->inUse && (m_frame - it->lastFrame > m_maxIdleFrames))
+        {
+            delete it->renderTexture;
+            it = m_entries.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTexturePool::setMaxIdleFrames(unsigned int frames)
+{
+    m_maxIdleFrames = frames;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int RenderTexturePool::getMaxIdleFrames() const
+{
+    return m_maxIdleFrames;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTexturePool::clear()
+{
+    std::vector<Entry>::iterator it = m_entries.begin();
+    while (it != m_entries.end())
+    {
+        if (!it->inUse)
+        {
+            delete it->renderTexture;
+            it = m_entries.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t RenderTexturePool::getSize() const
+{
+    return m_entries.size();
+}
+
+
+////////////////////////////////////////////////////////////
+RenderTexture* RenderTexturePool::use(Entry& entry)
+{
+    entry.inUse     = true;
+    entry.lastFrame = m_frame;
+
+    // Make it look like a newly created render-texture
+    RenderTexture& renderTexture = *entry.renderTexture;
+    renderTexture.setSmooth(false);
+    renderTexture.setRepeated(false);
+    renderTexture.setView(renderTexture.getDefaultView());
+
+    return &renderTexture;
+}
+
+} // namespace sf
@@ -27,6 +27,7 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/RenderWindow.hpp>
 #include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Graphics/RenderTextureImplFBO.hpp>
 
 
 namespace sf
@@ -64,7 +65,16 @@ RenderWindow::~RenderWindow()
 ////////////////////////////////////////////////////////////
 bool RenderWindow::activate(bool active)
 {
-    return setActive(active);
+    if (!setActive(active))
+        return false;
+
+    // A render texture may have left its frame buffer bound in our context
+    if (active)
+        priv::RenderTextureImplFBO::unbind();
+
+    markActive(active);
+
+    return true;
 }
 
 
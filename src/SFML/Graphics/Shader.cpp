@@ -29,6 +29,7 @@
 #include <SFML/Graphics/Shader.hpp>
 #include <SFML/Graphics/Texture.hpp>
 #include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Graphics/CoreRenderer.hpp>
 #include <SFML/Window/Context.hpp>
 #include <SFML/System/InputStream.hpp>
 #include <SFML/System/Mutex.hpp>
@@ -172,7 +173,10 @@ Shader::~Shader()
 
     // Destroy effect program
     if (m_shaderProgram)
+    {
+        priv::CoreRenderer::forgetProgram(m_shaderProgram);
         glCheck(GLEXT_glDeleteObject(castToGlHandle(m_shaderProgram)));
+    }
 }
 
 
@@ -543,6 +547,7 @@ bool Shader::compile(const char* vertexShaderCode, const char* fragmentShaderCod
     // Destroy the shader if it was already created
     if (m_shaderProgram)
     {
+        priv::CoreRenderer::forgetProgram(m_shaderProgram);
         glCheck(GLEXT_glDeleteObject(castToGlHandle(m_shaderProgram)));
         m_shaderProgram = 0;
     }
@@ -612,6 +617,13 @@ bool Shader::compile(const char* vertexShaderCode, const char* fragmentShaderCod
         glCheck(GLEXT_glDeleteObject(fragmentShader));
     }
 
+    // Bind the vertex attributes used by render targets in core
+    // profile contexts (see sf::RenderTarget); this has no effect
+    // on shaders that don't declare them
+    glCheck(GLEXT_glBindAttribLocation(shaderProgram, 0, "sf_position"));
+    glCheck(GLEXT_glBindAttribLocation(shaderProgram, 1, "sf_color"));
+    glCheck(GLEXT_glBindAttribLocation(shaderProgram, 2, "sf_texCoords"));
+
     // Link the program
     glCheck(GLEXT_glLinkProgram(shaderProgram));
 
@@ -130,8 +130,14 @@ const Color& Shape::getOutlineColor() const
 ////////////////////////////////////////////////////////////
 void Shape::setOutlineThickness(float thickness)
 {
-    m_outlineThickness = thickness;
-    update(); // recompute everything because the whole shape must be offset
+    if (thickness != m_outlineThickness)
+    {
+        m_outlineThickness = thickness;
+
+        // The fill and the extrusion directions don't depend on the thickness
+        if (m_vertices.getVertexCount() > 0)
+            updateOutline();
+    }
 }
 
 
@@ -165,6 +171,7 @@ m_outlineColor    (255, 255, 255),
 m_outlineThickness(0),
 m_vertices        (TrianglesFan),
 m_outlineVertices (TrianglesStrip),
+m_outlineNormals  (),
 m_insideBounds    (),
 m_bounds          ()
 {
@@ -180,6 +187,7 @@ void Shape::update()
     {
         m_vertices.resize(0);
         m_outlineVertices.resize(0);
+        m_outlineNormals.clear();
         return;
     }
 
@@ -205,6 +213,7 @@ void Shape::update()
     updateTexCoords();
 
     // Outline
+    updateOutlineNormals();
     updateOutline();
 }
 
@@ -249,10 +258,10 @@ void Shape::updateTexCoords()
 
 
 ////////////////////////////////////////////////////////////
-void Shape::updateOutline()
+void Shape::updateOutlineNormals()
 {
     std::size_t count = m_vertices.getVertexCount() - 2;
-    m_outlineVertices.resize((count + 1) * 2);
+    m_outlineNormals.resize(count);
 
     for (std::size_t i = 0; i < count; ++i)
     {
@@ -276,11 +285,23 @@ void Shape::updateOutline()
 
         // Combine them to get the extrusion direction
         float factor = 1.f + (n1.x * n2.x + n1.y * n2.y);
-        Vector2f normal = (n1 + n2) / factor;
+        m_outlineNormals[i] = (n1 + n2) / factor;
+    }
+}
+
 
-        // Update the outline points
-        m_outlineVertices[i * 2 + 0].position = p1;
-        m_outlineVertices[i * 2 + 1].position = p1 + normal * m_outlineThickness;
+////////////////////////////////////////////////////////////
+void Shape::updateOutline()
+{
+    std::size_t count = m_outlineNormals.size();
+    m_outlineVertices.resize((count + 1) * 2);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        // Extrude the fill points along their cached direction
+        Vector2f point = m_vertices[i + 1].position;
+        m_outlineVertices[i * 2 + 0].position = point;
+        m_outlineVertices[i * 2 + 1].position = point + m_outlineNormals[i] * m_outlineThickness;
     }
 
     // Duplicate the first point at the end, to close the outline
@@ -31,6 +31,27 @@
 #include <cmath>
 
 
+namespace
+{
+    // Add a quad as two indexed triangles sharing two of their vertices
+    void addQuad(sf::IndexedVertexArray& vertices, const sf::Vertex& topLeft, const sf::Vertex& topRight,
+                 const sf::Vertex& bottomLeft, const sf::Vertex& bottomRight)
+    {
+        sf::Uint32 first = vertices.append(topLeft);
+        vertices.append(topRight);
+        vertices.append(bottomLeft);
+        vertices.append(bottomRight);
+
+        vertices.appendIndex(first);
+        vertices.appendIndex(first + 1);
+        vertices.appendIndex(first + 2);
+        vertices.appendIndex(first + 2);
+        vertices.appendIndex(first + 1);
+        vertices.appendIndex(first + 3);
+    }
+}
+
+
 namespace sf
 {
 ////////////////////////////////////////////////////////////
@@ -298,12 +319,10 @@ void Text::ensureGeometryUpdate() const
             float top = std::floor(y + underlineOffset - (underlineThickness / 2) + 0.5f);
             float bottom = top + std::floor(underlineThickness + 0.5f);
 
-            m_vertices.append(Vertex(Vector2f(0, top),    m_color, Vector2f(1, 1)));
-            m_vertices.append(Vertex(Vector2f(x, top),    m_color, Vector2f(1, 1)));
-            m_vertices.append(Vertex(Vector2f(0, bottom), m_color, Vector2f(1, 1)));
-            m_vertices.append(Vertex(Vector2f(0, bottom), m_color, Vector2f(1, 1)));
-            m_vertices.append(Vertex(Vector2f(x, top),    m_color, Vector2f(1, 1)));
-            m_vertices.append(Vertex(Vector2f(x, bottom), m_color, Vector2f(1, 1)));
+            addQuad(m_vertices, Vertex(Vector2f(0, top),    m_color, Vector2f(1, 1)),
+                                Vertex(Vector2f(x, top),    m_color, Vector2f(1, 1)),
+                                Vertex(Vector2f(0, bottom), m_color, Vector2f(1, 1)),
+                                Vertex(Vector2f(x, bottom), m_color, Vector2f(1, 1)));
         }
 
         // If we're using the strike through style and there's a new line, draw a line across all characters
@@ -312,12 +331,10 @@ void Text::ensureGeometryUpdate() const
             float top = std::floor(y + strikeThroughOffset - (underlineThickness / 2) + 0.5f);
             float bottom = top + std::floor(underlineThickness + 0.5f);
 
-            m_vertices.append(Vertex(Vector2f(0, top),    m_color, Vector2f(1, 1)));
-            m_vertices.append(Vertex(Vector2f(x, top),    m_color, Vector2f(1, 1)));
-            m_vertices.append(Vertex(Vector2f(0, bottom), m_color, Vector2f(1, 1)));
-            m_vertices.append(Vertex(Vector2f(0, bottom), m_color, Vector2f(1, 1)));
-            m_vertices.append(Vertex(Vector2f(x, top),    m_color, Vector2f(1, 1)));
-            m_vertices.append(Vertex(Vector2f(x, bottom), m_color, Vector2f(1, 1)));
+            addQuad(m_vertices, Vertex(Vector2f(0, top),    m_color, Vector2f(1, 1)),
+                                Vertex(Vector2f(x, top),    m_color, Vector2f(1, 1)),
+                                Vertex(Vector2f(0, bottom), m_color, Vector2f(1, 1)),
+                                Vertex(Vector2f(x, bottom), m_color, Vector2f(1, 1)));
         }
 
         // Handle special characters
@@ -356,12 +373,10 @@ void Text::ensureGeometryUpdate() const
         float v2 = static_cast<float>(glyph.textureRect.top  + glyph.textureRect.height);
 
         // Add a quad for the current character
-        m_vertices.append(Vertex(Vector2f(x + left  - italic * top,    y + top),    m_color, Vector2f(u1, v1)));
-        m_vertices.append(Vertex(Vector2f(x + right - italic * top,    y + top),    m_color, Vector2f(u2, v1)));
-        m_vertices.append(Vertex(Vector2f(x + left  - italic * bottom, y + bottom), m_color, Vector2f(u1, v2)));
-        m_vertices.append(Vertex(Vector2f(x + left  - italic * bottom, y + bottom), m_color, Vector2f(u1, v2)));
-        m_vertices.append(Vertex(Vector2f(x + right - italic * top,    y + top),    m_color, Vector2f(u2, v1)));
-        m_vertices.append(Vertex(Vector2f(x + right - italic * bottom, y + bottom), m_color, Vector2f(u2, v2)));
+        addQuad(m_vertices, Vertex(Vector2f(x + left  - italic * top,    y + top),    m_color, Vector2f(u1, v1)),
+                            Vertex(Vector2f(x + right - italic * top,    y + top),    m_color, Vector2f(u2, v1)),
+                            Vertex(Vector2f(x + left  - italic * bottom, y + bottom), m_color, Vector2f(u1, v2)),
+                            Vertex(Vector2f(x + right - italic * bottom, y + bottom), m_color, Vector2f(u2, v2)));
 
         // Update the current bounds
         minX = std::min(minX, x + left - italic * bottom);
@@ -379,12 +394,10 @@ void Text::ensureGeometryUpdate() const
         float top = std::floor(y + underlineOffset - (underlineThickness / 2) + 0.5f);
         float bottom = top + std::floor(underlineThickness + 0.5f);
 
-        m_vertices.append(Vertex(Vector2f(0, top),    m_color, Vector2f(1, 1)));
-        m_vertices.append(Vertex(Vector2f(x, top),    m_color, Vector2f(1, 1)));
-        m_vertices.append(Vertex(Vector2f(0, bottom), m_color, Vector2f(1, 1)));
-        m_vertices.append(Vertex(Vector2f(0, bottom), m_color, Vector2f(1, 1)));
-        m_vertices.append(Vertex(Vector2f(x, top),    m_color, Vector2f(1, 1)));
-        m_vertices.append(Vertex(Vector2f(x, bottom), m_color, Vector2f(1, 1)));
+        addQuad(m_vertices, Vertex(Vector2f(0, top),    m_color, Vector2f(1, 1)),
+                            Vertex(Vector2f(x, top),    m_color, Vector2f(1, 1)),
+                            Vertex(Vector2f(0, bottom), m_color, Vector2f(1, 1)),
+                            Vertex(Vector2f(x, bottom), m_color, Vector2f(1, 1)));
     }
 
     // If we're using the strike through style, add the last line across all characters
@@ -393,12 +406,10 @@ void Text::ensureGeometryUpdate() const
         float top = std::floor(y + strikeThroughOffset - (underlineThickness / 2) + 0.5f);
         float bottom = top + std::floor(underlineThickness + 0.5f);
 
-        m_vertices.append(Vertex(Vector2f(0, top),    m_color, Vector2f(1, 1)));
-        m_vertices.append(Vertex(Vector2f(x, top),    m_color, Vector2f(1, 1)));
-        m_vertices.append(Vertex(Vector2f(0, bottom), m_color, Vector2f(1, 1)));
-        m_vertices.append(Vertex(Vector2f(0, bottom), m_color, Vector2f(1, 1)));
-        m_vertices.append(Vertex(Vector2f(x, top),    m_color, Vector2f(1, 1)));
-        m_vertices.append(Vertex(Vector2f(x, bottom), m_color, Vector2f(1, 1)));
+        addQuad(m_vertices, Vertex(Vector2f(0, top),    m_color, Vector2f(1, 1)),
+                            Vertex(Vector2f(x, top),    m_color, Vector2f(1, 1)),
+                            Vertex(Vector2f(0, bottom), m_color, Vector2f(1, 1)),
+                            Vertex(Vector2f(x, bottom), m_color, Vector2f(1, 1)));
     }
 
     // Update the bounding rectangle
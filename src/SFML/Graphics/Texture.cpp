@@ -73,6 +73,108 @@ namespace
 
         return static_cast<unsigned int>(size);
     }
+
+    // Get the OpenGL internal format of a texture format
+    GLint getInternalFormat(sf::Texture::Format format)
+    {
+        switch (format)
+        {
+            default:
+            case sf::Texture::RGBA8:   return GL_RGBA;
+            case sf::Texture::R8:      return GLEXT_GL_R8;
+            case sf::Texture::RG8:     return GLEXT_GL_RG8;
+            case sf::Texture::R16F:    return GLEXT_GL_R16F;
+            case sf::Texture::RGBA16F: return GLEXT_GL_RGBA16F;
+            case sf::Texture::R32F:    return GLEXT_GL_R32F;
+            case sf::Texture::RGBA32F: return GLEXT_GL_RGBA32F;
+        }
+    }
+
+    // Get the OpenGL pixel format (channels) matching a texture format
+    GLenum getPixelFormat(sf::Texture::Format format)
+    {
+        switch (format)
+        {
+            default:
+            case sf::Texture::RGBA8:
+            case sf::Texture::RGBA16F:
+            case sf::Texture::RGBA32F: return GL_RGBA;
+            case sf::Texture::RG8:     return GLEXT_GL_RG;
+            case sf::Texture::R8:
+            case sf::Texture::R16F:
+            case sf::Texture::R32F:    return GLEXT_GL_RED;
+        }
+    }
+
+    // Get the number of channels of a texture format
+    std::size_t getChannelCount(sf::Texture::Format format)
+    {
+        switch (format)
+        {
+            default:
+            case sf::Texture::RGBA8:
+            case sf::Texture::RGBA16F:
+            case sf::Texture::RGBA32F: return 4;
+            case sf::Texture::RG8:     return 2;
+            case sf::Texture::R8:
+            case sf::Texture::R16F:
+            case sf::Texture::R32F:    return 1;
+        }
+    }
+
+    // Copy the texels of a texture to another one of the same size and format, without any loss of precision
+    bool copyTexels(GLuint source, GLuint destination, unsigned int width, unsigned int height, sf::Texture::Format format)
+    {
+        // Make sure that the current texture binding will be preserved
+        sf::priv::TextureSaver save;
+
+        // Copy on the GPU when the source can be attached to a frame buffer
+        if (GLEXT_framebuffer_object)
+        {
+            GLint previousFrameBuffer;
+            glCheck(glGetIntegerv(GLEXT_GL_FRAMEBUFFER_BINDING, &previousFrameBuffer));
+
+            GLuint frameBuffer = 0;
+            glCheck(GLEXT_glGenFramebuffers(1, &frameBuffer));
+            glCheck(GLEXT_glBindFramebuffer(GLEXT_GL_FRAMEBUFFER, frameBuffer));
+            glCheck(GLEXT_glFramebufferTexture2D(GLEXT_GL_FRAMEBUFFER, GLEXT_GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, source, 0));
+
+            GLenum status;
+            glCheck(status = GLEXT_glCheckFramebufferStatus(GLEXT_GL_FRAMEBUFFER));
+            bool complete = (status == GLEXT_GL_FRAMEBUFFER_COMPLETE);
+            if (complete)
+            {
+                glCheck(glBindTexture(GL_TEXTURE_2D, destination));
+                glCheck(glCopyTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 0, 0, width, height));
+            }
+
+            glCheck(GLEXT_glBindFramebuffer(GLEXT_GL_FRAMEBUFFER, previousFrameBuffer));
+            glCheck(GLEXT_glDeleteFramebuffers(1, &frameBuffer));
+
+            if (complete)
+                return true;
+        }
+
+#ifndef SFML_OPENGL_ES
+
+        // Otherwise read the texels back as floats, which every format converts to exactly
+        GLenum pixelFormat = getPixelFormat(format);
+        std::vector<float> pixels(width * height * getChannelCount(format));
+        glCheck(glBindTexture(GL_TEXTURE_2D, source));
+        glCheck(glGetTexImage(GL_TEXTURE_2D, 0, pixelFormat, GL_FLOAT, &pixels[0]));
+        glCheck(glBindTexture(GL_TEXTURE_2D, destination));
+        glCheck(glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, pixelFormat, GL_FLOAT, &pixels[0]));
+
+        return true;
+
+#else
+
+        // OpenGL ES can only read back 8-bit pixels, leave it to the caller
+        (void)format;
+        return false;
+
+#endif
+    }
 }
 
 
@@ -83,10 +185,13 @@ Texture::Texture() :
 m_size         (0, 0),
 m_actualSize   (0, 0),
 m_texture      (0),
+m_format       (RGBA8),
 m_isSmooth     (false),
 m_isRepeated   (false),
 m_pixelsFlipped(false),
 m_fboAttachment(false),
+m_evicted      (false),
+m_used         (false),
 m_cacheId      (getUniqueId())
 {
 }
@@ -97,14 +202,33 @@ Texture::Texture(const Texture& copy) :
 m_size         (0, 0),
 m_actualSize   (0, 0),
 m_texture      (0),
+m_format       (RGBA8),
 m_isSmooth     (copy.m_isSmooth),
 m_isRepeated   (copy.m_isRepeated),
 m_pixelsFlipped(false),
 m_fboAttachment(false),
+m_evicted      (false),
+m_used         (false),
 m_cacheId      (getUniqueId())
 {
     if (copy.m_texture)
-        loadFromImage(copy.copyToImage());
+    {
+        if (copy.m_format == RGBA8)
+        {
+            loadFromImage(copy.copyToImage());
+        }
+        else if (create(copy.m_size.x, copy.m_size.y, copy.m_format) && !copy.m_evicted)
+        {
+            // Both textures have the same actual size, so the texels can be copied as they are;
+            // an 8-bit image would lose the precision of floating point textures
+            if (copyTexels(copy.m_texture, m_texture, m_actualSize.x, m_actualSize.y, m_format))
+                m_pixelsFlipped = copy.m_pixelsFlipped;
+            else
+                update(copy.copyToImage());
+
+            glCheck(glFlush());
+        }
+    }
 }
 
 
@@ -123,7 +247,7 @@ Texture::~Texture()
 
 
 ////////////////////////////////////////////////////////////
-bool Texture::create(unsigned int width, unsigned int height)
+bool Texture::create(unsigned int width, unsigned int height, Format format)
 {
     // Check if texture parameters are valid before creating it
     if ((width == 0) || (height == 0))
@@ -132,6 +256,12 @@ bool Texture::create(unsigned int width, unsigned int height)
         return false;
     }
 
+    if (!isFormatAvailable(format))
+    {
+        err() << "Failed to create texture, its format is not supported by the graphics driver" << std::endl;
+        return false;
+    }
+
     // Compute the internal texture dimensions depending on NPOT textures support
     Vector2u actualSize(getValidSize(width), getValidSize(height));
 
@@ -150,8 +280,10 @@ bool Texture::create(unsigned int width, unsigned int height)
     m_size.x        = width;
     m_size.y        = height;
     m_actualSize    = actualSize;
+    m_format        = format;
     m_pixelsFlipped = false;
     m_fboAttachment = false;
+    m_evicted       = false;
 
     ensureGlContext();
 
@@ -187,7 +319,7 @@ bool Texture::create(unsigned int width, unsigned int height)
 
     // Initialize the texture
     glCheck(glBindTexture(GL_TEXTURE_2D, m_texture));
-    glCheck(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, m_actualSize.x, m_actualSize.y, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL));
+    glCheck(glTexImage2D(GL_TEXTURE_2D, 0, getInternalFormat(m_format), m_actualSize.x, m_actualSize.y, 0, getPixelFormat(m_format), GL_UNSIGNED_BYTE, NULL));
     glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, m_isRepeated ? GL_REPEAT : (textureEdgeClamp ? GLEXT_GL_CLAMP_TO_EDGE : GLEXT_GL_CLAMP)));
     glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, m_isRepeated ? GL_REPEAT : (textureEdgeClamp ? GLEXT_GL_CLAMP_TO_EDGE : GLEXT_GL_CLAMP)));
     glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, m_isSmooth ? GL_LINEAR : GL_NEAREST));
@@ -296,11 +428,18 @@ Vector2u Texture::getSize() const
 }
 
 
+////////////////////////////////////////////////////////////
+Texture::Format Texture::getFormat() const
+{
+    return m_format;
+}
+
+
 ////////////////////////////////////////////////////////////
 Image Texture::copyToImage() const
 {
-    // Easy case: empty texture
-    if (!m_texture)
+    // Easy case: empty texture, or pixels not in video memory
+    if (!m_texture || m_evicted)
         return Image();
 
     ensureGlContext();
@@ -389,22 +528,24 @@ void Texture::update(const Uint8* pixels)
 ////////////////////////////////////////////////////////////
 void Texture::update(const Uint8* pixels, unsigned int width, unsigned int height, unsigned int x, unsigned int y)
 {
-    assert(x + width <= m_size.x);
-    assert(y + height <= m_size.y);
+    std::size_t channels = getChannelCount(m_format);
+    upload(pixels, width, height, x, y, getPixelFormat(m_format), GL_UNSIGNED_BYTE, channels);
+}
 
-    if (pixels && m_texture)
-    {
-        ensureGlContext();
 
-        // Make sure that the current texture binding will be preserved
-        priv::TextureSaver save;
+////////////////////////////////////////////////////////////
+void Texture::update(const float* pixels)
+{
+    // Update the whole texture
+    update(pixels, m_size.x, m_size.y, 0, 0);
+}
 
-        // Copy pixels from the given array to the texture
-        glCheck(glBindTexture(GL_TEXTURE_2D, m_texture));
-        glCheck(glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels));
-        m_pixelsFlipped = false;
-        m_cacheId = getUniqueId();
-    }
+
+////////////////////////////////////////////////////////////
+void Texture::update(const float* pixels, unsigned int width, unsigned int height, unsigned int x, unsigned int y)
+{
+    std::size_t channels = getChannelCount(m_format);
+    upload(pixels, width, height, x, y, getPixelFormat(m_format), GL_FLOAT, channels * sizeof(float));
 }
 
 
@@ -412,14 +553,15 @@ void Texture::update(const Uint8* pixels, unsigned int width, unsigned int heigh
 void Texture::update(const Image& image)
 {
     // Update the whole texture
-    update(image.getPixelsPtr(), image.getSize().x, image.getSize().y, 0, 0);
+    update(image, 0, 0);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Texture::update(const Image& image, unsigned int x, unsigned int y)
 {
-    update(image.getPixelsPtr(), image.getSize().x, image.getSize().y, x, y);
+    // Images are always RGBA, the driver drops the channels that the texture doesn't have
+    upload(image.getPixelsPtr(), image.getSize().x, image.getSize().y, x, y, GL_RGBA, GL_UNSIGNED_BYTE, 4);
 }
 
 
@@ -436,7 +578,7 @@ void Texture::update(const Window& window, unsigned int x, unsigned int y)
     assert(x + window.getSize().x <= m_size.x);
     assert(y + window.getSize().y <= m_size.y);
 
-    if (m_texture && window.setActive(true))
+    if (m_texture && !m_evicted && window.setActive(true))
     {
         // Make sure that the current texture binding will be preserved
         priv::TextureSaver save;
@@ -533,6 +675,7 @@ void Texture::bind(const Texture* texture, CoordinateType coordinateType)
     {
         // Bind the texture
         glCheck(glBindTexture(GL_TEXTURE_2D, texture->m_texture));
+        texture->m_used = true;
 
         // Check if we need to define a special texture matrix
         if ((coordinateType == Pixels) || texture->m_pixelsFlipped)
@@ -592,6 +735,28 @@ unsigned int Texture::getMaximumSize()
 }
 
 
+////////////////////////////////////////////////////////////
+bool Texture::isFormatAvailable(Format format)
+{
+    ensureGlContext();
+
+    // Make sure that extensions are initialized
+    priv::ensureExtensionsInit();
+
+    switch (format)
+    {
+        default:
+        case RGBA8:   return true;
+        case R8:
+        case RG8:     return GLEXT_texture_rg != 0;
+        case RGBA16F:
+        case RGBA32F: return GLEXT_texture_float != 0;
+        case R16F:
+        case R32F:    return (GLEXT_texture_float != 0) && (GLEXT_texture_rg != 0);
+    }
+}
+
+
 ////////////////////////////////////////////////////////////
 Texture& Texture::operator =(const Texture& right)
 {
@@ -600,10 +765,12 @@ Texture& Texture::operator =(const Texture& right)
     std::swap(m_size,          temp.m_size);
     std::swap(m_actualSize,    temp.m_actualSize);
     std::swap(m_texture,       temp.m_texture);
+    std::swap(m_format,        temp.m_format);
     std::swap(m_isSmooth,      temp.m_isSmooth);
     std::swap(m_isRepeated,    temp.m_isRepeated);
     std::swap(m_pixelsFlipped, temp.m_pixelsFlipped);
     std::swap(m_fboAttachment, temp.m_fboAttachment);
+    std::swap(m_evicted,       temp.m_evicted);
     m_cacheId = getUniqueId();
 
     return *this;
@@ -641,4 +808,57 @@ unsigned int Texture::getValidSize(unsigned int size)
     }
 }
 
+
+////////////////////////////////////////////////////////////
+void Texture::evict(const Color& placeholder)
+{
+    if (m_texture && !m_evicted)
+    {
+        ensureGlContext();
+
+        // Make sure that the current texture binding will be preserved
+        priv::TextureSaver save;
+
+        // Replace the storage with a single pixel; the texture matrix still uses
+        // the actual size, so all the texture coordinates fall on this pixel
+        Uint8 pixel[4] = {placeholder.r, placeholder.g, placeholder.b, placeholder.a};
+        glCheck(glBindTexture(GL_TEXTURE_2D, m_texture));
+        glCheck(glTexImage2D(GL_TEXTURE_2D, 0, getInternalFormat(m_format), 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixel));
+        m_pixelsFlipped = false;
+        m_evicted = true;
+        m_cacheId = getUniqueId();
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void Texture::upload(const void* pixels, unsigned int width, unsigned int height, unsigned int x, unsigned int y, unsigned int pixelFormat, unsigned int pixelType, std::size_t pixelSize)
+{
+    assert(x + width <= m_size.x);
+    assert(y + height <= m_size.y);
+
+    if (pixels && m_texture && !m_evicted)
+    {
+        ensureGlContext();
+
+        // Make sure that the current texture binding will be preserved
+        priv::TextureSaver save;
+
+        // Rows of narrow formats are not always aligned on 4 bytes (the OpenGL default)
+        bool packed = (width * pixelSize) % 4 != 0;
+        if (packed)
+            glCheck(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
+
+        // Copy pixels from the given array to the texture, the conversion
+        // to the internal format (if any) is done by the driver
+        glCheck(glBindTexture(GL_TEXTURE_2D, m_texture));
+        glCheck(glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, width, height, pixelFormat, pixelType, pixels));
+        m_pixelsFlipped = false;
+        m_cacheId = getUniqueId();
+
+        if (packed)
+            glCheck(glPixelStorei(GL_UNPACK_ALIGNMENT, 4));
+    }
+}
+
 } // namespace sf
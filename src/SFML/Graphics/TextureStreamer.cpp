@@ -0,0 +1,298 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/TextureStreamer.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/System/Lock.hpp>
+#include <SFML/System/Err.hpp>
+#include <limits>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+TextureStreamer::TextureStreamer() :
+m_entries      (),
+m_pending      (),
+m_finished     (),
+m_thread       (&TextureStreamer::loadRequests, this),
+m_threadRunning(false),
+m_mutex        (),
+m_budget       (std::numeric_limits<std::size_t>::max()),
+m_residentSize (0),
+m_placeholder  (Color::Transparent),
+m_frame        (0)
+{
+
+}
+
+
+////////////////////////////////////////////////////////////
+TextureStreamer::~TextureStreamer()
+{
+    // Stop the decoding thread
+    {
+        Lock lock(m_mutex);
+        m_threadRunning = false;
+    }
+    m_thread.wait();
+
+    // Destroy the requests which were not processed
+    for (std::deque<Request*>::iterator it = m_pending.begin(); it != m_pending.end(); ++it)
+        delete *it;
+    for (std::vector<Request*>::iterator it = m_finished.begin(); it != m_finished.end(); ++it)
+        delete *it;
+
+    // Destroy the textures
+    for (std::vector<Entry>::iterator it = m_entries.begin(); it != m_entries.end(); ++it)
+        delete it->texture;
+}
+
+
+////////////////////////////////////////////////////////////
+const Texture* TextureStreamer::loadFromFile(const std::string& filename)
+{
+    Image image;
+    if (!image.loadFromFile(filename))
+        return NULL;
+
+    Entry entry;
+    entry.filename = filename;
+    entry.data     = NULL;
+    entry.size     = 0;
+
+    return add(image, entry);
+}
+
+
+////////////////////////////////////////////////////////////
+const Texture* TextureStreamer::loadFromMemory(const void* data, std::size_t size)
+{
+    Image image;
+    if (!image.loadFromMemory(data, size))
+        return NULL;
+
+    Entry entry;
+    entry.data = data;
+    entry.size = size;
+
+    return add(image, entry);
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureStreamer::update()
+{
+    ++m_frame;
+
+    // Upload the textures which have been decoded
+    std::vector<Request*> finished;
+    {
+        Lock lock(m_mutex);
+        finished.swap(m_finished);
+    }
+    for (std::vector<Request*>::iterator it = finished.begin(); it != finished.end(); ++it)
+    {
+        Request& request = **it;
+        Entry& entry = m_entries[request.entry];
+        entry.loading = false;
+
+        if (request.success && entry.texture->loadFromImage(request.image))
+        {
+            entry.resident = true;
+            m_residentSize += entry.bytes;
+        }
+        else
+        {
+            // Don't try again, it would fail every frame
+            err() << "Failed to reload streamed texture" << std::endl;
+            entry.failed = true;
+            entry.texture->evict(m_placeholder);
+        }
+
+        delete *it;
+    }
+
+    // Collect the textures drawn since the last update, and reload those which are not resident
+    std::vector<Request*> requests;
+    for (std::size_t i = 0; i < m_entries.size(); ++i)
+    {
+        Entry& entry = m_entries[i];
+        if (!entry.texture->m_used)
+            continue;
+
+        entry.texture->m_used = false;
+        entry.lastUse = m_frame;
+
+        if (!entry.resident && !entry.loading && !entry.failed)
+        {
+            Request* request = new Request;
+            request->entry    = i;
+            request->filename = entry.filename;
+            request->data     = entry.data;
+            request->size     = entry.size;
+            request->success  = false;
+            requests.push_back(request);
+
+            entry.loading = true;
+        }
+    }
+    if (!requests.empty())
+    {
+        bool launch = false;
+        {
+            Lock lock(m_mutex);
+            m_pending.insert(m_pending.end(), requests.begin(), requests.end());
+            launch = !m_threadRunning;
+            m_threadRunning = true;
+        }
+
+        // Start the decoding thread if it's not running yet
+        if (launch)
+        {
+            m_thread.wait();
+            m_thread.launch();
+        }
+    }
+
+    // Evict the least recently drawn textures until we fit in the budget
+    while (m_residentSize > m_budget)
+    {
+        Entry* oldest = NULL;
+        for (std::vector<Entry>::iterator it = m_entries.begin(); it != m_entries.end(); ++it)
+        {
+            if (it->resident && (it->lastUse < m_frame) && (!oldest || (it->lastUse < oldest->lastUse)))
+                oldest = &*it;
+        }
+
+        // All the resident textures are in use
+        if (!oldest)
+            break;
+
+        oldest->texture->evict(m_placeholder);
+        oldest->resident = false;
+        m_residentSize -= oldest->bytes;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureStreamer::setBudget(std::size_t bytes)
+{
+    m_budget = bytes;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TextureStreamer::getBudget() const
+{
+    return m_budget;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TextureStreamer::getResidentSize() const
+{
+    return m_residentSize;
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureStreamer::setPlaceholderColor(const Color& color)
+{
+    m_placeholder = color;
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureStreamer::isResident(const Texture& texture) const
+{
+    return texture.m_texture && !texture.m_evicted;
+}
+
+
+////////////////////////////////////////////////////////////
+const Texture* TextureStreamer::add(const Image& image, Entry& entry)
+{
+    Texture* texture = new Texture;
+    if (!texture->loadFromImage(image))
+    {
+        delete texture;
+        return NULL;
+    }
+
+    // Count the actual (possibly padded) size of the texture
+    Vector2u actualSize(Texture::getValidSize(image.getSize().x), Texture::getValidSize(image.getSize().y));
+
+    entry.texture  = texture;
+    entry.bytes    = static_cast<std::size_t>(actualSize.x) * actualSize.y * 4;
+    entry.lastUse  = m_frame;
+    entry.resident = true;
+    entry.loading  = false;
+    entry.failed   = false;
+    m_entries.push_back(entry);
+
+    m_residentSize += entry.bytes;
+
+    return texture;
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureStreamer::loadRequests()
+{
+    for (;;)
+    {
+        // Get the next request, or stop when there's nothing left to do
+        Request* request = NULL;
+        {
+            Lock lock(m_mutex);
+
+            if (m_pending.empty() || !m_threadRunning)
+            {
+                m_threadRunning = false;
+                return;
+            }
+
+            request = m_pending.front();
+            m_pending.pop_front();
+        }
+
+        // Decode the image; this is the slow part, which doesn't need an OpenGL context
+        if (request->data)
+            request->success = request->image.loadFromMemory(request->data, request->size);
+        else
+            request->success = request->image.loadFromFile(request->filename);
+
+        {
+            Lock lock(m_mutex);
+            m_finished.push_back(request);
+        }
+    }
+}
+
+} // namespace sf
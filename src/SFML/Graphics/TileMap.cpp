@@ -0,0 +1,242 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/TileMap.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <algorithm>
+#include <cmath>
+
+
+namespace
+{
+    // Number of tiles on each side of a chunk
+    const unsigned int chunkSize = 32;
+}
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+const Uint16 TileMap::NoTile = 0xFFFF;
+
+
+////////////////////////////////////////////////////////////
+TileMap::Chunk::Chunk() :
+vertices  (Triangles),
+needUpdate(true)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+TileMap::TileMap() :
+m_tileset  (NULL),
+m_size     (0, 0),
+m_tileSize (0, 0),
+m_chunkGrid(0, 0),
+m_tiles    (),
+m_chunks   ()
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::create(unsigned int width, unsigned int height, const Vector2u& tileSize, Uint16 tile)
+{
+    m_size = Vector2u(width, height);
+    m_tileSize = tileSize;
+    m_tiles.assign(width * height, tile);
+
+    // Round up so that partial chunks on the right and bottom edges are covered too
+    m_chunkGrid.x = (width + chunkSize - 1) / chunkSize;
+    m_chunkGrid.y = (height + chunkSize - 1) / chunkSize;
+    m_chunks.assign(m_chunkGrid.x * m_chunkGrid.y, Chunk());
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::setTileset(const Texture& tileset)
+{
+    // Texture coordinates depend on the size of the tileset
+    if (!m_tileset || (tileset.getSize() != m_tileset->getSize()))
+        invalidateChunks();
+
+    m_tileset = &tileset;
+}
+
+
+////////////////////////////////////////////////////////////
+const Texture* TileMap::getTileset() const
+{
+    return m_tileset;
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::setTile(unsigned int x, unsigned int y, Uint16 tile)
+{
+    Uint16& current = m_tiles[x + y * m_size.x];
+    if (tile != current)
+    {
+        current = tile;
+        m_chunks[x / chunkSize + (y / chunkSize) * m_chunkGrid.x].needUpdate = true;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+Uint16 TileMap::getTile(unsigned int x, unsigned int y) const
+{
+    return m_tiles[x + y * m_size.x];
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2u TileMap::getSize() const
+{
+    return m_size;
+}
+
+
+////////////////////////////////////////////////////////////
+const Vector2u& TileMap::getTileSize() const
+{
+    return m_tileSize;
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect TileMap::getLocalBounds() const
+{
+    return FloatRect(0.f, 0.f, static_cast<float>(m_size.x * m_tileSize.x), static_cast<float>(m_size.y * m_tileSize.y));
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect TileMap::getGlobalBounds() const
+{
+    return getTransform().transformRect(getLocalBounds());
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::draw(RenderTarget& target, RenderStates states) const
+{
+    if (!m_tileset || m_chunks.empty() || (m_tileSize.x == 0) || (m_tileSize.y == 0))
+        return;
+
+    states.transform *= getTransform();
+    states.texture = m_tileset;
+
+    // Compute the area covered by the view, in local coordinates
+    FloatRect visible = target.getView().getInverseTransform().transformRect(FloatRect(-1.f, -1.f, 2.f, 2.f));
+    visible = states.transform.getInverse().transformRect(visible);
+
+    // Find the range of chunks which intersect it
+    float chunkWidth  = static_cast<float>(chunkSize * m_tileSize.x);
+    float chunkHeight = static_cast<float>(chunkSize * m_tileSize.y);
+    float left   = std::floor(visible.left / chunkWidth);
+    float top    = std::floor(visible.top / chunkHeight);
+    float right  = std::floor((visible.left + visible.width) / chunkWidth);
+    float bottom = std::floor((visible.top + visible.height) / chunkHeight);
+
+    if ((right < 0.f) || (bottom < 0.f) || (left >= m_chunkGrid.x) || (top >= m_chunkGrid.y))
+        return;
+
+    unsigned int firstX = static_cast<unsigned int>(std::max(left, 0.f));
+    unsigned int firstY = static_cast<unsigned int>(std::max(top, 0.f));
+    unsigned int lastX  = static_cast<unsigned int>(std::min(right, static_cast<float>(m_chunkGrid.x - 1)));
+    unsigned int lastY  = static_cast<unsigned int>(std::min(bottom, static_cast<float>(m_chunkGrid.y - 1)));
+
+    // Draw them, rebuilding those which are outdated
+    for (unsigned int y = firstY; y <= lastY; ++y)
+    {
+        for (unsigned int x = firstX; x <= lastX; ++x)
+        {
+            const Chunk& chunk = m_chunks[x + y * m_chunkGrid.x];
+            if (chunk.needUpdate)
+                updateChunk(x, y);
+
+            target.draw(chunk.vertices, states);
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::updateChunk(unsigned int x, unsigned int y) const
+{
+    Chunk& chunk = m_chunks[x + y * m_chunkGrid.x];
+    chunk.vertices.clear();
+    chunk.needUpdate = false;
+
+    unsigned int tilesPerRow = m_tileset->getSize().x / m_tileSize.x;
+    if (tilesPerRow == 0)
+        return;
+
+    unsigned int lastX = std::min((x + 1) * chunkSize, m_size.x);
+    unsigned int lastY = std::min((y + 1) * chunkSize, m_size.y);
+
+    for (unsigned int j = y * chunkSize; j < lastY; ++j)
+    {
+        for (unsigned int i = x * chunkSize; i < lastX; ++i)
+        {
+            Uint16 tile = m_tiles[i + j * m_size.x];
+            if (tile == NoTile)
+                continue;
+
+            float left   = static_cast<float>(i * m_tileSize.x);
+            float top    = static_cast<float>(j * m_tileSize.y);
+            float right  = left + m_tileSize.x;
+            float bottom = top + m_tileSize.y;
+
+            float u1 = static_cast<float>((tile % tilesPerRow) * m_tileSize.x);
+            float v1 = static_cast<float>((tile / tilesPerRow) * m_tileSize.y);
+            float u2 = u1 + m_tileSize.x;
+            float v2 = v1 + m_tileSize.y;
+
+            // Add a quad for the tile, as two triangles
+            chunk.vertices.append(Vertex(Vector2f(left,  top),    Vector2f(u1, v1)));
+            chunk.vertices.append(Vertex(Vector2f(right, top),    Vector2f(u2, v1)));
+            chunk.vertices.append(Vertex(Vector2f(left,  bottom), Vector2f(u1, v2)));
+            chunk.vertices.append(Vertex(Vector2f(left,  bottom), Vector2f(u1, v2)));
+            chunk.vertices.append(Vertex(Vector2f(right, top),    Vector2f(u2, v1)));
+            chunk.vertices.append(Vertex(Vector2f(right, bottom), Vector2f(u2, v2)));
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::invalidateChunks()
+{
+    for (std::vector<Chunk>::iterator it = m_chunks.begin(); it != m_chunks.end(); ++it)
+        it->needUpdate = true;
+}
+
+} // namespace sf
@@ -28,6 +28,14 @@
 #include <SFML/Graphics/Transform.hpp>
 #include <cmath>
 
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+    #include <xmmintrin.h>
+    #define SFML_TRANSFORM_SSE
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+    #include <arm_neon.h>
+    #define SFML_TRANSFORM_NEON
+#endif
+
 
 namespace sf
 {
@@ -109,6 +117,50 @@ Vector2f Transform::transformPoint(const Vector2f& point) const
 }
 
 
+////////////////////////////////////////////////////////////
+void Transform::transformPoints(const Vector2f* input, Vector2f* output, std::size_t count) const
+{
+    std::size_t i = 0;
+
+#if defined(SFML_TRANSFORM_SSE)
+
+    // Process 2 points at a time, stored as x0 y0 x1 y1
+    const float* in = &input[0].x;
+    float* out = &output[0].x;
+    __m128 column0 = _mm_setr_ps(m_matrix[0],  m_matrix[1],  m_matrix[0],  m_matrix[1]);
+    __m128 column1 = _mm_setr_ps(m_matrix[4],  m_matrix[5],  m_matrix[4],  m_matrix[5]);
+    __m128 column3 = _mm_setr_ps(m_matrix[12], m_matrix[13], m_matrix[12], m_matrix[13]);
+    for (; i + 2 <= count; i += 2)
+    {
+        __m128 points = _mm_loadu_ps(in + i * 2);
+        __m128 x = _mm_shuffle_ps(points, points, _MM_SHUFFLE(2, 2, 0, 0));
+        __m128 y = _mm_shuffle_ps(points, points, _MM_SHUFFLE(3, 3, 1, 1));
+        __m128 result = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, column0), _mm_mul_ps(y, column1)), column3);
+        _mm_storeu_ps(out + i * 2, result);
+    }
+
+#elif defined(SFML_TRANSFORM_NEON)
+
+    // Process 4 points at a time, deinterleaved into x and y vectors
+    const float* in = &input[0].x;
+    float* out = &output[0].x;
+    for (; i + 4 <= count; i += 4)
+    {
+        float32x4x2_t points = vld2q_f32(in + i * 2);
+        float32x4x2_t result;
+        result.val[0] = vmlaq_n_f32(vmlaq_n_f32(vdupq_n_f32(m_matrix[12]), points.val[0], m_matrix[0]), points.val[1], m_matrix[4]);
+        result.val[1] = vmlaq_n_f32(vmlaq_n_f32(vdupq_n_f32(m_matrix[13]), points.val[0], m_matrix[1]), points.val[1], m_matrix[5]);
+        vst2q_f32(out + i * 2, result);
+    }
+
+#endif
+
+    // Process the remaining points one by one
+    for (; i < count; ++i)
+        output[i] = transformPoint(input[i].x, input[i].y);
+}
+
+
 ////////////////////////////////////////////////////////////
 FloatRect Transform::transformRect(const FloatRect& rectangle) const
 {
@@ -29,6 +29,35 @@
 #include <cmath>
 
 
+namespace
+{
+    // Compute the transform combining a position, a rotation, a scale and an origin
+    sf::Transform computeTransform(const sf::Vector2f& position, float rotation, const sf::Vector2f& scale, const sf::Vector2f& origin)
+    {
+        // Avoid the trigonometric functions for the very common unrotated case
+        float cosine = 1.f;
+        float sine   = 0.f;
+        if (rotation != 0.f)
+        {
+            float angle = -rotation * 3.141592654f / 180.f;
+            cosine = static_cast<float>(std::cos(angle));
+            sine   = static_cast<float>(std::sin(angle));
+        }
+
+        float sxc = scale.x * cosine;
+        float syc = scale.y * cosine;
+        float sxs = scale.x * sine;
+        float sys = scale.y * sine;
+        float tx  = -origin.x * sxc - origin.y * sys + position.x;
+        float ty  =  origin.x * sxs - origin.y * syc + position.y;
+
+        return sf::Transform( sxc, sys, tx,
+                             -sxs, syc, ty,
+                              0.f, 0.f, 1.f);
+    }
+}
+
+
 namespace sf
 {
 ////////////////////////////////////////////////////////////
@@ -183,19 +212,7 @@ const Transform& Transformable::getTransform() const
     // Recompute the combined transform if needed
     if (m_transformNeedUpdate)
     {
-        float angle  = -m_rotation * 3.141592654f / 180.f;
-        float cosine = static_cast<float>(std::cos(angle));
-        float sine   = static_cast<float>(std::sin(angle));
-        float sxc    = m_scale.x * cosine;
-        float syc    = m_scale.y * cosine;
-        float sxs    = m_scale.x * sine;
-        float sys    = m_scale.y * sine;
-        float tx     = -m_origin.x * sxc - m_origin.y * sys + m_position.x;
-        float ty     =  m_origin.x * sxs - m_origin.y * syc + m_position.y;
-
-        m_transform = Transform( sxc, sys, tx,
-                                -sxs, syc, ty,
-                                 0.f, 0.f, 1.f);
+        m_transform = computeTransform(m_position, m_rotation, m_scale, m_origin);
         m_transformNeedUpdate = false;
     }
 
@@ -216,4 +233,13 @@ const Transform& Transformable::getInverseTransform() const
     return m_inverseTransform;
 }
 
+
+////////////////////////////////////////////////////////////
+void Transformable::computeTransforms(const Vector2f* positions, const float* rotations, const Vector2f* scales,
+                                      const Vector2f* origins, Transform* transforms, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; ++i)
+        transforms[i] = computeTransform(positions[i], rotations[i], scales[i], origins[i]);
+}
+
 } // namespace sf
@@ -0,0 +1,105 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Unix/ThreadSignalImpl.hpp>
+#include <sys/time.h>
+#include <algorithm>
+
+
+namespace sf
+{
+namespace priv
+{
+////////////////////////////////////////////////////////////
+ThreadSignalImpl::ThreadSignalImpl() :
+m_notified(false)
+{
+    pthread_mutex_init(&m_mutex, NULL);
+    pthread_cond_init(&m_condition, NULL);
+}
+
+
+////////////////////////////////////////////////////////////
+ThreadSignalImpl::~ThreadSignalImpl()
+{
+    pthread_cond_destroy(&m_condition);
+    pthread_mutex_destroy(&m_mutex);
+}
+
+
+////////////////////////////////////////////////////////////
+void ThreadSignalImpl::notify()
+{
+    pthread_mutex_lock(&m_mutex);
+    m_notified = true;
+    pthread_cond_signal(&m_condition);
+    pthread_mutex_unlock(&m_mutex);
+}
+
+
+////////////////////////////////////////////////////////////
+void ThreadSignalImpl::wait()
+{
+    pthread_mutex_lock(&m_mutex);
+
+    // Spurious wakeups are possible, the flag tells if we were really notified
+    while (!m_notified)
+        pthread_cond_wait(&m_condition, &m_mutex);
+
+    m_notified = false;
+    pthread_mutex_unlock(&m_mutex);
+}
+
+
+////////////////////////////////////////////////////////////
+bool ThreadSignalImpl::wait(Time timeout)
+{
+    // pthread_cond_timedwait takes an absolute time
+    timeval now;
+    gettimeofday(&now, NULL);
+
+    Int64 usecs = now.tv_usec + std::max(timeout.asMicroseconds(), Int64(0));
+    timespec deadline;
+    deadline.tv_sec = now.tv_sec + static_cast<time_t>(usecs / 1000000);
+    deadline.tv_nsec = static_cast<long>(usecs % 1000000) * 1000;
+
+    pthread_mutex_lock(&m_mutex);
+
+    // Keep waiting after spurious wakeups, until the deadline is reached
+    int result = 0;
+    while (!m_notified && (result == 0))
+        result = pthread_cond_timedwait(&m_condition, &m_mutex, &deadline);
+
+    bool notified = m_notified;
+    m_notified = false;
+    pthread_mutex_unlock(&m_mutex);
+
+    return notified;
+}
+
+} // namespace priv
+
+} // namespace sf
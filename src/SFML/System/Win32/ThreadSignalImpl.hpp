@@ -0,0 +1,93 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+#ifndef SFML_THREADSIGNALIMPL_HPP
+#define SFML_THREADSIGNALIMPL_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/NonCopyable.hpp>
+#include <SFML/System/Time.hpp>
+#include <windows.h>
+
+
+namespace sf
+{
+namespace priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Windows implementation of thread signals
+////////////////////////////////////////////////////////////
+class ThreadSignalImpl : NonCopyable
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ThreadSignalImpl();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~ThreadSignalImpl();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Notify the signal
+    ///
+    ////////////////////////////////////////////////////////////
+    void notify();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait until the signal is notified
+    ///
+    ////////////////////////////////////////////////////////////
+    void wait();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait until the signal is notified, or a timeout elapses
+    ///
+    /// \param timeout Maximum time to wait
+    ///
+    /// \return True if the signal was notified
+    ///
+    ////////////////////////////////////////////////////////////
+    bool wait(Time timeout);
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    HANDLE m_event; ///< Win32 handle of the auto-reset event
+};
+
+} // namespace priv
+
+} // namespace sf
+
+
+#endif // SFML_THREADSIGNALIMPL_HPP
@@ -98,6 +98,27 @@ const Context* Context::getActiveContext()
 }
 
 
+////////////////////////////////////////////////////////////
+Uint64 Context::getActiveContextId()
+{
+    return priv::GlContext::getActiveContextId();
+}
+
+
+////////////////////////////////////////////////////////////
+ContextSettings Context::getActiveContextSettings()
+{
+    return priv::GlContext::getActiveContextSettings();
+}
+
+
+////////////////////////////////////////////////////////////
+void Context::registerContextDestroyCallback(ContextDestroyCallback callback, void* arg)
+{
+    priv::GlContext::registerContextDestroyCallback(callback, arg);
+}
+
+
 ////////////////////////////////////////////////////////////
 GlFunctionPointer Context::getFunction(const char* name)
 {
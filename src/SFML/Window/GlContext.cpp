@@ -32,6 +32,7 @@
 #include <SFML/System/Err.hpp>
 #include <SFML/OpenGL.hpp>
 #include <set>
+#include <utility>
 #include <cstdlib>
 #include <cstring>
 
@@ -42,6 +43,11 @@
         #include <SFML/Window/Win32/WglContext.hpp>
         typedef sf::priv::WglContext ContextType;
 
+    #elif (defined(SFML_SYSTEM_LINUX) || defined(SFML_SYSTEM_FREEBSD)) && defined(SFML_HEADLESS)
+
+        #include <SFML/Window/Unix/EglHeadlessContext.hpp>
+        typedef sf::priv::EglHeadlessContext ContextType;
+
     #elif defined(SFML_SYSTEM_LINUX) || defined(SFML_SYSTEM_FREEBSD)
 
         #include <SFML/Window/Unix/GlxContext.hpp>
@@ -135,6 +141,20 @@ namespace
     std::set<sf::Context*> internalContexts;
     sf::Mutex internalContextsMutex;
 
+    // Functions to call when a context is destroyed, with their argument
+    typedef std::set<std::pair<sf::ContextDestroyCallback, void*> > ContextDestroyCallbacks;
+    ContextDestroyCallbacks contextDestroyCallbacks;
+    sf::Mutex contextDestroyCallbacksMutex;
+
+    // Generate a unique identifier for a new context
+    sf::Uint64 getUniqueContextId()
+    {
+        // The mutex is recursive, it may already be locked by the create functions
+        static sf::Uint64 nextId = 1;
+        sf::Lock lock(mutex);
+        return nextId++;
+    }
+
     // Check if the internal context of the current thread is valid
     bool hasInternalContext()
     {
@@ -278,6 +298,30 @@ GlFunctionPointer GlContext::getFunction(const char* name)
 }
 
 
+////////////////////////////////////////////////////////////
+Uint64 GlContext::getActiveContextId()
+{
+    GlContext* context = currentContext;
+    return context ? context->m_id : 0;
+}
+
+
+////////////////////////////////////////////////////////////
+ContextSettings GlContext::getActiveContextSettings()
+{
+    GlContext* context = currentContext;
+    return context ? context->m_settings : ContextSettings();
+}
+
+
+////////////////////////////////////////////////////////////
+void GlContext::registerContextDestroyCallback(ContextDestroyCallback callback, void* arg)
+{
+    Lock lock(contextDestroyCallbacksMutex);
+    contextDestroyCallbacks.insert(std::make_pair(callback, arg));
+}
+
+
 ////////////////////////////////////////////////////////////
 GlContext::~GlContext()
 {
@@ -294,6 +338,13 @@ const ContextSettings& GlContext::getSettings() const
 }
 
 
+////////////////////////////////////////////////////////////
+Uint64 GlContext::getId() const
+{
+    return m_id;
+}
+
+
 ////////////////////////////////////////////////////////////
 bool GlContext::setActive(bool active)
 {
@@ -339,12 +390,46 @@ bool GlContext::setActive(bool active)
 
 
 ////////////////////////////////////////////////////////////
-GlContext::GlContext()
+GlContext::GlContext() :
+m_id(getUniqueContextId())
 {
     // Nothing to do
 }
 
 
+////////////////////////////////////////////////////////////
+void GlContext::cleanupUnsharedResources()
+{
+    // The shared context owns only shared objects, nothing to release
+    if (this == sharedContext)
+        return;
+
+    // Take a copy so that callbacks can be registered from the callbacks themselves
+    ContextDestroyCallbacks callbacks;
+    {
+        Lock lock(contextDestroyCallbacksMutex);
+        callbacks = contextDestroyCallbacks;
+    }
+
+    if (callbacks.empty())
+        return;
+
+    // The callbacks release their objects through the dying context
+    GlContext* contextToRestore = currentContext;
+    if (!setActive(true))
+        return;
+
+    for (ContextDestroyCallbacks::iterator it = callbacks.begin(); it != callbacks.end(); ++it)
+        it->first(m_id, it->second);
+
+    // Restore the previous context; if there was none (or if it was this one),
+    // the destructor will take care of switching to an internal context.
+    // During the global cleanup the previous context may already be dead
+    if (sharedContext && contextToRestore && (contextToRestore != this))
+        contextToRestore->setActive(true);
+}
+
+
 ////////////////////////////////////////////////////////////
 int GlContext::evaluateFormat(unsigned int bitsPerPixel, const ContextSettings& settings, int colorBits, int depthBits, int stencilBits, int antialiasing, bool accelerated)
 {
@@ -130,6 +130,31 @@ public:
     ////////////////////////////////////////////////////////////
     static GlFunctionPointer getFunction(const char* name);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the identifier of the context active on the current thread
+    ///
+    /// \return Identifier of the active context, or 0 if none is active
+    ///
+    ////////////////////////////////////////////////////////////
+    static Uint64 getActiveContextId();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the settings of the context active on the current thread
+    ///
+    /// \return Settings of the active context, or default settings if none is active
+    ///
+    ////////////////////////////////////////////////////////////
+    static ContextSettings getActiveContextSettings();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Register a function to be called when a context is destroyed
+    ///
+    /// \param callback Function to call
+    /// \param arg      Argument passed to the function
+    ///
+    ////////////////////////////////////////////////////////////
+    static void registerContextDestroyCallback(ContextDestroyCallback callback, void* arg);
+
     ////////////////////////////////////////////////////////////
     /// \brief Destructor
     ///
@@ -148,6 +173,16 @@ public:
     ////////////////////////////////////////////////////////////
     const ContextSettings& getSettings() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the unique identifier of the context
+    ///
+    /// Identifiers are never reused, even after the context is destroyed.
+    ///
+    /// \return Identifier of the context
+    ///
+    ////////////////////////////////////////////////////////////
+    Uint64 getId() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Activate or deactivate the context as the current target for rendering
     ///
@@ -202,6 +237,17 @@ protected:
     ////////////////////////////////////////////////////////////
     virtual bool makeCurrent() = 0;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Notify the context destroy callbacks
+    ///
+    /// Derived classes must call this function at the beginning
+    /// of their destructor, while their native context is still
+    /// alive: it is activated during the callbacks, and the
+    /// previously active context is restored afterwards.
+    ///
+    ////////////////////////////////////////////////////////////
+    void cleanupUnsharedResources();
+
     ////////////////////////////////////////////////////////////
     /// \brief Evaluate a pixel format configuration
     ///
@@ -242,6 +288,11 @@ private:
     ///
     ////////////////////////////////////////////////////////////
     void checkSettings(const ContextSettings& requestedSettings);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    const Uint64 m_id; ///< Unique identifier of the context
 };
 
 } // namespace priv
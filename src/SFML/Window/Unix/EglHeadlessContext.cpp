@@ -0,0 +1,314 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Window/Unix/EglHeadlessContext.hpp>
+#include <SFML/System/Err.hpp>
+#include <SFML/System/Mutex.hpp>
+#include <SFML/System/Lock.hpp>
+#include <cstring>
+#include <vector>
+
+#if !defined(EGL_PLATFORM_SURFACELESS_MESA)
+    #define EGL_PLATFORM_SURFACELESS_MESA 0x31DD
+#endif
+
+#if !defined(EGL_CONTEXT_MAJOR_VERSION_KHR)
+    #define EGL_CONTEXT_MAJOR_VERSION_KHR             0x3098
+    #define EGL_CONTEXT_MINOR_VERSION_KHR             0x30FB
+    #define EGL_CONTEXT_FLAGS_KHR                     0x30FC
+    #define EGL_CONTEXT_OPENGL_PROFILE_MASK_KHR       0x30FD
+    #define EGL_CONTEXT_OPENGL_DEBUG_BIT_KHR          0x00000001
+    #define EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT_KHR   0x00000001
+    #define EGL_CONTEXT_OPENGL_COMPATIBILITY_PROFILE_BIT_KHR 0x00000002
+#endif
+
+
+namespace
+{
+    typedef EGLDisplay (*GetPlatformDisplayFuncType)(EGLenum, void*, const EGLint*);
+
+    // Check whether an EGL extension string contains a given extension
+    bool hasExtension(const char* extensions, const char* name)
+    {
+        return extensions && std::strstr(extensions, name);
+    }
+
+    // The display shared by all the headless contexts, initialized on first use;
+    // contexts may be created by several threads at the same time
+    EGLDisplay display = EGL_NO_DISPLAY;
+    sf::Mutex displayMutex;
+
+    EGLDisplay getInitializedDisplay()
+    {
+        sf::Lock lock(displayMutex);
+
+        if (display == EGL_NO_DISPLAY)
+        {
+            // Prefer the surfaceless platform of Mesa, which never connects to a display server;
+            // otherwise let the EGL implementation pick its default platform (the EGL_PLATFORM
+            // environment variable allows to select it at runtime)
+            const char* clientExtensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+            if (hasExtension(clientExtensions, "EGL_MESA_platform_surfaceless"))
+            {
+                GetPlatformDisplayFuncType getPlatformDisplay = reinterpret_cast<GetPlatformDisplayFuncType>(eglGetProcAddress("eglGetPlatformDisplayEXT"));
+                if (getPlatformDisplay)
+                    display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+            }
+
+            if (display == EGL_NO_DISPLAY)
+                display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+
+            if (!eglInitialize(display, NULL, NULL))
+            {
+                sf::err() << "Failed to initialize the EGL display for headless rendering" << std::endl;
+                display = EGL_NO_DISPLAY;
+            }
+        }
+
+        return display;
+    }
+}
+
+
+namespace sf
+{
+namespace priv
+{
+////////////////////////////////////////////////////////////
+EglHeadlessContext::EglHeadlessContext(EglHeadlessContext* shared) :
+m_display(EGL_NO_DISPLAY),
+m_context(EGL_NO_CONTEXT),
+m_surface(EGL_NO_SURFACE)
+{
+    m_settings = ContextSettings();
+
+    create(shared, 1, 1);
+}
+
+
+////////////////////////////////////////////////////////////
+EglHeadlessContext::EglHeadlessContext(EglHeadlessContext* shared, const ContextSettings& settings, const WindowImpl*, unsigned int) :
+m_display(EGL_NO_DISPLAY),
+m_context(EGL_NO_CONTEXT),
+m_surface(EGL_NO_SURFACE)
+{
+    err() << "Windows are not supported by headless OpenGL contexts, rendering to an offscreen surface instead" << std::endl;
+
+    m_settings = settings;
+
+    create(shared, 1, 1);
+}
+
+
+////////////////////////////////////////////////////////////
+EglHeadlessContext::EglHeadlessContext(EglHeadlessContext* shared, const ContextSettings& settings, unsigned int width, unsigned int height) :
+m_display(EGL_NO_DISPLAY),
+m_context(EGL_NO_CONTEXT),
+m_surface(EGL_NO_SURFACE)
+{
+    m_settings = settings;
+
+    create(shared, width, height);
+}
+
+
+////////////////////////////////////////////////////////////
+EglHeadlessContext::~EglHeadlessContext()
+{
+    // Notify unshared OpenGL resources of context destruction
+    cleanupUnsharedResources();
+
+    if (m_display == EGL_NO_DISPLAY)
+        return;
+
+    // Deactivate the context if it is the current one
+    if (eglGetCurrentContext() == m_context)
+    {
+        eglCheck(eglMakeCurrent(m_display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT));
+    }
+
+    if (m_context != EGL_NO_CONTEXT)
+    {
+        eglCheck(eglDestroyContext(m_display, m_context));
+    }
+
+    if (m_surface != EGL_NO_SURFACE)
+    {
+        eglCheck(eglDestroySurface(m_display, m_surface));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+GlFunctionPointer EglHeadlessContext::getFunction(const char* name)
+{
+    return reinterpret_cast<GlFunctionPointer>(eglGetProcAddress(name));
+}
+
+
+////////////////////////////////////////////////////////////
+bool EglHeadlessContext::makeCurrent()
+{
+    if (m_context == EGL_NO_CONTEXT)
+        return false;
+
+    // The client API is a per-thread state
+    eglCheck(eglBindAPI(EGL_OPENGL_API));
+
+    EGLBoolean result = eglCheck(eglMakeCurrent(m_display, m_surface, m_surface, m_context));
+
+    return result != EGL_FALSE;
+}
+
+
+////////////////////////////////////////////////////////////
+void EglHeadlessContext::display()
+{
+    // Nothing is ever presented, rendering results are read back from textures
+}
+
+
+////////////////////////////////////////////////////////////
+void EglHeadlessContext::setVerticalSyncEnabled(bool)
+{
+    // Offscreen surfaces are not synchronized with any monitor
+}
+
+
+////////////////////////////////////////////////////////////
+XVisualInfo EglHeadlessContext::selectBestVisual(::Display* display, unsigned int, const ContextSettings&)
+{
+    XVisualInfo visualInfo;
+    visualInfo.visual = DefaultVisual(display, DefaultScreen(display));
+    visualInfo.visualid = XVisualIDFromVisual(visualInfo.visual);
+    visualInfo.screen = DefaultScreen(display);
+    visualInfo.depth = DefaultDepth(display, DefaultScreen(display));
+
+    return visualInfo;
+}
+
+
+////////////////////////////////////////////////////////////
+void EglHeadlessContext::create(EglHeadlessContext* shared, unsigned int width, unsigned int height)
+{
+    m_display = getInitializedDisplay();
+    if (m_display == EGL_NO_DISPLAY)
+        return;
+
+    eglCheck(eglBindAPI(EGL_OPENGL_API));
+
+    EGLConfig config = getBestConfig();
+    if (!config)
+    {
+        err() << "Failed to find an EGL config for headless desktop OpenGL rendering" << std::endl;
+        return;
+    }
+
+    // Go surfaceless if the implementation supports it, otherwise create a small offscreen surface
+    if (!hasExtension(eglQueryString(m_display, EGL_EXTENSIONS), "EGL_KHR_surfaceless_context"))
+    {
+        const EGLint surfaceAttributes[] =
+        {
+            EGL_WIDTH,  static_cast<EGLint>(width),
+            EGL_HEIGHT, static_cast<EGLint>(height),
+            EGL_NONE
+        };
+
+        m_surface = eglCreatePbufferSurface(m_display, config, surfaceAttributes);
+        if (m_surface == EGL_NO_SURFACE)
+        {
+            err() << "Failed to create an offscreen EGL surface for headless rendering" << std::endl;
+            return;
+        }
+    }
+
+    EGLContext toShare = shared ? shared->m_context : EGL_NO_CONTEXT;
+
+    // Request a specific version and profile if the user asked for one (anything > 1.1)
+    if (hasExtension(eglQueryString(m_display, EGL_EXTENSIONS), "EGL_KHR_create_context") &&
+        ((m_settings.majorVersion > 1) || ((m_settings.majorVersion == 1) && (m_settings.minorVersion > 1))))
+    {
+        std::vector<EGLint> attributes;
+        attributes.push_back(EGL_CONTEXT_MAJOR_VERSION_KHR);
+        attributes.push_back(m_settings.majorVersion);
+        attributes.push_back(EGL_CONTEXT_MINOR_VERSION_KHR);
+        attributes.push_back(m_settings.minorVersion);
+        attributes.push_back(EGL_CONTEXT_OPENGL_PROFILE_MASK_KHR);
+        attributes.push_back((m_settings.attributeFlags & ContextSettings::Core) ? EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT_KHR : EGL_CONTEXT_OPENGL_COMPATIBILITY_PROFILE_BIT_KHR);
+        attributes.push_back(EGL_CONTEXT_FLAGS_KHR);
+        attributes.push_back((m_settings.attributeFlags & ContextSettings::Debug) ? EGL_CONTEXT_OPENGL_DEBUG_BIT_KHR : 0);
+        attributes.push_back(EGL_NONE);
+
+        m_context = eglCreateContext(m_display, config, toShare, &attributes[0]);
+    }
+
+    // Fall back to a default context (the actual version is retrieved by GlContext::initialize)
+    if (m_context == EGL_NO_CONTEXT)
+    {
+        m_context = eglCheck(eglCreateContext(m_display, config, toShare, NULL));
+    }
+
+    if (m_context == EGL_NO_CONTEXT)
+        err() << "Failed to create a headless OpenGL context" << std::endl;
+}
+
+
+////////////////////////////////////////////////////////////
+EGLConfig EglHeadlessContext::getBestConfig() const
+{
+    const EGLint attributes[] =
+    {
+        EGL_SURFACE_TYPE,    EGL_PBUFFER_BIT,
+        EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+        EGL_RED_SIZE,        8,
+        EGL_GREEN_SIZE,      8,
+        EGL_BLUE_SIZE,       8,
+        EGL_ALPHA_SIZE,      8,
+        EGL_DEPTH_SIZE,      static_cast<EGLint>(m_settings.depthBits),
+        EGL_STENCIL_SIZE,    static_cast<EGLint>(m_settings.stencilBits),
+        EGL_SAMPLE_BUFFERS,  m_settings.antialiasingLevel > 0 ? 1 : 0,
+        EGL_SAMPLES,         static_cast<EGLint>(m_settings.antialiasingLevel),
+        EGL_NONE
+    };
+
+    EGLint configCount = 0;
+    EGLConfig config = NULL;
+    eglCheck(eglChooseConfig(m_display, attributes, &config, 1, &configCount));
+
+    if (configCount == 0)
+    {
+        // Retry without the pbuffer requirement, for surfaceless-only implementations
+        std::vector<EGLint> relaxed(attributes + 2, attributes + sizeof(attributes) / sizeof(*attributes));
+        eglCheck(eglChooseConfig(m_display, &relaxed[0], &config, 1, &configCount));
+    }
+
+    return configCount > 0 ? config : NULL;
+}
+
+} // namespace priv
+
+} // namespace sf
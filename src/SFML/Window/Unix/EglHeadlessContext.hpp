@@ -0,0 +1,170 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2015 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_EGLHEADLESSCONTEXT_HPP
+#define SFML_EGLHEADLESSCONTEXT_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Window/GlContext.hpp>
+#include <SFML/Window/EGLCheck.hpp>
+#include <X11/Xutil.h>
+
+
+namespace sf
+{
+namespace priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Desktop OpenGL context created through EGL,
+///        without any display server
+///
+////////////////////////////////////////////////////////////
+class EglHeadlessContext : public GlContext
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create a new default context
+    ///
+    /// \param shared Context to share the new one with (can be NULL)
+    ///
+    ////////////////////////////////////////////////////////////
+    EglHeadlessContext(EglHeadlessContext* shared);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create a new context attached to a window
+    ///
+    /// Headless contexts can't render to windows: the context
+    /// is created with an offscreen surface instead.
+    ///
+    /// \param shared       Context to share the new one with
+    /// \param settings     Creation parameters
+    /// \param owner        Pointer to the owner window
+    /// \param bitsPerPixel Pixel depth, in bits per pixel
+    ///
+    ////////////////////////////////////////////////////////////
+    EglHeadlessContext(EglHeadlessContext* shared, const ContextSettings& settings, const WindowImpl* owner, unsigned int bitsPerPixel);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create a new context that embeds its own rendering target
+    ///
+    /// \param shared   Context to share the new one with
+    /// \param settings Creation parameters
+    /// \param width    Back buffer width, in pixels
+    /// \param height   Back buffer height, in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    EglHeadlessContext(EglHeadlessContext* shared, const ContextSettings& settings, unsigned int width, unsigned int height);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~EglHeadlessContext();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the address of an OpenGL function
+    ///
+    /// \param name Name of the function to get the address of
+    ///
+    /// \return Address of the OpenGL function, 0 on failure
+    ///
+    ////////////////////////////////////////////////////////////
+    static GlFunctionPointer getFunction(const char* name);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Activate the context as the current target for rendering
+    ///
+    /// \return True on success, false if any error happened
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual bool makeCurrent();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Display what has been rendered to the context so far
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void display();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable vertical synchronization
+    ///
+    /// This has no effect on offscreen surfaces.
+    ///
+    /// \param enabled True to enable v-sync, false to deactivate
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void setVerticalSyncEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Select the best X visual for a given set of settings
+    ///
+    /// Since headless contexts never render to windows, this
+    /// simply returns the default visual of the screen.
+    ///
+    /// \param display      X display
+    /// \param bitsPerPixel Pixel depth, in bits per pixel
+    /// \param settings     Requested context settings
+    ///
+    /// \return The best visual
+    ///
+    ////////////////////////////////////////////////////////////
+    static XVisualInfo selectBestVisual(::Display* display, unsigned int bitsPerPixel, const ContextSettings& settings);
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the offscreen surface and the context
+    ///
+    /// \param shared Context to share the new one with (can be NULL)
+    /// \param width  Width of the surface, in pixels
+    /// \param height Height of the surface, in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    void create(EglHeadlessContext* shared, unsigned int width, unsigned int height);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the best EGL config for the current settings
+    ///
+    /// \return The best EGL config, or NULL if none was found
+    ///
+    ////////////////////////////////////////////////////////////
+    EGLConfig getBestConfig() const;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    EGLDisplay m_display; ///< The internal EGL display
+    EGLContext m_context; ///< The internal EGL context
+    EGLSurface m_surface; ///< The offscreen surface, EGL_NO_SURFACE if the context is surfaceless
+};
+
+} // namespace priv
+
+} // namespace sf
+
+
+#endif // SFML_EGLHEADLESSCONTEXT_HPP
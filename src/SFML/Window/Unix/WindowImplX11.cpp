@@ -47,9 +47,12 @@
 #include <string>
 #include <cstring>
 
-#ifdef SFML_OPENGL_ES
+#if defined(SFML_OPENGL_ES)
     #include <SFML/Window/EglContext.hpp>
     typedef sf::priv::EglContext ContextType;
+#elif defined(SFML_HEADLESS)
+    #include <SFML/Window/Unix/EglHeadlessContext.hpp>
+    typedef sf::priv::EglHeadlessContext ContextType;
 #else
     #include <SFML/Window/Unix/GlxContext.hpp>
     typedef sf::priv::GlxContext ContextType;